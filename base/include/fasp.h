@@ -421,6 +421,18 @@ typedef struct {
     //! permuted if permtol*|a(i,j)| > |a(i,i)|
     REAL ILU_permtol;
 
+    //! number of Jacobi sweeps for triangular solves (0: exact solves)
+    INT ILU_jacobi_sweeps;
+
+    //! number of fixed-point sweeps for ILUk factorization (0: sequential ILUk)
+    INT ILU_fp_sweeps;
+
+    //! ordering before factorization: 0 natural | 1 RCM | 2 nested dissection
+    INT ILU_reorder;
+
+    //! split copy of the factors for faster triangular solves (0: MSR only)
+    INT ILU_split;
+
 } ILU_param; /**< Parameters for ILU */
 
 /**
@@ -496,12 +508,36 @@ typedef struct {
     //! degree of the polynomial smoother
     SHORT polynomial_degree;
 
+    //! ratio of the lower to the upper eigenvalue bound for Chebyshev smoother
+    REAL cheby_ratio;
+
     //! coarse solver type
     SHORT coarse_solver;
 
     //! switch of scaling of the coarse grid correction
     SHORT coarse_scaling;
 
+    //! switch of applying R = P' on the fly without storing R
+    SHORT implicit_restriction;
+
+    //! drop tolerance for sparsifying coarse matrices after RAP (0: no sparsification)
+    REAL sparsify_tol;
+
+    //! first coarse level to be sparsified
+    SHORT sparsify_level;
+
+    //! grid complexity budget of the setup (0: no budget)
+    REAL max_grid_complexity;
+
+    //! operator complexity budget of the setup (0: no budget)
+    REAL max_operator_complexity;
+
+    //! memory budget of the multilevel hierarchy in MB (0: no budget)
+    REAL max_memory;
+
+    //! policy of the number of OpenMP threads on each level
+    SHORT thread_policy;
+
     //! degree of the polynomial used by AMLI cycle
     SHORT amli_degree;
 
@@ -532,6 +568,9 @@ typedef struct {
     //! truncation threshold
     REAL truncation_threshold;
 
+    //! max number of nonzeros per row of interpolation (0: no limit)
+    INT truncation_max_nnz;
+
     //! number of levels use aggressive coarsening
     INT aggressive_level;
 
@@ -715,8 +754,52 @@ typedef struct {
     //! mapping from row to color for upper triangle
     INT* jlevU;
 
+    //! number of Jacobi sweeps for triangular solves (0: exact solves)
+    INT jacobi_sweeps;
+
+    //! strictly lower part of L in CSR format (split storage)
+    dCSRmat L;
+
+    //! strictly upper part of U in CSR format (split storage)
+    dCSRmat U;
+
+    //! inverted diagonal of U (split storage, NULL if not built)
+    REAL* diaginv;
+
+    //! row i of LU is row perm[i] of A (NULL: natural ordering)
+    INT* perm;
+
 } ILU_data; /**< Data for ILU */
 
+/**
+ * \struct BJILU_data
+ * \brief  Data for thread-domain block-Jacobi ILU
+ *
+ * \note Rows are split into nblk contiguous ranges with balanced nonzeros and
+ *       each diagonal block has its own ILU factorization.
+ */
+typedef struct {
+
+    //! row number of the original matrix
+    INT row;
+
+    //! number of diagonal blocks
+    INT nblk;
+
+    //! starting row of each block, the size is nblk+1
+    INT* start;
+
+    //! diagonal blocks of the original matrix
+    dCSRmat* Ablk;
+
+    //! ILU factorization of each diagonal block
+    ILU_data* LU;
+
+    //! work space for residual and correction, the size is 2*row
+    REAL* work;
+
+} BJILU_data; /**< Data for block-Jacobi ILU */
+
 /**
  * \struct SWZ_data
  * \brief  Data for Schwarz methods
@@ -744,10 +827,10 @@ typedef struct {
     //! temp work space ???
     REAL* rhsloc;
 
-    //! local right hand side
+    //! local right hand side (maxbs for each thread of the parallel sweeps)
     dvector rhsloc1;
 
-    //! local solution
+    //! local solution (maxbs for each thread of the parallel sweeps)
     dvector xloc1;
 
     //! LU decomposition: the U block
@@ -762,7 +845,7 @@ typedef struct {
     //! Schwarz block solver
     INT blk_solver;
 
-    //! working space size
+    //! working space size: the length of rhsloc1 and xloc1
     INT memt;
 
     //! mask
@@ -793,6 +876,15 @@ typedef struct {
     //! param for Schwarz
     SWZ_param* swzparam;
 
+    //! number of colors of blocks for parallel sweeps (0: sequential sweeps)
+    INT ncolors;
+
+    //! starting position of each color in jcolor, the size is ncolors+1
+    INT* icolor;
+
+    //! blocks ordered by colors; blocks of the same color do not overlap or couple
+    INT* jcolor;
+
 } SWZ_data; /**< Data for Schwarz method */
 
 /**
@@ -822,6 +914,13 @@ typedef struct {
     //! prolongation operator at level level_num
     dCSRmat P;
 
+    //! pattern of R = P' with the positions of its entries in P (if R is not formed);
+    //! for aggregate maps, the fine nodes of each aggregate without positions
+    iCSRmat Rmap;
+
+    //! aggregate of each node for UA AMG (P and R are not formed if available)
+    ivector aggmap;
+
     //! pointer to the right-hand side at level level_num
     dvector b;
 
@@ -836,6 +935,12 @@ typedef struct {
     //! data for Intel MKL PARDISO
     Pardiso_data pdata;
 
+    //! dense LU factors of the coarsest matrix for the built-in direct solver
+    REAL* dense_LU;
+
+    //! pivoting positions of the dense LU factors
+    INT* dense_piv;
+
     //! pointer to the CF marker at level level_num
     ivector cfmark;
 
@@ -859,6 +964,9 @@ typedef struct {
     //! data of Schwarz smoother
     SWZ_data Schwarz;
 
+    //! data of block-Jacobi ILU smoother
+    BJILU_data BJILU;
+
     //! temporary work space
     dvector w;
 
@@ -880,9 +988,33 @@ typedef struct {
     //! weight for smoother
     REAL weight;
 
+    //! number of OpenMP threads used on level level_num (0: all threads)
+    INT threads;
+
+    //! inverse of the diagonal of A for Chebyshev smoother
+    dvector diaginv;
+
+    //! lower eigenvalue bound of D^{-1}A for Chebyshev smoother
+    REAL cheby_lmin;
+
+    //! upper eigenvalue bound of D^{-1}A for Chebyshev smoother
+    REAL cheby_lmax;
+
+    //! coefficients of the AMLI polynomial on level level_num (NULL: amli_coef of AMG_param)
+    REAL* amli_coef;
+
 #if MULTI_COLOR_ORDER
     //! Gauss-Seidel Multicoloring factors. zhaoli,2021.08.25
     REAL GS_Theta;
+
+    //! off-diagonal part of A permuted to color-contiguous order (formed on first use)
+    dCSRmat Amc;
+
+    //! inverse of the diagonal of A in color-contiguous order
+    dvector mc_dinv;
+
+    //! work space for x and b in color-contiguous order, the size is 2*row
+    dvector mc_work;
 #endif
 
 } AMG_data; /**< Data for AMG methods */
@@ -1149,6 +1281,10 @@ typedef struct {
     REAL  ILU_droptol; /**< drop tolerance */
     REAL  ILU_relax;   /**< scaling factor: add the dropped entries to diagonal */
     REAL  ILU_permtol; /**< permutation tolerance */
+    INT   ILU_jacobi_sweeps; /**< Jacobi sweeps for triangular solves */
+    INT   ILU_fp_sweeps;     /**< fixed-point sweeps for ILUk factorization */
+    INT   ILU_reorder;       /**< ordering before ILU factorization */
+    INT   ILU_split;         /**< split copy of the ILU factors */
 
     // parameter for Schwarz
     INT SWZ_mmsize;    /**< maximal block size */
@@ -1164,6 +1300,7 @@ typedef struct {
     SHORT AMG_smooth_order;        /**< order for smoothers */
     REAL  AMG_relaxation;          /**< over-relaxation parameter for SOR */
     SHORT AMG_polynomial_degree;   /**< degree of the polynomial smoother */
+    REAL  AMG_cheby_ratio;         /**< lower/upper eigenvalue ratio for Chebyshev */
     SHORT AMG_presmooth_iter;      /**< number of presmoothing */
     SHORT AMG_postsmooth_iter;     /**< number of postsmoothing */
     REAL  AMG_tol;                 /**< tolerance for AMG as preconditioner */
@@ -1172,6 +1309,13 @@ typedef struct {
     SHORT AMG_ILU_levels;          /**< how many levels use ILU smoother */
     SHORT AMG_coarse_solver;       /**< coarse solver type */
     SHORT AMG_coarse_scaling;      /**< switch of scaling of coarse grid correction */
+    SHORT AMG_implicit_restriction; /**< switch of applying R = P' without storing R */
+    REAL  AMG_sparsify_tol;        /**< drop tolerance for sparsifying coarse matrices */
+    SHORT AMG_sparsify_level;      /**< first coarse level to be sparsified */
+    REAL  AMG_max_grid_complexity; /**< grid complexity budget of the setup */
+    REAL  AMG_max_operator_complexity; /**< operator complexity budget of the setup */
+    REAL  AMG_max_memory;          /**< memory budget of the hierarchy in MB */
+    SHORT AMG_thread_policy;       /**< policy of the number of threads on each level */
     SHORT AMG_amli_degree;         /**< degree of the polynomial in AMLI cycle */
     SHORT AMG_nl_amli_krylov_type; /**< type of Krylov method in nonlinear AMLI cycle */
     INT   AMG_SWZ_levels;          /**< number of levels use Schwarz smoother */
@@ -1182,6 +1326,7 @@ typedef struct {
     SHORT AMG_interpolation_type;   /**< interpolation type */
     REAL  AMG_strong_threshold;     /**< strong threshold for coarsening */
     REAL  AMG_truncation_threshold; /**< truncation factor for interpolation */
+    INT   AMG_truncation_max_nnz;   /**< max nonzeros per row of interpolation */
     REAL  AMG_max_row_sum;          /**< maximal row sum */
     INT   AMG_aggressive_level;     /**< number of levels use aggressive coarsening */
     INT   AMG_aggressive_path;      /**< number of paths for strongly coupled C-set */
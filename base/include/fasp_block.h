@@ -169,6 +169,12 @@ typedef struct {
     //! pointer to the diagonal inverse at level level_num
     dvector diaginv;
 
+    //! lower eigenvalue bound of D^{-1}A for Chebyshev smoother
+    REAL cheby_lmin;
+
+    //! upper eigenvalue bound of D^{-1}A for Chebyshev smoother
+    REAL cheby_lmax;
+
     //! pointer to the matrix at level level_num (csr format)
     dCSRmat Ac;
 
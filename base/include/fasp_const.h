@@ -142,6 +142,7 @@
 #define PREC_FMG     3 /**< with full AMG precond */
 #define PREC_ILU     4 /**< with ILU precond */
 #define PREC_SCHWARZ 5 /**< with Schwarz preconditioner */
+#define PREC_BJILU   6 /**< with thread-domain block-Jacobi ILU precond */
 
 /**
  * \brief Type of ILU methods
@@ -150,6 +151,13 @@
 #define ILUt  2 /**< ILUt */
 #define ILUtp 3 /**< ILUtp */
 
+/**
+ * \brief Type of orderings before ILU factorization
+ */
+#define ILU_ORDER_NONE 0 /**< Natural ordering */
+#define ILU_ORDER_RCM  1 /**< Reverse Cuthill-McKee ordering */
+#define ILU_ORDER_ND   2 /**< Nested dissection ordering */
+
 /**
  * \brief Type of Schwarz smoother
  */
@@ -172,6 +180,7 @@
 #define NPAIR    3 /**< non-symmetric pairwise aggregation */
 #define SPAIR    4 /**< symmetric pairwise aggregation */
 #define VMB_V    5 /**< Vector VMB aggregation */
+#define MIS2     6 /**< distance-2 MIS aggregation */
 
 /**
  * \brief Definition of cycle types
@@ -198,6 +207,10 @@
 #define SMOOTHER_SGSOR   8  /**< SGS + SSOR smoother */
 #define SMOOTHER_POLY    9  /**< Polynomial smoother */
 #define SMOOTHER_L1DIAG  10 /**< L1 norm diagonal scaling smoother */
+#define SMOOTHER_CHEBY   13 /**< Chebyshev polynomial smoother */
+#define SMOOTHER_L1GS    14 /**< Hybrid l1-Gauss-Seidel smoother */
+#define SMOOTHER_L1SGS   15 /**< Hybrid symmetric l1-Gauss-Seidel smoother */
+#define SMOOTHER_BJILU   16 /**< Thread-domain block-Jacobi ILU smoother */
 
 /**
  * \brief Definition of specialized smoother types
@@ -216,6 +229,13 @@
 #define COARSE_AC  4 /**< Aggressive coarsening */
 #define COARSE_MIS 5 /**< Aggressive coarsening based on MIS */
 
+/**
+ * \brief Definition of thread policies on AMG levels
+ */
+#define THREAD_ALL  0 /**< All threads on every level */
+#define THREAD_SIZE 1 /**< Threads proportional to the level size */
+#define THREAD_AUTO 2 /**< Threads calibrated by timing the level SpMV */
+
 /**
  * \brief Definition of interpolation types
  */
@@ -258,6 +278,7 @@
 #define MAX_REFINE_LVL 20    /**< Maximal refinement level */
 #define MAX_AMG_LVL    20    /**< Maximal AMG coarsening level */
 #define MIN_CDOF       20    /**< Minimal number of coarsest variables */
+#define MAX_CDOF_DENSE 2000  /**< Max coarsest size for the built-in dense solver */
 #define MIN_CRATE      0.9   /**< Minimal coarsening ratio */
 #define MAX_CRATE      20.0  /**< Maximal coarsening ratio */
 #define MAX_RESTART    20    /**< Maximal restarting number */
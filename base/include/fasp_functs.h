@@ -221,6 +221,8 @@ FASP_API void fasp_get_start_end (const INT  procid,
 FASP_API void fasp_set_gs_threads (const INT mythreads,
                                    const INT its);
 
+FASP_API void fasp_set_level_threads (const INT nthreads);
+
 
 /*-------- In file: AuxTiming.c --------*/
 
@@ -311,6 +313,24 @@ FASP_API REAL fasp_dcsr_maxeig (const dCSRmat  *A,
                                 const REAL      tol,
                                 const INT       maxit);
 
+FASP_API void fasp_tridiag_extreme_eig (const INT    k,
+                                        const REAL  *d,
+                                        const REAL  *e,
+                                        REAL        *lmin,
+                                        REAL        *lmax);
+
+FASP_API SHORT fasp_dcsr_eig_lanczos (const dCSRmat  *A,
+                                      const REAL     *dinv,
+                                      const INT       k,
+                                      REAL           *lmin,
+                                      REAL           *lmax);
+
+FASP_API SHORT fasp_dbsr_eig_lanczos (const dBSRmat  *A,
+                                      const REAL     *diaginv,
+                                      const INT       k,
+                                      REAL           *lmin,
+                                      REAL           *lmax);
+
 
 /*-------- In file: BlaFormat.c --------*/
 
@@ -387,6 +407,28 @@ FASP_API void fasp_symbfactor (INT   n,
                                INT  *uptr,
                                INT  *ierr);
 
+FASP_API void fasp_iluk_fp (INT    n,
+                            REAL  *a,
+                            INT   *ja,
+                            INT   *ia,
+                            INT    lfil,
+                            INT    nsweeps,
+                            REAL  *alu,
+                            INT   *jlu,
+                            INT    iwk,
+                            INT   *ierr,
+                            INT   *nzlu);
+
+FASP_API void fasp_ilu_fp_sweeps (INT    n,
+                                  REAL  *a,
+                                  INT   *ja,
+                                  INT   *ia,
+                                  REAL  *alu,
+                                  INT   *jlu,
+                                  INT    nsweeps,
+                                  SHORT  warm,
+                                  INT   *ierr);
+
 
 /*-------- In file: BlaILUSetupBSR.c --------*/
 
@@ -429,6 +471,19 @@ FASP_API SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
                                     ILU_data   *iludata,
                                     ILU_param  *iluparam);
 
+FASP_API SHORT fasp_ilu_dcsr_refactor(dCSRmat* A, ILU_data* iludata, const INT nsweeps);
+
+FASP_API SHORT fasp_ilu_dcsr_setup_bj(dCSRmat*   A,
+                                      BJILU_data* bjdata,
+                                      ILU_param* iluparam,
+                                      const INT  nblk);
+
+FASP_API void fasp_ilu_data_split(ILU_data* iludata);
+
+FASP_API void fasp_ilu_dcsr_lsolve(const ILU_data* iludata, REAL* zr, REAL* zz);
+
+FASP_API void fasp_ilu_dcsr_usolve(const ILU_data* iludata, REAL* zz, REAL* z);
+
 
 /*-------- In file: BlaILUSetupSTR.c --------*/
 
@@ -532,6 +587,9 @@ FASP_API void fasp_dcsr_RCMK_order (const dCSRmat *A,
                                     INT           *oindex,
                                     INT           *rorder);
 
+FASP_API void fasp_dcsr_ND_order (const dCSRmat *A,
+                                  INT           *order);
+
 
 /*-------- In file: BlaSchwarzSetup.c --------*/
 
@@ -662,6 +720,16 @@ FASP_API SHORT fasp_smat_lu_solve (const REAL  *A,
                                    REAL         x[],
                                    const INT    n);
 
+FASP_API SHORT fasp_smat_lu_decomp_blk (REAL       *A,
+                                        INT         pivot[],
+                                        const INT   n);
+
+FASP_API void fasp_smat_lu_solve_blk (const REAL  *LU,
+                                      const INT    pivot[],
+                                      const REAL   b[],
+                                      REAL         x[],
+                                      const INT    n);
+
 
 /*-------- In file: BlaSparseBLC.c --------*/
 
@@ -792,12 +860,18 @@ FASP_API void fasp_icsr_trans(const iCSRmat* A, iCSRmat* AT);
 
 FASP_API INT fasp_dcsr_trans(const dCSRmat* A, dCSRmat* AT);
 
+FASP_API void fasp_dcsr_trans_map(const dCSRmat* A, iCSRmat* AT);
+
+FASP_API void fasp_aggmap_trans(const ivector* map, const INT nc, iCSRmat* R);
+
 FASP_API void fasp_dcsr_transpose(INT* row[2], INT* col[2], REAL* val[2], INT* nn, INT* tniz);
 
 FASP_API void fasp_dcsr_compress(const dCSRmat* A, dCSRmat* B, const REAL dtol);
 
 FASP_API SHORT fasp_dcsr_compress_inplace(dCSRmat* A, const REAL dtol);
 
+FASP_API SHORT fasp_dcsr_sparsify(dCSRmat* A, const REAL tol);
+
 FASP_API void fasp_dcsr_shift(dCSRmat* A, const INT offset);
 
 FASP_API void fasp_dcsr_symdiagscale(dCSRmat* A, const dvector* diag);
@@ -819,6 +893,8 @@ FASP_API void dCSRmat_Multicoloring_Strong_Coupled(dCSRmat* A, iCSRmat* S, INT*
 
 FASP_API void dCSRmat_Multicoloring_Theta(dCSRmat* A, REAL theta, INT* rowmax, INT* groups);
 
+FASP_API void fasp_dcsr_multicolor_perm(const dCSRmat* A, dCSRmat* Amc, dvector* dinv);
+
 FASP_API void fasp_smoother_dcsr_gs_multicolor(dvector* u, dCSRmat* A, dvector* b, INT L,
                                                const INT order);
 
@@ -984,6 +1060,48 @@ FASP_API void fasp_sparse_rapcmp_ (INT  *ir,
 
 FASP_API ivector fasp_sparse_mis (dCSRmat *A);
 
+FASP_API void fasp_sparse_mis2 (dCSRmat    *A,
+                                const INT   seed,
+                                INT        *state);
+
+
+/*-------- In file: BlaSpGEMM.c --------*/
+
+FASP_API void fasp_blas_spgemm(const INT   row,
+                               const INT   col,
+                               const INT   mid,
+                               const INT   nb,
+                               const INT*  ir,
+                               const INT*  jr,
+                               const REAL* rj,
+                               const INT*  ia,
+                               const INT*  ja,
+                               const REAL* aj,
+                               const INT*  ip,
+                               const INT*  jp,
+                               const REAL* pj,
+                               const SHORT diag,
+                               INT**       iac,
+                               INT**       jac,
+                               REAL**      acj);
+
+FASP_API void fasp_blas_spgemm_ptap(const INT   row,
+                                    const INT   col,
+                                    const INT   mid,
+                                    const INT*  it,
+                                    const INT*  jt,
+                                    const INT*  map,
+                                    const INT*  ia,
+                                    const INT*  ja,
+                                    const REAL* aj,
+                                    const INT*  ip,
+                                    const INT*  jp,
+                                    const REAL* pj,
+                                    const SHORT diag,
+                                    INT**       iac,
+                                    INT**       jac,
+                                    REAL**      acj);
+
 
 /*-------- In file: BlaSpmvBLC.c --------*/
 
@@ -1059,6 +1177,8 @@ FASP_API void fasp_blas_dcsr_mxv(const dCSRmat* A, const REAL* x, REAL* y);
 
 FASP_API void fasp_blas_dcsr_mxv_agg(const dCSRmat* A, const REAL* x, REAL* y);
 
+FASP_API void fasp_blas_dcsr_mxtv(const dCSRmat* A, const iCSRmat* At, const REAL* x, REAL* y);
+
 FASP_API void fasp_blas_dcsr_aAxpy(const REAL alpha, const dCSRmat* A, const REAL* x, REAL* y);
 
 FASP_API void fasp_blas_ldcsr_aAxpy(const REAL      alpha,
@@ -1071,6 +1191,11 @@ FASP_API void fasp_blas_dcsr_aAxpy_agg(const REAL     alpha,
                                        const REAL*    x,
                                        REAL*          y);
 
+FASP_API void fasp_blas_aggmap_mxtv(const iCSRmat* R, const REAL* x, REAL* y);
+
+FASP_API void fasp_blas_aggmap_aAxpy(const REAL alpha, const ivector* map, const REAL* x,
+                                     REAL* y);
+
 FASP_API REAL fasp_blas_dcsr_vmv(const dCSRmat* A, const REAL* x, const REAL* y);
 
 FASP_API void fasp_blas_dcsr_mxm(const dCSRmat* A, const dCSRmat* B, dCSRmat* C);
@@ -1085,6 +1210,9 @@ FASP_API void fasp_blas_dcsr_rap_agg(const dCSRmat* R,
                                      const dCSRmat* P,
                                      dCSRmat*       RAP);
 
+FASP_API void fasp_blas_dcsr_rap_aggmap(const dCSRmat* A, const ivector* map, const iCSRmat* R,
+                                        dCSRmat* RAP);
+
 FASP_API void fasp_blas_dcsr_rap_agg1(const dCSRmat* R,
                                       const dCSRmat* A,
                                       const dCSRmat* P,
@@ -1095,6 +1223,11 @@ FASP_API void fasp_blas_dcsr_ptap(const dCSRmat* Pt,
                                   const dCSRmat* P,
                                   dCSRmat*       Ac);
 
+FASP_API void fasp_blas_dcsr_ptap_map(const iCSRmat* Pt,
+                                      const dCSRmat* A,
+                                      const dCSRmat* P,
+                                      dCSRmat*       Ac);
+
 FASP_API dCSRmat fasp_blas_dcsr_rap2(INT*  ir,
                                      INT*  jr,
                                      REAL* r,
@@ -1167,6 +1300,9 @@ FASP_API void fasp_smoother_dbsr_jacobi_setup(dBSRmat* A, REAL* diaginv);
 
 FASP_API void fasp_smoother_dbsr_jacobi1(dBSRmat* A, dvector* b, dvector* u, REAL* diaginv);
 
+FASP_API void fasp_smoother_dbsr_cheby(dBSRmat* A, dvector* b, dvector* u, REAL* diaginv,
+                                       const REAL lmin, const REAL lmax, const INT ndeg);
+
 FASP_API void fasp_smoother_dbsr_gs(dBSRmat* A, dvector* b, dvector* u, INT order, INT* mark);
 
 FASP_API void fasp_smoother_dbsr_gs1(
@@ -1180,6 +1316,9 @@ FASP_API void fasp_smoother_dbsr_gs_descend(dBSRmat* A, dvector* b, dvector* u,
 
 FASP_API void fasp_smoother_dbsr_gs_descend1(dBSRmat* A, dvector* b, dvector* u);
 
+FASP_API void fasp_smoother_dbsr_l1gs(dBSRmat* A, dvector* b, dvector* u, REAL* diaginv,
+                                      const INT order);
+
 FASP_API void fasp_smoother_dbsr_gs_order1(
              dBSRmat* A, dvector* b, dvector* u, REAL* diaginv, INT* mark);
 
@@ -1242,6 +1381,18 @@ FASP_API void fasp_smoother_dcsr_gs_ff(dvector* u, dCSRmat* A, dvector* b, INT L
 
 FASP_API void fasp_smoother_dcsr_sgs(dvector* u, dCSRmat* A, dvector* b, INT L);
 
+FASP_API void fasp_smoother_dcsr_l1gs(dvector* u, dCSRmat* A, dvector* b, const INT order, INT L);
+
+FASP_API void fasp_smoother_dcsr_l1sgs(dvector* u, dCSRmat* A, dvector* b, INT L);
+
+FASP_API void fasp_smoother_dcsr_gs_multicolor_perm(dvector*    u,
+                                                    dCSRmat*    Amc,
+                                                    const REAL* dinv,
+                                                    dvector*    b,
+                                                    INT         L,
+                                                    const INT   order,
+                                                    REAL*       work);
+
 FASP_API void fasp_smoother_dcsr_sor(dvector*   u,
                                      const INT  i_1,
                                      const INT  i_n,
@@ -1256,6 +1407,9 @@ FASP_API void fasp_smoother_dcsr_sor_cf(
 
 FASP_API void fasp_smoother_dcsr_ilu(dCSRmat* A, dvector* b, dvector* x, void* data);
 
+FASP_API void fasp_smoother_dcsr_bjilu(dvector* u, dCSRmat* A, dvector* b, BJILU_data* bjdata,
+                                       INT L);
+
 FASP_API void fasp_smoother_dcsr_kaczmarz(dvector*   u,
                                           const INT  i_1,
                                           const INT  i_n,
@@ -1303,6 +1457,15 @@ FASP_API void fasp_smoother_dcsr_poly_old (dCSRmat *Amat,
                                            INT      ndeg,
                                            INT      L);
 
+FASP_API void fasp_smoother_dcsr_cheby (dvector     *u,
+                                        dCSRmat     *A,
+                                        dvector     *b,
+                                        const REAL  *dinv,
+                                        const REAL   lmin,
+                                        const REAL   lmax,
+                                        INT          ndeg,
+                                        INT          L);
+
 
 /*-------- In file: ItrSmootherSTR.c --------*/
 
@@ -1436,6 +1599,11 @@ FASP_API INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* p
                                   const REAL tol, const REAL abstol, const INT MaxIt,
                                   const SHORT StopType, const SHORT PrtLvl);
 
+FASP_API INT fasp_solver_dcsr_pcg_eig(dCSRmat* A, dvector* b, dvector* u, precond* pc,
+                                      const REAL tol, const REAL abstol, const INT MaxIt,
+                                      const SHORT StopType, const SHORT PrtLvl, REAL* lmin,
+                                      REAL* lmax);
+
 FASP_API INT fasp_solver_dbsr_pcg(dBSRmat* A, dvector* b, dvector* u, precond* pc,
                                   const REAL tol, const REAL abstol, const INT MaxIt,
                                   const SHORT StopType, const SHORT PrtLvl);
@@ -1915,6 +2083,10 @@ FASP_API void fasp_precond_ilu_backward (REAL *r,
                                          REAL *z, 
                                          void *data);
 
+FASP_API void fasp_precond_bjilu (REAL *r,
+                                  REAL *z,
+                                  void *data);
+
 FASP_API void fasp_precond_swz (REAL *r,
                                 REAL *z,
                                 void *data);
@@ -1950,14 +2122,36 @@ FASP_API void fasp_amg_data_free(AMG_data* mgl, AMG_param* param);
 
 FASP_API void fasp_amg_data_free1(AMG_data* mgl, AMG_param* param);
 
+FASP_API INT fasp_amg_coarse_dof(const dCSRmat* A, const AMG_param* param);
+
+FASP_API SHORT fasp_amg_coarse_dense_setup(AMG_data* mgc, const SHORT prtlvl);
+
+FASP_API void fasp_amg_coarse_sparsify(dCSRmat* Ac, const INT lvl, const AMG_param* param);
+
+FASP_API SHORT fasp_amg_budget_check(AMG_data* mgl, const INT lvl, AMG_param* param);
+
+FASP_API void fasp_amg_budget_reset(AMG_param* param, const AMG_param* param0);
+
+FASP_API void fasp_amg_level_threads(AMG_data* mgl, const AMG_param* param);
+
+FASP_API void fasp_amg_cheby_setup(AMG_data* mgl, const AMG_param* param);
+
+FASP_API void fasp_amg_bjilu_setup(AMG_data* mgl, const AMG_param* param);
+
+FASP_API void fasp_amg_multicolor_setup(AMG_data* mgl);
+
 FASP_API AMG_data_bsr* fasp_amg_data_bsr_create(SHORT max_levels);
 
 FASP_API void fasp_amg_data_bsr_free(AMG_data_bsr* mgl, AMG_param* param);
 
+FASP_API void fasp_amg_cheby_setup_bsr(AMG_data_bsr* mgl, const AMG_param* param);
+
 FASP_API void fasp_ilu_data_create(const INT iwk, const INT nwork, ILU_data* iludata);
 
 FASP_API void fasp_ilu_data_free(ILU_data* iludata);
 
+FASP_API void fasp_bjilu_data_free(BJILU_data* bjdata);
+
 FASP_API void fasp_swz_data_free(SWZ_data* swzdata);
 
 
@@ -1987,6 +2181,8 @@ FASP_API void fasp_amg_amli_coef(const REAL lambda_max,
                                  const INT  degree,
                                  REAL*      coef);
 
+FASP_API void fasp_amg_amli_coef_setup(AMG_data* mgl, AMG_param* param);
+
 
 /*-------- In file: PreMGRecur.c --------*/
 
@@ -2126,6 +2322,9 @@ FASP_API INT fasp_solver_dcsr_krylov_amg(dCSRmat* A, dvector* b, dvector* x, ITS
 FASP_API INT fasp_solver_dcsr_krylov_ilu(dCSRmat* A, dvector* b, dvector* x, ITS_param* itparam,
                                          ILU_param* iluparam);
 
+FASP_API INT fasp_solver_dcsr_krylov_bjilu(dCSRmat* A, dvector* b, dvector* x,
+                                           ITS_param* itparam, ILU_param* iluparam);
+
 FASP_API INT fasp_solver_dcsr_krylov_ilu_M(dCSRmat* A, dvector* b, dvector* x,
                                            ITS_param* itparam, ILU_param* iluparam, dCSRmat* M);
 
@@ -41,7 +41,10 @@ SHORT fasp_param_check(input_param* inparam)
         inparam->stop_type <= 0 || inparam->stop_type > 3 || inparam->restart < 0 ||
         inparam->ILU_type <= 0 || inparam->ILU_type > 3 || inparam->ILU_lfil < 0 ||
         inparam->ILU_droptol <= 0 || inparam->ILU_relax < 0 ||
-        inparam->ILU_permtol < 0 || inparam->SWZ_mmsize < 0 ||
+        inparam->ILU_permtol < 0 || inparam->ILU_jacobi_sweeps < 0 ||
+        inparam->ILU_fp_sweeps < 0 || inparam->ILU_reorder < 0 ||
+        inparam->ILU_reorder > 2 || inparam->ILU_split < 0 ||
+        inparam->ILU_split > 1 || inparam->SWZ_mmsize < 0 ||
         inparam->SWZ_maxlvl < 0 || inparam->SWZ_type < 0 ||
         inparam->SWZ_blksolver < 0 || inparam->AMG_type <= 0 || inparam->AMG_type > 3 ||
         inparam->AMG_cycle_type <= 0 || inparam->AMG_levels < 0 ||
@@ -49,18 +52,25 @@ SHORT fasp_param_check(input_param* inparam)
         inparam->AMG_tol < 0 || inparam->AMG_maxit < 0 ||
         inparam->AMG_coarsening_type <= 0 || inparam->AMG_coarsening_type > 4 ||
         inparam->AMG_coarse_solver < 0 || inparam->AMG_interpolation_type < 0 ||
-        inparam->AMG_interpolation_type > 5 || inparam->AMG_smoother < 0 ||
+        inparam->AMG_interpolation_type > 6 || inparam->AMG_smoother < 0 ||
         inparam->AMG_smoother > 30 || inparam->AMG_strong_threshold < 0.0 ||
         inparam->AMG_strong_threshold > 0.9999 ||
         inparam->AMG_truncation_threshold < 0.0 ||
-        inparam->AMG_truncation_threshold > 0.9999 || inparam->AMG_max_row_sum < 0.0 ||
+        inparam->AMG_truncation_threshold > 0.9999 ||
+        inparam->AMG_truncation_max_nnz < 0 || inparam->AMG_max_row_sum < 0.0 ||
         inparam->AMG_presmooth_iter < 0 || inparam->AMG_postsmooth_iter < 0 ||
         inparam->AMG_amli_degree < 0 || inparam->AMG_aggressive_level < 0 ||
         inparam->AMG_aggressive_path < 0 || inparam->AMG_aggregation_type < 0 ||
         inparam->AMG_pair_number < 0 || inparam->AMG_strong_coupled < 0 ||
         inparam->AMG_max_aggregation <= 0 || inparam->AMG_tentative_smooth < 0 ||
         inparam->AMG_smooth_filter < 0 || inparam->AMG_smooth_restriction < 0 ||
-        inparam->AMG_smooth_restriction > 1)
+        inparam->AMG_smooth_restriction > 1 || inparam->AMG_sparsify_tol < 0.0 ||
+        inparam->AMG_sparsify_tol > 0.9999 || inparam->AMG_sparsify_level < 1 ||
+        inparam->AMG_max_grid_complexity < 0.0 ||
+        inparam->AMG_max_operator_complexity < 0.0 || inparam->AMG_max_memory < 0.0 ||
+        inparam->AMG_thread_policy < THREAD_ALL ||
+        inparam->AMG_thread_policy > THREAD_AUTO || inparam->AMG_cheby_ratio <= 0.0 ||
+        inparam->AMG_cheby_ratio >= 1.0)
         status = ERROR_INPUT_PAR;
 
     return status;
@@ -515,6 +525,130 @@ void fasp_param_input(const char* fname, input_param* inparam)
             };
         }
 
+        else if (strcmp(buffer, "AMG_implicit_restriction") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+
+            if ((strcmp(buffer, "ON") == 0) || (strcmp(buffer, "on") == 0) ||
+                (strcmp(buffer, "On") == 0) || (strcmp(buffer, "oN") == 0)) {
+                inparam->AMG_implicit_restriction = ON;
+            } else if ((strcmp(buffer, "OFF") == 0) || (strcmp(buffer, "off") == 0) ||
+                       (strcmp(buffer, "ofF") == 0) || (strcmp(buffer, "oFf") == 0) ||
+                       (strcmp(buffer, "Off") == 0) || (strcmp(buffer, "oFF") == 0) ||
+                       (strcmp(buffer, "OfF") == 0) || (strcmp(buffer, "OFf") == 0)) {
+                inparam->AMG_implicit_restriction = OFF;
+            } else {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "AMG_sparsify_tol") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%lf", &dbuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_sparsify_tol = dbuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "AMG_sparsify_level") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_sparsify_level = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "AMG_max_grid_complexity") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%lf", &dbuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_max_grid_complexity = dbuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "AMG_max_operator_complexity") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%lf", &dbuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_max_operator_complexity = dbuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "AMG_max_memory") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%lf", &dbuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_max_memory = dbuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "AMG_thread_policy") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_thread_policy = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
         else if (strcmp(buffer, "AMG_levels") == 0) {
             val = fscanf(fp, "%s", buffer);
             if (val != 1 || strcmp(buffer, "=") != 0) {
@@ -649,6 +783,14 @@ void fasp_param_input(const char* fname, input_param* inparam)
                 inparam->AMG_smoother = SMOOTHER_POLY;
             else if ((strcmp(buffer, "L1DIAG") == 0) || (strcmp(buffer, "l1diag") == 0))
                 inparam->AMG_smoother = SMOOTHER_L1DIAG;
+            else if ((strcmp(buffer, "CHEBY") == 0) || (strcmp(buffer, "cheby") == 0))
+                inparam->AMG_smoother = SMOOTHER_CHEBY;
+            else if ((strcmp(buffer, "L1GS") == 0) || (strcmp(buffer, "l1gs") == 0))
+                inparam->AMG_smoother = SMOOTHER_L1GS;
+            else if ((strcmp(buffer, "L1SGS") == 0) || (strcmp(buffer, "l1sgs") == 0))
+                inparam->AMG_smoother = SMOOTHER_L1SGS;
+            else if ((strcmp(buffer, "BJILU") == 0) || (strcmp(buffer, "bjilu") == 0))
+                inparam->AMG_smoother = SMOOTHER_BJILU;
             else if ((strcmp(buffer, "BLKOIL") == 0) || (strcmp(buffer, "blkoil") == 0))
                 inparam->AMG_smoother = SMOOTHER_BLKOIL;
             else if ((strcmp(buffer, "SPETEN") == 0) || (strcmp(buffer, "speten") == 0))
@@ -881,6 +1023,22 @@ void fasp_param_input(const char* fname, input_param* inparam)
             };
         }
 
+        else if (strcmp(buffer, "AMG_cheby_ratio") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%lf", &dbuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_cheby_ratio = dbuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
         else if (strcmp(buffer, "AMG_strong_threshold") == 0) {
             val = fscanf(fp, "%s", buffer);
             if (val != 1 || strcmp(buffer, "=") != 0) {
@@ -913,6 +1071,22 @@ void fasp_param_input(const char* fname, input_param* inparam)
             };
         }
 
+        else if (strcmp(buffer, "AMG_truncation_max_nnz") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->AMG_truncation_max_nnz = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
         else if (strcmp(buffer, "AMG_max_row_sum") == 0) {
             val = fscanf(fp, "%s", buffer);
             if (val != 1 || strcmp(buffer, "=") != 0) {
@@ -1041,6 +1215,70 @@ void fasp_param_input(const char* fname, input_param* inparam)
             };
         }
 
+        else if (strcmp(buffer, "ILU_jacobi_sweeps") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->ILU_jacobi_sweeps = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "ILU_fp_sweeps") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->ILU_fp_sweeps = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "ILU_reorder") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->ILU_reorder = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
+        else if (strcmp(buffer, "ILU_split") == 0) {
+            val = fscanf(fp, "%s", buffer);
+            if (val != 1 || strcmp(buffer, "=") != 0) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            val = fscanf(fp, "%d", &ibuff);
+            if (val != 1) {
+                status = ERROR_INPUT_PAR;
+                break;
+            }
+            inparam->ILU_split = ibuff;
+            if (fscanf(fp, "%*[^\n]")) { /* skip rest of line and do nothing */
+            };
+        }
+
         else if (strcmp(buffer, "SWZ_mmsize") == 0) {
             val = fscanf(fp, "%s", buffer);
             if (val != 1 || strcmp(buffer, "=") != 0) {
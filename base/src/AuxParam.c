@@ -371,6 +371,10 @@ void fasp_param_input_init(input_param* iniparam)
     iniparam->ILU_droptol = 0.001;
     iniparam->ILU_relax   = 0;
     iniparam->ILU_permtol = 0.0;
+    iniparam->ILU_jacobi_sweeps = 0;
+    iniparam->ILU_fp_sweeps     = 0;
+    iniparam->ILU_reorder       = ILU_ORDER_NONE;
+    iniparam->ILU_split         = 0;
 
     // Schwarz method parameters
     iniparam->SWZ_mmsize    = 200;
@@ -387,6 +391,7 @@ void fasp_param_input_init(input_param* iniparam)
     iniparam->AMG_presmooth_iter      = 1;
     iniparam->AMG_postsmooth_iter     = 1;
     iniparam->AMG_relaxation          = 1.0;
+    iniparam->AMG_cheby_ratio         = 1.0 / 30.0;
     iniparam->AMG_coarse_dof          = 500;
     iniparam->AMG_coarse_solver       = 0;
     iniparam->AMG_tol                 = 1e-6;
@@ -394,6 +399,13 @@ void fasp_param_input_init(input_param* iniparam)
     iniparam->AMG_ILU_levels          = 0;
     iniparam->AMG_SWZ_levels          = 0;
     iniparam->AMG_coarse_scaling      = OFF; // Require investigation --Chensong
+    iniparam->AMG_implicit_restriction = OFF;
+    iniparam->AMG_sparsify_tol        = 0.0;
+    iniparam->AMG_sparsify_level      = 1;
+    iniparam->AMG_max_grid_complexity = 0.0;
+    iniparam->AMG_max_operator_complexity = 0.0;
+    iniparam->AMG_max_memory          = 0.0;
+    iniparam->AMG_thread_policy       = THREAD_ALL;
     iniparam->AMG_amli_degree         = 1;
     iniparam->AMG_nl_amli_krylov_type = 2;
 
@@ -403,6 +415,7 @@ void fasp_param_input_init(input_param* iniparam)
     iniparam->AMG_max_row_sum          = 0.9;
     iniparam->AMG_strong_threshold     = 0.3;
     iniparam->AMG_truncation_threshold = 0.2;
+    iniparam->AMG_truncation_max_nnz   = 0;
     iniparam->AMG_aggressive_level     = 0;
     iniparam->AMG_aggressive_path      = 1;
 
@@ -445,7 +458,15 @@ void fasp_param_amg_init(AMG_param* amgparam)
     amgparam->coarse_solver       = SOLVER_DEFAULT;
     amgparam->relaxation          = 1.0;
     amgparam->polynomial_degree   = 3;
+    amgparam->cheby_ratio         = 1.0 / 30.0;
     amgparam->coarse_scaling      = OFF;
+    amgparam->implicit_restriction = OFF;
+    amgparam->sparsify_tol        = 0.0;
+    amgparam->sparsify_level      = 1;
+    amgparam->max_grid_complexity = 0.0;
+    amgparam->max_operator_complexity = 0.0;
+    amgparam->max_memory          = 0.0;
+    amgparam->thread_policy       = THREAD_ALL;
     amgparam->amli_degree         = 2;
     amgparam->amli_coef           = NULL;
     amgparam->nl_amli_krylov_type = SOLVER_GCG;
@@ -456,6 +477,7 @@ void fasp_param_amg_init(AMG_param* amgparam)
     amgparam->max_row_sum          = 0.9;
     amgparam->strong_threshold     = 0.3;
     amgparam->truncation_threshold = 0.2;
+    amgparam->truncation_max_nnz   = 0;
     amgparam->aggressive_level     = 0;
     amgparam->aggressive_path      = 1;
 
@@ -516,7 +538,15 @@ void fasp_param_amg_copy(AMG_param* amgparam_src, AMG_param* amgparam_dest)
     amgparam_dest->coarse_solver       = amgparam_src->coarse_solver;
     amgparam_dest->relaxation          = amgparam_src->relaxation;
     amgparam_dest->polynomial_degree   = amgparam_src->polynomial_degree;
+    amgparam_dest->cheby_ratio         = amgparam_src->cheby_ratio;
     amgparam_dest->coarse_scaling      = amgparam_src->coarse_scaling;
+    amgparam_dest->implicit_restriction = amgparam_src->implicit_restriction;
+    amgparam_dest->sparsify_tol        = amgparam_src->sparsify_tol;
+    amgparam_dest->sparsify_level      = amgparam_src->sparsify_level;
+    amgparam_dest->max_grid_complexity = amgparam_src->max_grid_complexity;
+    amgparam_dest->max_operator_complexity = amgparam_src->max_operator_complexity;
+    amgparam_dest->max_memory          = amgparam_src->max_memory;
+    amgparam_dest->thread_policy       = amgparam_src->thread_policy;
     amgparam_dest->amli_degree         = amgparam_src->amli_degree;
     amgparam_dest->amli_coef           = amgparam_src->amli_coef;
     amgparam_dest->nl_amli_krylov_type = amgparam_src->nl_amli_krylov_type;
@@ -527,6 +557,7 @@ void fasp_param_amg_copy(AMG_param* amgparam_src, AMG_param* amgparam_dest)
     amgparam_dest->max_row_sum          = amgparam_src->max_row_sum;
     amgparam_dest->strong_threshold     = amgparam_src->strong_threshold;
     amgparam_dest->truncation_threshold = amgparam_src->truncation_threshold;
+    amgparam_dest->truncation_max_nnz   = amgparam_src->truncation_max_nnz;
     amgparam_dest->aggressive_level     = amgparam_src->aggressive_level;
     amgparam_dest->aggressive_path      = amgparam_src->aggressive_path;
 
@@ -600,6 +631,10 @@ void fasp_param_ilu_init(ILU_param* iluparam)
     iluparam->ILU_droptol = 0.001;
     iluparam->ILU_relax   = 0;
     iluparam->ILU_permtol = 0.01;
+    iluparam->ILU_jacobi_sweeps = 0;
+    iluparam->ILU_fp_sweeps     = 0;
+    iluparam->ILU_reorder       = ILU_ORDER_NONE;
+    iluparam->ILU_split         = 0;
 }
 
 /**
@@ -657,10 +692,18 @@ void fasp_param_amg_set(AMG_param* param, const input_param* iniparam)
     param->relaxation          = iniparam->AMG_relaxation;
     param->coarse_solver       = iniparam->AMG_coarse_solver;
     param->polynomial_degree   = iniparam->AMG_polynomial_degree;
+    param->cheby_ratio         = iniparam->AMG_cheby_ratio;
     param->presmooth_iter      = iniparam->AMG_presmooth_iter;
     param->postsmooth_iter     = iniparam->AMG_postsmooth_iter;
     param->coarse_dof          = iniparam->AMG_coarse_dof;
     param->coarse_scaling      = iniparam->AMG_coarse_scaling;
+    param->implicit_restriction = iniparam->AMG_implicit_restriction;
+    param->sparsify_tol        = iniparam->AMG_sparsify_tol;
+    param->sparsify_level      = iniparam->AMG_sparsify_level;
+    param->max_grid_complexity = iniparam->AMG_max_grid_complexity;
+    param->max_operator_complexity = iniparam->AMG_max_operator_complexity;
+    param->max_memory          = iniparam->AMG_max_memory;
+    param->thread_policy       = iniparam->AMG_thread_policy;
     param->amli_degree         = iniparam->AMG_amli_degree;
     param->amli_coef           = NULL;
     param->nl_amli_krylov_type = iniparam->AMG_nl_amli_krylov_type;
@@ -669,6 +712,7 @@ void fasp_param_amg_set(AMG_param* param, const input_param* iniparam)
     param->interpolation_type   = iniparam->AMG_interpolation_type;
     param->strong_threshold     = iniparam->AMG_strong_threshold;
     param->truncation_threshold = iniparam->AMG_truncation_threshold;
+    param->truncation_max_nnz   = iniparam->AMG_truncation_max_nnz;
     param->max_row_sum          = iniparam->AMG_max_row_sum;
     param->aggressive_level     = iniparam->AMG_aggressive_level;
     param->aggressive_path      = iniparam->AMG_aggressive_path;
@@ -715,6 +759,10 @@ void fasp_param_ilu_set(ILU_param* iluparam, const input_param* iniparam)
     iluparam->ILU_droptol = iniparam->ILU_droptol;
     iluparam->ILU_relax   = iniparam->ILU_relax;
     iluparam->ILU_permtol = iniparam->ILU_permtol;
+    iluparam->ILU_jacobi_sweeps = iniparam->ILU_jacobi_sweeps;
+    iluparam->ILU_fp_sweeps     = iniparam->ILU_fp_sweeps;
+    iluparam->ILU_reorder       = iniparam->ILU_reorder;
+    iluparam->ILU_split         = iniparam->ILU_split;
 }
 
 /**
@@ -924,6 +972,22 @@ void fasp_param_amg_print(const AMG_param* param)
         printf("AMG cycle type:                    %d\n", param->cycle_type);
         printf("AMG coarse solver type:            %d\n", param->coarse_solver);
         printf("AMG scaling of coarse correction:  %d\n", param->coarse_scaling);
+        printf("AMG implicit restriction:          %d\n",
+               param->implicit_restriction);
+        if (param->sparsify_tol > 0.0) {
+            printf("AMG sparsification tolerance:      %.2e\n", param->sparsify_tol);
+            printf("AMG sparsification from level:     %d\n", param->sparsify_level);
+        }
+        if (param->max_grid_complexity > 0.0)
+            printf("AMG grid complexity budget:        %.3f\n",
+                   param->max_grid_complexity);
+        if (param->max_operator_complexity > 0.0)
+            printf("AMG operator complexity budget:    %.3f\n",
+                   param->max_operator_complexity);
+        if (param->max_memory > 0.0)
+            printf("AMG memory budget (MB):            %.1f\n", param->max_memory);
+        if (param->thread_policy != THREAD_ALL)
+            printf("AMG thread policy on levels:       %d\n", param->thread_policy);
         printf("AMG smoother type:                 %d\n", param->smoother);
         printf("AMG smoother order:                %d\n", param->smooth_order);
         printf("AMG num of presmoothing:           %d\n", param->presmooth_iter);
@@ -938,6 +1002,11 @@ void fasp_param_amg_print(const AMG_param* param)
             printf("AMG polynomial smoother degree:    %d\n", param->polynomial_degree);
         }
 
+        if (param->smoother == SMOOTHER_CHEBY) {
+            printf("AMG Chebyshev smoother degree:     %d\n", param->polynomial_degree);
+            printf("AMG Chebyshev eigenvalue ratio:    %.4f\n", param->cheby_ratio);
+        }
+
         if (param->cycle_type == AMLI_CYCLE) {
             printf("AMG AMLI degree of polynomial:     %d\n", param->amli_degree);
         }
@@ -958,6 +1027,8 @@ void fasp_param_amg_print(const AMG_param* param)
                        param->strong_threshold);
                 printf("AMG truncation threshold:          %.4f\n",
                        param->truncation_threshold);
+                printf("AMG truncation max nnz per row:    %d\n",
+                       param->truncation_max_nnz);
                 printf("AMG max row sum:                   %.4f\n", param->max_row_sum);
                 printf("AMG aggressive levels:             %d\n",
                        param->aggressive_level);
@@ -1033,6 +1104,10 @@ void fasp_param_ilu_print(const ILU_param* param)
         printf("ILU relaxation factor:             %.4f\n", param->ILU_relax);
         printf("ILU drop tolerance:                %.2e\n", param->ILU_droptol);
         printf("ILU permutation tolerance:         %.2e\n", param->ILU_permtol);
+        printf("ILU Jacobi sweeps for solves:      %d\n", param->ILU_jacobi_sweeps);
+        printf("ILU fixed-point sweeps for setup:  %d\n", param->ILU_fp_sweeps);
+        printf("ILU reordering type:               %d\n", param->ILU_reorder);
+        printf("ILU split copy of factors:         %d\n", param->ILU_split);
         printf("-----------------------------------------------\n\n");
 
     } else {
@@ -28,6 +28,11 @@
 
 INT thread_ini_flag = 0;
 
+static INT thread_max_num = 1; /**< number of threads available */
+static INT thread_lvl_num = 0; /**< number of threads on current level, 0 for all */
+static INT thread_usr_num = 0; /**< caller's max threads before the level setting */
+#pragma omp threadprivate(thread_lvl_num, thread_usr_num)
+
 /**
  * \fn     INT fasp_get_num_threads ( void )
  *
@@ -37,21 +42,28 @@ INT thread_ini_flag = 0;
  *
  * \author Chunsheng Feng, Xiaoqiang Yue and Zheng Li
  * \date   June/15/2012
+ *
+ * Modified by agent on 10/18/2026: follow fasp_set_level_threads and return 1
+ *                                  inside an active parallel region
  */
 INT fasp_get_num_threads ( void )
 {
-    static INT nthreads;
-    
     if ( thread_ini_flag == 0 ) {
-        nthreads = 1;
+        thread_max_num = 1;
 #pragma omp parallel
-        nthreads = omp_get_num_threads();
+        thread_max_num = omp_get_num_threads();
         
-        printf("\nFASP is running on %d thread(s).\n\n", nthreads);
+        printf("\nFASP is running on %d thread(s).\n\n", thread_max_num);
         thread_ini_flag = 1;
     }
     
-    return nthreads;
+    // a parallel region opened inside an active one runs on one thread
+    if ( omp_get_active_level() > 0 &&
+         omp_get_active_level() >= omp_get_max_active_levels() ) return 1;
+    
+    if ( thread_lvl_num > 0 ) return thread_lvl_num;
+    
+    return thread_max_num;
 }
 
 /**
@@ -174,6 +186,43 @@ void fasp_set_gs_threads (const INT mythreads,
 #endif // _OPENMP
 }
 
+/**
+ * \fn void fasp_set_level_threads (const INT nthreads)
+ *
+ * \brief  Set the number of threads for the kernels on the current AMG level
+ *
+ * \param nthreads  Number of threads (0 or more than available: all threads)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Both the OpenMP parallel regions and fasp_get_num_threads follow this
+ *       number, so kernels that partition their work by fasp_get_num_threads
+ *       stay consistent with the size of the thread team. The setting is kept
+ *       per calling thread, like the nthreads-var ICV it changes, and going
+ *       back to 0 restores the caller's omp_get_max_threads() from before the
+ *       first level setting.
+ */
+void fasp_set_level_threads (const INT nthreads)
+{
+#ifdef _OPENMP
+    
+    INT nt, usr;
+    
+    if ( thread_ini_flag == 0 ) fasp_get_num_threads();
+    
+    usr = ( thread_lvl_num > 0 ) ? thread_usr_num : omp_get_max_threads();
+    nt  = ( nthreads > 0 && nthreads < usr ) ? nthreads : 0;
+    
+    if ( nt == thread_lvl_num ) return;
+    
+    if ( thread_lvl_num == 0 ) thread_usr_num = usr;
+    thread_lvl_num = nt;
+    omp_set_num_threads( nt > 0 ? nt : thread_usr_num );
+    
+#endif // _OPENMP
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
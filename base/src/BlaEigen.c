@@ -3,7 +3,8 @@
  *  \brief Computing the extreme eigenvalues
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
- *         AuxVector.c, BlaArray.c, BlaSpmvCSR.c, and BlaVector.c
+ *         AuxMemory.c, AuxVector.c, BlaArray.c, BlaSmallMat.c, BlaSpmvBSR.c,
+ *         BlaSpmvCSR.c, and BlaVector.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
@@ -16,6 +17,18 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static INT   tridiag_count (const INT, const REAL *, const REAL *, const REAL);
+static void  lanczos_mxv_dcsr (const void *, const REAL *, REAL *);
+static void  lanczos_mxv_dbsr (const void *, const REAL *, REAL *);
+static void  lanczos_dinv (const INT, const INT, const REAL *, const REAL *, REAL *);
+static SHORT lanczos (const INT, const INT, void (*)(const void *, const REAL *, REAL *),
+                      const void *, void (*)(const INT, const INT, const REAL *,
+                      const REAL *, REAL *), const REAL *, const INT, REAL *, REAL *);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -33,37 +46,38 @@
  *
  * \author Xiaozhe Hu
  * \date   01/25/2011
+ *
+ * Modified by agent on 10/18/2026: reuse Ax for the Rayleigh quotient
  */
 REAL fasp_dcsr_maxeig (const dCSRmat  *A,
                        const REAL      tol,
                        const INT       maxit)
 {
+    const INT n = A->row;
     REAL eigenvalue = 0.0, temp = 1.0, L2_norm_y;
     dvector x, y;
     int i;
 
-    fasp_dvec_alloc(A->row, &x);
-    fasp_dvec_rand(A->row,&x);
-    fasp_blas_darray_ax(A->row, 1.0/fasp_blas_dvec_norm2(&x), x.val);
+    fasp_dvec_alloc(n, &x);
+    fasp_dvec_rand(n, &x);
+    fasp_blas_darray_ax(n, 1.0/fasp_blas_dvec_norm2(&x), x.val);
     
-    fasp_dvec_alloc(A->row, &y);
+    fasp_dvec_alloc(n, &y);
     
     for ( i = maxit; i--; ) {
         // y = Ax;
         fasp_blas_dcsr_mxv(A, x.val, y.val);
         
-        // y/||y||
-        L2_norm_y = fasp_blas_dvec_norm2(&y);
-        fasp_blas_darray_ax(A->row, 1.0/L2_norm_y, y.val);
-        
-        // eigenvalue = y'Ay;
-        eigenvalue = fasp_blas_dcsr_vmv(A, y.val, y.val);
+        // eigenvalue = x'Ax with ||x|| = 1
+        eigenvalue = fasp_blas_darray_dotprod(n, x.val, y.val);
         
         // convergence test
         if ( (ABS(eigenvalue - temp)/ABS(temp)) < tol ) break;
-        
-        fasp_dvec_cp(&y, &x);
         temp = eigenvalue;
+        
+        // x = y/||y||
+        L2_norm_y = fasp_blas_dvec_norm2(&y);
+        fasp_blas_darray_axpby(n, 1.0/L2_norm_y, y.val, 0.0, x.val);
     }
     
     // clean up memory
@@ -73,6 +87,302 @@ REAL fasp_dcsr_maxeig (const dCSRmat  *A,
     return eigenvalue;
 }
 
+/**
+ * \fn void fasp_tridiag_extreme_eig (const INT k, const REAL *d, const REAL *e,
+ *                                    REAL *lmin, REAL *lmax)
+ *
+ * \brief Extreme eigenvalues of a symmetric tridiagonal matrix by bisection
+ *
+ * \param k     Size of the tridiagonal matrix
+ * \param d     Diagonal entries d[0], ..., d[k-1]
+ * \param e     Off-diagonal entries e[0], ..., e[k-2], e[i] couples i and i+1
+ * \param lmin  Smallest eigenvalue (OUT)
+ * \param lmax  Largest eigenvalue (OUT)
+ *
+ * \note Sturm sequence counts on the Gershgorin interval; k is the number of
+ *       Lanczos or CG steps and is small.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_tridiag_extreme_eig (const INT    k,
+                               const REAL  *d,
+                               const REAL  *e,
+                               REAL        *lmin,
+                               REAL        *lmax)
+{
+    REAL lo = BIGREAL, hi = -BIGREAL, r, a, b, x;
+    INT  i, it;
+
+    *lmin = *lmax = 0.0;
+    if ( k <= 0 ) return;
+
+    // Gershgorin interval
+    for ( i = 0; i < k; ++i ) {
+        r = (i > 0 ? ABS(e[i-1]) : 0.0) + (i < k-1 ? ABS(e[i]) : 0.0);
+        lo = MIN(lo, d[i] - r);
+        hi = MAX(hi, d[i] + r);
+    }
+
+    // smallest: the first x with at least one eigenvalue below it
+    a = lo; b = hi;
+    for ( it = 0; it < 100 && b - a > 1e-12 * MAX(ABS(a), ABS(b)); ++it ) {
+        x = 0.5 * (a + b);
+        if ( tridiag_count(k, d, e, x) >= 1 ) b = x; else a = x;
+    }
+    *lmin = 0.5 * (a + b);
+
+    // largest: the first x with all eigenvalues below it
+    a = lo; b = hi;
+    for ( it = 0; it < 100 && b - a > 1e-12 * MAX(ABS(a), ABS(b)); ++it ) {
+        x = 0.5 * (a + b);
+        if ( tridiag_count(k, d, e, x) >= k ) b = x; else a = x;
+    }
+    *lmax = 0.5 * (a + b);
+}
+
+/**
+ * \fn SHORT fasp_dcsr_eig_lanczos (const dCSRmat *A, const REAL *dinv,
+ *                                  const INT k, REAL *lmin, REAL *lmax)
+ *
+ * \brief Estimate the extreme eigenvalues of A or D^{-1}A by k Lanczos steps
+ *
+ * \param A      Pointer to the dCSRmat matrix, assumed SPD
+ * \param dinv   Inverse of the diagonal of A; NULL for A itself
+ * \param k      Number of Lanczos steps
+ * \param lmin   Smallest Ritz value (OUT)
+ * \param lmax   Largest Ritz value (OUT)
+ *
+ * \return       FASP_SUCCESS if succeeded; ERROR_SOLVER_MISC if A or D is not SPD
+ *
+ * \note Ritz values lie inside the spectrum, so lmax is an underestimate and
+ *       lmin an overestimate; callers add their own safety margin. Each step
+ *       costs one SpMV and two inner products.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+SHORT fasp_dcsr_eig_lanczos (const dCSRmat  *A,
+                             const REAL     *dinv,
+                             const INT       k,
+                             REAL           *lmin,
+                             REAL           *lmax)
+{
+    return lanczos(A->row, k, lanczos_mxv_dcsr, A, dinv == NULL ? NULL : lanczos_dinv,
+                   dinv, 1, lmin, lmax);
+}
+
+/**
+ * \fn SHORT fasp_dbsr_eig_lanczos (const dBSRmat *A, const REAL *diaginv,
+ *                                  const INT k, REAL *lmin, REAL *lmax)
+ *
+ * \brief Estimate the extreme eigenvalues of A or D^{-1}A by k Lanczos steps,
+ *        where D is the block diagonal of A
+ *
+ * \param A        Pointer to the dBSRmat matrix, assumed SPD
+ * \param diaginv  Inverses of the diagonal blocks of A; NULL for A itself
+ * \param k        Number of Lanczos steps
+ * \param lmin     Smallest Ritz value (OUT)
+ * \param lmax     Largest Ritz value (OUT)
+ *
+ * \return         FASP_SUCCESS if succeeded; ERROR_SOLVER_MISC if A or D is not SPD
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+SHORT fasp_dbsr_eig_lanczos (const dBSRmat  *A,
+                             const REAL     *diaginv,
+                             const INT       k,
+                             REAL           *lmin,
+                             REAL           *lmax)
+{
+    return lanczos(A->ROW * A->nb, k, lanczos_mxv_dbsr, A,
+                   diaginv == NULL ? NULL : lanczos_dinv, diaginv, A->nb, lmin, lmax);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static INT tridiag_count (const INT k, const REAL *d, const REAL *e,
+ *                               const REAL x)
+ *
+ * \brief Number of eigenvalues of the tridiagonal matrix (d, e) less than x
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT tridiag_count (const INT    k,
+                          const REAL  *d,
+                          const REAL  *e,
+                          const REAL   x)
+{
+    REAL q = d[0] - x;
+    INT  i, count = (q < 0.0);
+
+    for ( i = 1; i < k; ++i ) {
+        if ( ABS(q) < SMALLREAL2 ) q = SMALLREAL2;
+        q = d[i] - x - e[i-1] * e[i-1] / q;
+        count += (q < 0.0);
+    }
+
+    return count;
+}
+
+/**
+ * \fn static void lanczos_mxv_dcsr (const void *A, const REAL *x, REAL *y)
+ *
+ * \brief y = A*x for a dCSRmat
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void lanczos_mxv_dcsr (const void  *A,
+                              const REAL  *x,
+                              REAL        *y)
+{
+    fasp_blas_dcsr_mxv((const dCSRmat *)A, x, y);
+}
+
+/**
+ * \fn static void lanczos_mxv_dbsr (const void *A, const REAL *x, REAL *y)
+ *
+ * \brief y = A*x for a dBSRmat
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void lanczos_mxv_dbsr (const void  *A,
+                              const REAL  *x,
+                              REAL        *y)
+{
+    fasp_blas_dbsr_mxv((const dBSRmat *)A, x, y);
+}
+
+/**
+ * \fn static void lanczos_dinv (const INT n, const INT nb, const REAL *dinv,
+ *                               const REAL *x, REAL *y)
+ *
+ * \brief y = D^{-1}*x with D^{-1} given by its nb x nb diagonal blocks
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void lanczos_dinv (const INT    n,
+                          const INT    nb,
+                          const REAL  *dinv,
+                          const REAL  *x,
+                          REAL        *y)
+{
+    const INT nb2 = nb * nb;
+    INT       i;
+
+    if ( nb == 1 ) {
+#ifdef _OPENMP
+#pragma omp parallel for if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n; ++i ) y[i] = dinv[i] * x[i];
+    }
+    else {
+#ifdef _OPENMP
+#pragma omp parallel for if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n / nb; ++i )
+            fasp_blas_smat_mxv(dinv + i*nb2, x + i*nb, y + i*nb, nb);
+    }
+}
+
+/**
+ * \fn static SHORT lanczos (const INT n, const INT k,
+ *                           void (*mxv)(const void *, const REAL *, REAL *),
+ *                           const void *A,
+ *                           void (*prec)(const INT, const INT, const REAL *,
+ *                                        const REAL *, REAL *),
+ *                           const REAL *dinv, const INT nb,
+ *                           REAL *lmin, REAL *lmax)
+ *
+ * \brief Preconditioned Lanczos for the extreme eigenvalues of D^{-1}A
+ *
+ * \param n      Size of the problem
+ * \param k      Number of Lanczos steps
+ * \param mxv    Action of A
+ * \param A      Data of A
+ * \param prec   Action of D^{-1}; NULL for the identity
+ * \param dinv   Data of D^{-1}
+ * \param nb     Block size of D^{-1}
+ * \param lmin   Smallest Ritz value (OUT)
+ * \param lmax   Largest Ritz value (OUT)
+ *
+ * \return       FASP_SUCCESS if succeeded; ERROR_SOLVER_MISC if A or D is not SPD
+ *
+ * \note The recurrence is run in the D-inner product, so that D^{-1}A is
+ *       self-adjoint and T_k is symmetric:
+ *       r_j = A u_j - alpha_j w_j - beta_j w_{j-1}, u_j = D^{-1} w_j.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static SHORT lanczos (const INT    n,
+                      const INT    k,
+                      void       (*mxv)(const void *, const REAL *, REAL *),
+                      const void  *A,
+                      void       (*prec)(const INT, const INT, const REAL *,
+                                         const REAL *, REAL *),
+                      const REAL  *dinv,
+                      const INT    nb,
+                      REAL        *lmin,
+                      REAL        *lmax)
+{
+    SHORT status = FASP_SUCCESS;
+    REAL  *work, *wp, *w, *z, *r, *t, *alpha, *beta, rz, bj;
+    INT   i, j, m = 0;
+
+    *lmin = *lmax = 0.0;
+    if ( n <= 0 || k <= 0 ) return status;
+
+    work  = (REAL *)fasp_mem_calloc(4*n + 2*k, sizeof(REAL));
+    wp    = work; w = wp + n; z = w + n; r = z + n;
+    alpha = r + n; beta = alpha + k;
+
+    // a fixed pseudo-random starting vector
+    for ( i = 0; i < n; ++i ) r[i] = 0.5 + (REAL)((i * 7919 + 17) % 1009) / 1009.0;
+
+    if ( prec ) prec(n, nb, dinv, r, z); else fasp_darray_cp(n, r, z);
+    rz = fasp_blas_darray_dotprod(n, r, z);
+    if ( rz <= 0.0 ) { status = ERROR_SOLVER_MISC; goto FINISHED; }
+    bj = sqrt(rz);
+
+    for ( j = 0; j < k; ++j ) {
+
+        // w_j = r/beta_j, u_j = z/beta_j (kept in z)
+        for ( i = 0; i < n; ++i ) { w[i] = r[i] / bj; z[i] /= bj; }
+
+        // r = A u_j - alpha_j w_j - beta_j w_{j-1}
+        mxv(A, z, r);
+        alpha[j] = fasp_blas_darray_dotprod(n, z, r);
+        for ( i = 0; i < n; ++i ) r[i] -= alpha[j] * w[i] + bj * wp[i];
+        beta[j] = bj; m = j + 1;
+
+        t = wp; wp = w; w = t;
+
+        if ( prec ) prec(n, nb, dinv, r, z); else fasp_darray_cp(n, r, z);
+        rz = fasp_blas_darray_dotprod(n, r, z);
+        if ( rz < 0.0 ) { status = ERROR_SOLVER_MISC; break; }
+        if ( rz <= SMALLREAL2 * alpha[0] * alpha[0] ) break; // invariant subspace
+        bj = sqrt(rz);
+        if ( j < k-1 ) beta[j+1] = bj;
+    }
+
+    // T_k has diagonal alpha and off-diagonal beta[1], ..., beta[m-1]
+    fasp_tridiag_extreme_eig(m, alpha, beta + 1, lmin, lmax);
+
+FINISHED:
+    fasp_mem_free(work); work = NULL;
+
+    return status;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
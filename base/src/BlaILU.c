@@ -1,6 +1,6 @@
 /*! \file  BlaILU.c
  *
- *  \brief Incomplete LU decomposition: ILUk, ILUt, ILUtp
+ *  \brief Incomplete LU decomposition: ILUk, ILUt, ILUtp, and fixed-point ILUk
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
  *         AuxMemory.c
@@ -16,6 +16,10 @@
 #include <math.h>
 #include <time.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "fasp.h"
 #include "fasp_functs.h"
 
@@ -26,6 +30,8 @@
 static void fasp_qsplit  (REAL *a, INT *ind, INT n, INT ncut);
 static void fasp_sortrow (INT num,INT *q);
 static void fasp_check_col_index (INT row, INT num, INT  *q);
+static void fasp_ilu_fp_sortrow (INT *jlu, REAL *alu, INT lo, INT hi);
+static INT  fasp_ilu_fp_find (const INT *jlu, INT lo, INT hi, INT col);
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -1976,6 +1982,258 @@ F100:
     //======================== End of symbfac ==============================
 }
 
+/**
+ * \fn void fasp_iluk_fp (INT n, REAL *a, INT *ja, INT *ia, INT lfil, INT nsweeps,
+ *                        REAL *alu, INT *jlu, INT iwk, INT *ierr, INT *nzlu)
+ *
+ * \brief Get ILU(k) factorization of a CSR matrix A by fixed-point sweeps
+ *
+ * \param n        row number of A
+ * \param a        nonzero entries of A
+ * \param ja       integer array of column for A
+ * \param ia       integer array of row pointers for A
+ * \param lfil     integer. Level of fill-in allowed. lfil must be .ge. 0.
+ * \param nsweeps  integer. Number of fixed-point sweeps. nsweeps must be .ge. 1.
+ * \param alu      L and U factors in MSR format, same as in fasp_iluk.
+ * \param jlu      integer array of row pointers and column indices for alu.
+ * \param iwk      integer. The lengths of arrays alu and jlu.
+ * \param ierr     integer pointer. Return error message with the following meaning.
+ *                   0  --> successful return.
+ *                  >0  --> zero pivot encountered at step number ierr.
+ *                  -1  --> not enough storage for the symbolic factorization.
+ *                  -4  --> Illegal value for lfil or nsweeps.
+ * \param nzlu     integer pointer. Return number of nonzero entries for alu and jlu
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The pattern comes from fasp_symbfactor and the values from
+ *       fasp_ilu_fp_sweeps, whose sweeps are parallel over the nonzeros. Stored
+ *       zeros of A are dropped before the symbolic step, as in fasp_iluk, so
+ *       both give the same pattern.
+ */
+void fasp_iluk_fp (INT    n,
+                   REAL  *a,
+                   INT   *ja,
+                   INT   *ia,
+                   INT    lfil,
+                   INT    nsweeps,
+                   REAL  *alu,
+                   INT   *jlu,
+                   INT    iwk,
+                   INT   *ierr,
+                   INT   *nzlu)
+{
+    INT *uptr, *ianz, *janz;
+    INT  i, p, nz;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( lfil < 0 || nsweeps < 1 ) {
+        printf("### ERROR: Illegal lfil or nsweeps entered. [%s]\n", __FUNCTION__);
+        *ierr = -4;
+        return;
+    }
+
+    // pattern of A without stored zeros (fasp_iluk skips them as well)
+    ianz = (INT *)fasp_mem_calloc(n+1, sizeof(INT));
+    janz = (INT *)fasp_mem_calloc(MAX(ia[n], 1), sizeof(INT));
+    for ( nz = i = 0; i < n; ++i ) {
+        for ( p = ia[i]; p < ia[i+1]; ++p ) {
+            if ( a[p] != 0.0 || ja[p] == i ) janz[nz++] = ja[p];
+        }
+        ianz[i+1] = nz;
+    }
+
+    // symbolic factorization: the ILU(k) pattern in MSR format
+    uptr = (INT *)fasp_mem_calloc(n, sizeof(INT));
+    fasp_symbfactor(n, janz, ianz, lfil, iwk, nzlu, jlu, uptr, ierr);
+    fasp_mem_free(uptr); uptr = NULL;
+    fasp_mem_free(ianz); ianz = NULL;
+    fasp_mem_free(janz); janz = NULL;
+
+    if ( *ierr != 0 ) {
+        *ierr = -1;
+        return;
+    }
+
+    // numerical factorization: fixed-point sweeps from A
+    fasp_ilu_fp_sweeps(n, a, ja, ia, alu, jlu, nsweeps, FALSE, ierr);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+}
+
+/**
+ * \fn void fasp_ilu_fp_sweeps (INT n, REAL *a, INT *ja, INT *ia, REAL *alu,
+ *                              INT *jlu, INT nsweeps, SHORT warm, INT *ierr)
+ *
+ * \brief Numerical ILU factorization on a given MSR pattern by fixed-point sweeps
+ *
+ * \param n        row number of A
+ * \param a        nonzero entries of A
+ * \param ja       integer array of column for A
+ * \param ia       integer array of row pointers for A
+ * \param alu      L and U factors in MSR format. The diagonal (stored in
+ *                 alu(1:n) ) is inverted on return.
+ * \param jlu      integer array of row pointers and column indices for alu.
+ *                 Each row is sorted by column on return.
+ * \param nsweeps  integer. Number of fixed-point sweeps.
+ * \param warm     TRUE: start from the factors in alu; FALSE: start from A
+ * \param ierr     integer pointer. Return error message with the following meaning.
+ *                   0  --> successful return.
+ *                  >0  --> zero pivot encountered at step number ierr.
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Synchronous version of the Chow--Patel iteration: each sweep computes
+ *          l_ij = (a_ij - sum_{k<j} l_ik u_kj) / u_jj,  for i > j,
+ *          u_ij =  a_ij - sum_{k<i} l_ik u_kj,          for i <= j,
+ *       for all (i,j) in the pattern from the previous iterate, so the nonzeros
+ *       are updated independently and the result does not depend on the number
+ *       of threads. The ILU factors on the pattern are the fixed point; the
+ *       iteration reaches them after at most as many sweeps as the depth of the
+ *       elimination, but a few sweeps usually make a good preconditioner. With
+ *       warm = TRUE, this is a numerical refactorization for a matrix with the
+ *       same pattern, e.g., in Newton iterations.
+ */
+void fasp_ilu_fp_sweeps (INT    n,
+                         REAL  *a,
+                         INT   *ja,
+                         INT   *ia,
+                         REAL  *alu,
+                         INT   *jlu,
+                         INT    nsweeps,
+                         SHORT  warm,
+                         INT   *ierr)
+{
+    const INT nzlu = jlu[n];
+
+    INT   i, j, k, p, q, r, sweep;
+    REAL  t;
+    INT  *uptr;
+    REAL *apat, *aold;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+#endif
+
+    uptr = (INT *)fasp_mem_calloc(n, sizeof(INT));
+    apat = (REAL *)fasp_mem_calloc(nzlu, sizeof(REAL));
+    aold = (REAL *)fasp_mem_calloc(nzlu, sizeof(REAL));
+
+    *ierr = 0;
+
+    /*-----------------------------------------------------------------------
+     sort each row by column, locate the U part, and copy A into the pattern
+     (entries of A outside of the pattern are dropped).
+     -----------------------------------------------------------------------*/
+#ifdef _OPENMP
+#pragma omp parallel for if (n > OPENMP_HOLDS) private(i, p, q)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        fasp_ilu_fp_sortrow(jlu, alu, jlu[i], jlu[i+1]);
+        for ( p = jlu[i]; p < jlu[i+1] && jlu[p] < i; ++p ) ;
+        uptr[i] = p;
+        for ( p = ia[i]; p < ia[i+1]; ++p ) {
+            if ( ja[p] == i ) {
+                apat[i] = a[p];
+            }
+            else {
+                q = fasp_ilu_fp_find(jlu, jlu[i], jlu[i+1], ja[p]);
+                if ( q >= 0 ) apat[q] = a[p];
+            }
+        }
+    }
+
+    /*-----------------------------------------------------------------------
+     initial guess: the current factors, or L = A_L D^{-1} and U = D + A_U
+     -----------------------------------------------------------------------*/
+    if ( warm ) {
+        for ( i = 0; i < n; ++i ) alu[i] = 1.0 / alu[i];
+    }
+    else {
+        for ( i = 0; i < n; ++i ) {
+            if ( ABS(apat[i]) < SMALLREAL ) {
+                *ierr = i + 1;
+                goto F100;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for if (n > OPENMP_HOLDS) private(i, p)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            alu[i] = apat[i];
+            for ( p = jlu[i]; p < uptr[i]; ++p )   alu[p] = apat[p] / apat[jlu[p]];
+            for ( p = uptr[i]; p < jlu[i+1]; ++p ) alu[p] = apat[p];
+        }
+    }
+
+    /*-----------------------------------------------------------------------
+     fixed-point sweeps: all entries are computed from the previous iterate
+     -----------------------------------------------------------------------*/
+    for ( sweep = 0; sweep < nsweeps; ++sweep ) {
+
+        fasp_darray_cp(nzlu, alu, aold);
+
+#ifdef _OPENMP
+#pragma omp parallel for if (n > OPENMP_HOLDS) private(i, j, k, p, q, r, t)
+#endif
+        for ( i = 0; i < n; ++i ) {
+
+            // diagonal: u_ii = a_ii - sum_{k<i} l_ik u_ki
+            t = apat[i];
+            for ( q = jlu[i]; q < uptr[i]; ++q ) {
+                k = jlu[q];
+                r = fasp_ilu_fp_find(jlu, uptr[k], jlu[k+1], i);
+                if ( r >= 0 ) t -= aold[q] * aold[r];
+            }
+            alu[i] = t;
+
+            // off-diagonals: sum over k < min(i,j)
+            for ( p = jlu[i]; p < jlu[i+1]; ++p ) {
+                j = jlu[p];
+                t = apat[p];
+                for ( q = jlu[i]; q < uptr[i]; ++q ) {
+                    k = jlu[q];
+                    if ( k >= j ) break;
+                    r = fasp_ilu_fp_find(jlu, uptr[k], jlu[k+1], j);
+                    if ( r >= 0 ) t -= aold[q] * aold[r];
+                }
+                alu[p] = ( j < i ) ? t / aold[j] : t;
+            }
+        }
+
+        for ( i = 0; i < n; ++i ) {
+            if ( ABS(alu[i]) < SMALLREAL ) {
+                *ierr = i + 1;
+                goto F100;
+            }
+        }
+    }
+
+    // store the inverted diagonal as in fasp_iluk
+    for ( i = 0; i < n; ++i ) alu[i] = 1.0 / alu[i];
+
+F100:
+    if ( *ierr > 0 ) {
+        printf("### ERROR: Zero pivot encountered at step %d. [%s]\n",
+               *ierr, __FUNCTION__);
+    }
+
+    fasp_mem_free(uptr); uptr = NULL;
+    fasp_mem_free(apat); apat = NULL;
+    fasp_mem_free(aold); aold = NULL;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+}
+
 /*---------------------------------*/
 /*--      Private Functions      --*/
 /*---------------------------------*/
@@ -2198,6 +2456,70 @@ static void fasp_check_col_index (INT row,
     return;
 }
 
+/**
+ * \fn static void fasp_ilu_fp_sortrow (INT *jlu, REAL *alu, INT lo, INT hi)
+ *
+ * \brief Sort jlu[lo:hi-1] in ascending order, and alu[lo:hi-1] with it
+ *
+ * \param jlu  integer array of column indices
+ * \param alu  array of values
+ * \param lo   first position
+ * \param hi   last position plus one
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Insertion sort: rows of the ILU pattern are short and usually sorted.
+ */
+static void fasp_ilu_fp_sortrow (INT   *jlu,
+                                 REAL  *alu,
+                                 INT    lo,
+                                 INT    hi)
+{
+    INT  p, q, col;
+    REAL val;
+
+    for ( p = lo + 1; p < hi; ++p ) {
+        col = jlu[p]; val = alu[p];
+        for ( q = p - 1; q >= lo && jlu[q] > col; --q ) {
+            jlu[q+1] = jlu[q]; alu[q+1] = alu[q];
+        }
+        jlu[q+1] = col; alu[q+1] = val;
+    }
+}
+
+/**
+ * \fn static INT fasp_ilu_fp_find (const INT *jlu, INT lo, INT hi, INT col)
+ *
+ * \brief Binary search of column col in the sorted jlu[lo:hi-1]
+ *
+ * \param jlu  integer array of column indices
+ * \param lo   first position
+ * \param hi   last position plus one
+ * \param col  column index to find
+ *
+ * \return     Position of col in jlu, or -1 if not found
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT fasp_ilu_fp_find (const INT  *jlu,
+                             INT         lo,
+                             INT         hi,
+                             INT         col)
+{
+    const INT end = hi;
+    INT       mid;
+
+    while ( lo < hi ) {
+        mid = (lo + hi) / 2;
+        if ( jlu[mid] < col ) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return ( lo < end && jlu[lo] == col ) ? lo : -1;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
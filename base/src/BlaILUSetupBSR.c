@@ -89,6 +89,9 @@ SHORT fasp_ilu_dbsr_setup(dBSRmat *A,
     iludata->A     = NULL; // No need for BSR matrix
     iludata->row   = iludata->col = n;
     iludata->nb    = nb;
+    iludata->diaginv = NULL; // no split storage for BSR
+    iludata->perm    = NULL; // no reordering for BSR
+    iludata->jacobi_sweeps = iluparam->ILU_jacobi_sweeps;
     iludata->ilevL = iludata->jlevL = NULL;
     iludata->ilevU = iludata->jlevU = NULL;
     
@@ -224,6 +227,8 @@ SHORT fasp_ilu_dbsr_setup_step (dBSRmat    *A,
         iludata->A     = NULL; // No need for BSR matrix
         iludata->row   = iludata->col = n;
         iludata->nb    = nb;
+        iludata->diaginv = NULL; // no split storage for BSR
+        iludata->perm    = NULL; // no reordering for BSR
         iludata->ilevL = iludata->jlevL = NULL;
         iludata->ilevU = iludata->jlevU = NULL;
         
@@ -356,6 +361,8 @@ SHORT fasp_ilu_dbsr_setup_omp (dBSRmat    *A,
     iludata->A     = NULL; // No need for BSR matrix
     iludata->row   = iludata->col = n;
     iludata->nb    = nb;
+    iludata->diaginv = NULL; // no split storage for BSR
+    iludata->perm    = NULL; // no reordering for BSR
     
     ijlu = (INT *) fasp_mem_calloc(iwk,   sizeof(INT));
     uptr = (INT *) fasp_mem_calloc(A->ROW,sizeof(INT));
@@ -491,6 +498,8 @@ SHORT fasp_ilu_dbsr_setup_levsch_omp (dBSRmat    *A,
     iludata->A     = NULL; // No need for BSR matrix
     iludata->row   = iludata->col=n;
     iludata->nb    = nb;
+    iludata->diaginv = NULL; // no split storage for BSR
+    iludata->perm    = NULL; // no reordering for BSR
     
     ijlu = (INT*)fasp_mem_calloc(iwk,sizeof(INT));
     uptr = (INT*)fasp_mem_calloc(A->ROW,sizeof(INT));
@@ -634,6 +643,8 @@ SHORT fasp_ilu_dbsr_setup_levsch_step (dBSRmat    *A,
         iludata->A     = NULL; // No need for BSR matrix
         iludata->row   = iludata->col=n;
         iludata->nb    = nb;
+        iludata->diaginv = NULL; // no split storage for BSR
+        iludata->perm    = NULL; // no reordering for BSR
         
         fasp_mem_free(ijlu); 
         ijlu = (INT*)fasp_mem_calloc(iwk,sizeof(INT));
@@ -1866,6 +1877,11 @@ static void multicoloring (AMG_data *mgl,
  *
  * \author Zheng Li, Chensong Zhang
  * \date   12/04/2016
+ *
+ * \note Works on the MSR structure ijlu only, so it serves CSR and BSR alike.
+ *
+ * Modified by agent on 10/18/2026: nlevL and nlevU are the exact numbers
+ *                                  of levels (ilevL[nlevL] = row)
  */
 void topologic_sort_ILU (ILU_data *iludata)
 {
@@ -1932,8 +1948,8 @@ void topologic_sort_ILU (ILU_data *iludata)
     
     ilevU[0] = 0;
     
-    iludata->nlevL = nlevL+1; iludata->ilevL = ilevL;iludata->jlevL = jlevL;
-    iludata->nlevU = nlevU+1; iludata->ilevU = ilevU;iludata->jlevU = jlevU;
+    iludata->nlevL = nlevL; iludata->ilevL = ilevL;iludata->jlevL = jlevL;
+    iludata->nlevU = nlevU; iludata->ilevU = ilevU;iludata->jlevU = jlevU;
     
     fasp_mem_free(level); level = NULL;
 }
@@ -3,7 +3,8 @@
  *  \brief Setup incomplete LU decomposition for dCSRmat matrices
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
- *         AuxTiming.c, BlaILU.c, BlaSparseCSR.c, and PreDataInit.c
+ *         AuxTiming.c, BlaILU.c, BlaILUSetupBSR.c, BlaSparseCSR.c, and
+ *         PreDataInit.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
@@ -14,9 +15,27 @@
 #include <math.h>
 #include <time.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "fasp.h"
 #include "fasp_functs.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#ifdef _OPENMP
+static SHORT ilu_levsch_check(const ILU_data*, const INT, const INT*);
+#endif
+static void ilu_jacobi_lsolve(const ILU_data*, const REAL*, REAL*);
+static void ilu_jacobi_usolve(const ILU_data*, const REAL*, REAL*);
+static inline REAL ilu_lrow_solve(const ILU_data*, const INT, REAL, const REAL*);
+static inline REAL ilu_urow_solve(const ILU_data*, const INT, REAL, const REAL*);
+static void ilu_bj_block(const dCSRmat*, const INT, const INT, dCSRmat*);
+static dCSRmat ilu_split_create(const INT, const INT);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -36,6 +55,12 @@
  * \date   12/27/2009
  *
  * Modified by Chunsheng Feng on 02/12/2017: add iperm array for ILUTp
+ * Modified by agent on 10/18/2026: level sets, Jacobi sweeps, fixed-point ILUk,
+ *                                  split L/U storage and reorderings
+ *
+ * \note With iluparam->ILU_split > 0, the factors are also copied to split
+ *       storage by fasp_ilu_data_split: faster triangular solves for about
+ *       twice the memory of the factors.
  */
 SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
                            ILU_data   *iludata,
@@ -45,11 +70,17 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
     const INT   n = A->col, nnz = A->nnz, mbloc = n;
     const REAL  ILU_droptol = iluparam->ILU_droptol;
     const REAL  permtol = iluparam->ILU_permtol;
+    const INT   fp_sweeps = iluparam->ILU_fp_sweeps;
+    const SHORT fixedpoint = (type != ILUt && type != ILUtp && fp_sweeps > 0);
+    const INT   reorder = (type == ILUtp) ? ILU_ORDER_NONE : iluparam->ILU_reorder;
     
     // local variable
     INT    lfil = iluparam->ILU_lfil, lfilt = iluparam->ILU_lfil;
     INT    ierr, iwk, nzlu, nwork, *ijlu, *iperm;
     REAL  *luval;
+    INT   *order, *oindex;
+    
+    dCSRmat  Ap, *B = A; // B is the matrix to be factorized
     
     REAL   setup_start, setup_end, setup_duration;
     SHORT  status = FASP_SUCCESS;
@@ -89,6 +120,9 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
     iludata->ilevU = iludata->jlevU = NULL;
     iludata->iperm = NULL;
     iludata->type  = type;
+    iludata->jacobi_sweeps = iluparam->ILU_jacobi_sweeps;
+    iludata->diaginv = NULL;
+    iludata->perm  = NULL;
     
     fasp_ilu_data_create(iwk, nwork, iludata);
     
@@ -97,6 +131,27 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
     fasp_mem_usage();
 #endif
     
+    // reorder A to reduce fill-in and bandwidth; ILUtp permutes by itself
+    if (reorder != ILU_ORDER_NONE) {
+        iludata->perm = (INT *)fasp_mem_calloc(n, sizeof(INT));
+        
+        switch (reorder) {
+            case ILU_ORDER_RCM:
+                order  = (INT *)fasp_mem_calloc(n, sizeof(INT));
+                oindex = (INT *)fasp_mem_calloc(n, sizeof(INT));
+                fasp_dcsr_RCMK_order(A, order, oindex, iludata->perm);
+                fasp_mem_free(order);  order  = NULL;
+                fasp_mem_free(oindex); oindex = NULL;
+                break;
+            default: // ILU_ORDER_ND
+                fasp_dcsr_ND_order(A, iludata->perm);
+                break;
+        }
+        
+        Ap = fasp_dcsr_permz(A, iludata->perm);
+        B  = &Ap;
+    }
+    
     // ILU decomposition
     ijlu  = iludata->ijlu;
     luval = iludata->luval;
@@ -104,24 +159,28 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
     switch (type) {
 
         case ILUt:
-            fasp_ilut (n, A->val, A->JA, A->IA, lfilt, ILU_droptol, luval, ijlu,
+            fasp_ilut (n, B->val, B->JA, B->IA, lfilt, ILU_droptol, luval, ijlu,
                        iwk, &ierr, &nzlu);
             break;
             
         case ILUtp:
             iperm = iludata->iperm;
-            fasp_ilutp (n, A->val, A->JA, A->IA, lfilt, ILU_droptol, permtol,
+            fasp_ilutp (n, B->val, B->JA, B->IA, lfilt, ILU_droptol, permtol,
                         mbloc, luval, ijlu, iperm, iwk, &ierr, &nzlu);
             break;
             
         default: // ILUk
-            fasp_iluk (n, A->val, A->JA, A->IA, lfil, luval, ijlu, iwk,
-                       &ierr, &nzlu);
+            if (fixedpoint) // parallel fixed-point sweeps; A is not shifted
+                fasp_iluk_fp (n, B->val, B->JA, B->IA, lfil, fp_sweeps, luval,
+                              ijlu, iwk, &ierr, &nzlu);
+            else
+                fasp_iluk (n, B->val, B->JA, B->IA, lfil, luval, ijlu, iwk,
+                           &ierr, &nzlu);
             break;
 
     } 
-   if (ierr != -4) 
-    fasp_dcsr_shift(A, -1);
+   if (ierr != -4 && !fixedpoint) 
+    fasp_dcsr_shift(B, -1);
     
 #if DEBUG_MODE > 1
     printf("### DEBUG: memory usage after ILU setup: \n");
@@ -147,6 +206,14 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
         goto FINISHED;
     }
     
+#ifdef _OPENMP
+    // level sets of L and U for the level-scheduled triangular solves
+    topologic_sort_ILU(iludata);
+#endif
+
+    // separate L, U, and inverted diagonal for the triangular solves
+    if (iluparam->ILU_split > 0) fasp_ilu_data_split(iludata);
+
     if (print_level>PRINT_NONE) {
         fasp_gettime(&setup_end);
         setup_duration = setup_end - setup_start;
@@ -159,13 +226,19 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
                 printf("ILUtp setup costs %f seconds.\n", setup_duration);    
                 break;
             default: // ILUk
-                printf("ILUk setup costs %f seconds.\n", setup_duration);    
+                if (fixedpoint)
+                    printf("ILUk (%d fixed-point sweeps) setup costs %f seconds.\n",
+                           fp_sweeps, setup_duration);
+                else
+                    printf("ILUk setup costs %f seconds.\n", setup_duration);    
                 break;
         }     
     }
     
 FINISHED:     
     
+    if (B != A) fasp_dcsr_free(&Ap);
+    
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
@@ -173,6 +246,617 @@ FINISHED:
     return status;
 }
 
+/**
+ * \fn SHORT fasp_ilu_dcsr_refactor (dCSRmat *A, ILU_data *iludata, const INT nsweeps)
+ *
+ * \brief Numerical ILU refactorization of a CSR matrix A with the pattern kept
+ *
+ * \param A         Pointer to dCSRmat matrix
+ * \param iludata   Pointer to ILU_data from fasp_ilu_dcsr_setup
+ * \param nsweeps   Number of fixed-point sweeps
+ *
+ * \return          FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The factors are updated by fasp_ilu_fp_sweeps from the current ones, which
+ *       only needs a few parallel sweeps if A has changed a little, e.g., between
+ *       two Newton steps. Not for ILUtp, which permutes the columns.
+ */
+SHORT fasp_ilu_dcsr_refactor(dCSRmat* A, ILU_data* iludata, const INT nsweeps)
+{
+    INT     ierr;
+    dCSRmat Ap;
+
+    if (iludata->type == ILUtp || iludata->row != A->row || nsweeps < 1) {
+        printf("### ERROR: Cannot refactorize ILU data! [%s]\n", __FUNCTION__);
+        return ERROR_SOLVER_ILUSETUP;
+    }
+
+    if (iludata->perm == NULL) {
+        fasp_ilu_fp_sweeps(A->row, A->val, A->JA, A->IA, iludata->luval,
+                           iludata->ijlu, nsweeps, TRUE, &ierr);
+    } else { // factors are of PAP'
+        Ap = fasp_dcsr_permz(A, iludata->perm);
+        fasp_ilu_fp_sweeps(Ap.row, Ap.val, Ap.JA, Ap.IA, iludata->luval,
+                           iludata->ijlu, nsweeps, TRUE, &ierr);
+        fasp_dcsr_free(&Ap);
+    }
+
+    if (ierr != 0) {
+        printf("### ERROR: ILU refactorization failed (ierr=%d)! [%s]\n", ierr,
+               __FUNCTION__);
+        return ERROR_SOLVER_ILUSETUP;
+    }
+
+    if (iludata->diaginv != NULL) fasp_ilu_data_split(iludata);
+
+    return FASP_SUCCESS;
+}
+
+/**
+ * \fn SHORT fasp_ilu_dcsr_setup_bj (dCSRmat *A, BJILU_data *bjdata,
+ *                                  ILU_param *iluparam, const INT nblk)
+ *
+ * \brief Setup thread-domain block-Jacobi ILU of a CSR matrix A
+ *
+ * \param A         Pointer to dCSRmat matrix
+ * \param bjdata    Pointer to BJILU_data
+ * \param iluparam  Pointer to ILU_param
+ * \param nblk      Number of diagonal blocks (0: one block per OpenMP thread)
+ *
+ * \return          FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Rows are split into contiguous ranges with about the same number of
+ *       nonzeros. The couplings between blocks are dropped and the diagonal
+ *       blocks are factorized by ILU(k) or ILUt concurrently, one per thread.
+ */
+SHORT fasp_ilu_dcsr_setup_bj(dCSRmat*   A,
+                             BJILU_data* bjdata,
+                             ILU_param* iluparam,
+                             const INT  nblk)
+{
+    const INT  m = A->row, nnz = A->nnz;
+    const INT* IA = A->IA;
+
+    ILU_param blkparam = *iluparam;
+    SHORT*    blkstatus;
+    INT       nb = nblk, k, lo, hi, mid, target;
+    REAL      setup_start, setup_end;
+    SHORT     status = FASP_SUCCESS;
+
+    fasp_gettime(&setup_start);
+
+    if (nb <= 0) {
+#ifdef _OPENMP
+        nb = fasp_get_num_threads();
+#else
+        nb = 1;
+#endif
+    }
+    nb = MAX(MIN(nb, m), 1);
+
+    bjdata->row   = m;
+    bjdata->nblk  = nb;
+    bjdata->start = (INT*)fasp_mem_calloc(nb + 1, sizeof(INT));
+    bjdata->Ablk  = (dCSRmat*)fasp_mem_calloc(nb, sizeof(dCSRmat));
+    bjdata->LU    = (ILU_data*)fasp_mem_calloc(nb, sizeof(ILU_data));
+    bjdata->work  = (REAL*)fasp_mem_calloc(2 * m, sizeof(REAL));
+    blkstatus     = (SHORT*)fasp_mem_calloc(nb, sizeof(SHORT));
+
+    // nonzero-balanced row ranges: first row with IA[row] >= k*nnz/nb
+    bjdata->start[0]  = 0;
+    bjdata->start[nb] = m;
+    for (k = 1; k < nb; ++k) {
+        target = (INT)((LONGLONG)k * nnz / nb);
+        lo     = bjdata->start[k - 1] + 1;
+        hi     = m - (nb - k);
+        while (lo < hi) {
+            mid = (lo + hi) / 2;
+            if (IA[mid] - IA[0] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        bjdata->start[k] = lo;
+    }
+
+    blkparam.print_level = PRINT_NONE;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) if (nb > 1)
+#endif
+    for (k = 0; k < nb; ++k) {
+        ilu_bj_block(A, bjdata->start[k], bjdata->start[k + 1], &bjdata->Ablk[k]);
+        blkstatus[k] = fasp_ilu_dcsr_setup(&bjdata->Ablk[k], &bjdata->LU[k], &blkparam);
+    }
+
+    for (k = 0; k < nb; ++k) {
+        if (blkstatus[k] < 0) status = blkstatus[k];
+    }
+
+    fasp_mem_free(blkstatus);
+    blkstatus = NULL;
+
+    if (status < 0) {
+        printf("### ERROR: Block-Jacobi ILU setup failed! [%s]\n", __FUNCTION__);
+        fasp_bjilu_data_free(bjdata);
+        return status;
+    }
+
+    if (iluparam->print_level > PRINT_MIN) {
+        fasp_gettime(&setup_end);
+        printf("Block-Jacobi ILU with %d blocks setup costs %f seconds.\n", nb,
+               setup_end - setup_start);
+    }
+
+    return status;
+}
+
+/**
+ * \fn void fasp_ilu_data_split (ILU_data *iludata)
+ *
+ * \brief Copy the ILU factors of a CSR matrix from MSR format to split storage
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The strictly lower part of L and the strictly upper part of U are stored
+ *       in iludata->L and iludata->U, and the inverted diagonal in a dense array
+ *       iludata->diaginv, so that a triangular sweep reads exactly the entries it
+ *       needs without testing the column index. Call it again if luval changes.
+ */
+void fasp_ilu_data_split(ILU_data* iludata)
+{
+    const INT   m    = iludata->row;
+    const INT*  ijlu = iludata->ijlu;
+    const REAL* lu   = iludata->luval;
+
+    INT i, j, jj, kL, kU, nnzL = 0, nnzU = 0;
+
+    if (iludata->diaginv != NULL) {
+        fasp_dcsr_free(&iludata->L);
+        fasp_dcsr_free(&iludata->U);
+        fasp_mem_free(iludata->diaginv);
+        iludata->diaginv = NULL;
+    }
+
+    for (i = 0; i < m; ++i) {
+        for (j = ijlu[i]; j < ijlu[i + 1]; ++j) {
+            if (ijlu[j] < i)
+                nnzL++;
+            else if (ijlu[j] > i)
+                nnzU++;
+        }
+    }
+
+    iludata->L       = ilu_split_create(m, nnzL);
+    iludata->U       = ilu_split_create(m, nnzU);
+    iludata->diaginv = (REAL*)fasp_mem_calloc(m, sizeof(REAL));
+
+    for (i = 0; i < m; ++i) {
+        kL = kU = 0;
+        for (j = ijlu[i]; j < ijlu[i + 1]; ++j) {
+            if (ijlu[j] < i)
+                kL++;
+            else if (ijlu[j] > i)
+                kU++;
+        }
+        iludata->L.IA[i + 1] = iludata->L.IA[i] + kL;
+        iludata->U.IA[i + 1] = iludata->U.IA[i] + kU;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS) private(i, j, jj, kL, kU)
+#endif
+    for (i = 0; i < m; ++i) {
+        kL = iludata->L.IA[i];
+        kU = iludata->U.IA[i];
+        for (j = ijlu[i]; j < ijlu[i + 1]; ++j) {
+            jj = ijlu[j];
+            if (jj < i) {
+                iludata->L.JA[kL]  = jj;
+                iludata->L.val[kL] = lu[j];
+                kL++;
+            } else if (jj > i) {
+                iludata->U.JA[kU]  = jj;
+                iludata->U.val[kU] = lu[j];
+                kU++;
+            }
+        }
+        iludata->diaginv[i] = lu[i];
+    }
+}
+
+/**
+ * \fn void fasp_ilu_dcsr_lsolve (const ILU_data *iludata, REAL *zr, REAL *zz)
+ *
+ * \brief Solve the unit lower triangular system L*zz = zr of an ILU factorization
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ * \param zr       Pointer to the right hand side
+ * \param zz       Pointer to the solution
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note With OpenMP, the rows of each level set of L are solved in parallel
+ *       if the level sets are big enough; otherwise it is a forward sweep.
+ * \note If iludata->jacobi_sweeps > 0, L is solved approximately by Jacobi
+ *       sweeps instead.
+ *
+ * Modified by agent on 10/18/2026: read the split L/U storage if any
+ */
+void fasp_ilu_dcsr_lsolve(const ILU_data* iludata, REAL* zr, REAL* zz)
+{
+    const INT m = iludata->row;
+    INT       i;
+
+    if (iludata->jacobi_sweeps > 0) {
+        ilu_jacobi_lsolve(iludata, zr, zz);
+        return;
+    }
+
+#ifdef _OPENMP
+    if (ilu_levsch_check(iludata, iludata->nlevL, iludata->ilevL)) {
+        const INT  nlev = iludata->nlevL;
+        const INT *ilev = iludata->ilevL, *jlev = iludata->jlevL;
+        INT        k, ii;
+
+#pragma omp parallel private(k, ii, i)
+        for (k = 0; k < nlev; ++k) {
+#pragma omp for
+            for (ii = ilev[k]; ii < ilev[k + 1]; ++ii) {
+                i     = jlev[ii];
+                zz[i] = ilu_lrow_solve(iludata, i, zr[i], zz);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (i = 0; i < m; ++i) zz[i] = ilu_lrow_solve(iludata, i, zr[i], zz);
+}
+
+/**
+ * \fn void fasp_ilu_dcsr_usolve (const ILU_data *iludata, REAL *zz, REAL *z)
+ *
+ * \brief Solve the upper triangular system U*z = zz of an ILU factorization
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ * \param zz       Pointer to the right hand side
+ * \param z        Pointer to the solution
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note With OpenMP, the rows of each level set of U are solved in parallel
+ *       if the level sets are big enough; otherwise it is a backward sweep.
+ * \note If iludata->jacobi_sweeps > 0, U is solved approximately by Jacobi
+ *       sweeps instead.
+ *
+ * Modified by agent on 10/18/2026: read the split L/U storage if any
+ */
+void fasp_ilu_dcsr_usolve(const ILU_data* iludata, REAL* zz, REAL* z)
+{
+    const INT m = iludata->row;
+    INT       i;
+
+    if (iludata->jacobi_sweeps > 0) {
+        ilu_jacobi_usolve(iludata, zz, z);
+        return;
+    }
+
+#ifdef _OPENMP
+    if (ilu_levsch_check(iludata, iludata->nlevU, iludata->ilevU)) {
+        const INT  nlev = iludata->nlevU;
+        const INT *ilev = iludata->ilevU, *jlev = iludata->jlevU;
+        INT        k, ii;
+
+#pragma omp parallel private(k, ii, i)
+        for (k = 0; k < nlev; ++k) {
+#pragma omp for
+            for (ii = ilev[k]; ii < ilev[k + 1]; ++ii) {
+                i    = jlev[ii];
+                z[i] = ilu_urow_solve(iludata, i, zz[i], z);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (i = m - 1; i >= 0; --i) z[i] = ilu_urow_solve(iludata, i, zz[i], z);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+#ifdef _OPENMP
+
+/**
+ * \fn static SHORT ilu_levsch_check (const ILU_data *iludata, const INT nlev,
+ *                                    const INT *ilev)
+ *
+ * \brief Check whether a level-scheduled triangular solve pays off
+ *
+ * \param iludata  Pointer to ILU_data
+ * \param nlev     Number of level sets
+ * \param ilev     Starting positions of the level sets
+ *
+ * \return         TRUE if the level sets should be solved in parallel
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each level costs a barrier, so it needs enough rows per level on average.
+ */
+static SHORT ilu_levsch_check(const ILU_data* iludata, const INT nlev, const INT* ilev)
+{
+    const INT m = iludata->row;
+
+    if (ilev == NULL || nlev <= 0 || m <= OPENMP_HOLDS) return FALSE;
+    if (omp_in_parallel() || fasp_get_num_threads() < 2) return FALSE;
+
+    return (m >= 64 * nlev) ? TRUE : FALSE;
+}
+
+#endif // end of _OPENMP
+
+/**
+ * \fn static void ilu_jacobi_lsolve (const ILU_data *iludata, const REAL *zr,
+ *                                    REAL *zz)
+ *
+ * \brief Approximately solve L*zz = zr by Jacobi sweeps
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ * \param zr       Pointer to the right hand side
+ * \param zz       Pointer to the solution
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note L has unit diagonal, so the initial guess is zz = zr. Each sweep is an
+ *       SpMV with the strictly lower part of L and has no data dependence
+ *       between rows. Uses iludata->work[3m:4m-1] for the previous iterate.
+ */
+static void ilu_jacobi_lsolve(const ILU_data* iludata, const REAL* zr, REAL* zz)
+{
+    const INT m       = iludata->row;
+    const INT nsweeps = iludata->jacobi_sweeps;
+
+    REAL* zold = iludata->work + 3 * m;
+    INT   i, k;
+
+    if (iludata->nwork < 4 * m) {
+        printf("### ERROR: Need %d memory, only %d available!\n", 4 * m,
+               iludata->nwork);
+        fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
+    }
+
+    fasp_darray_cp(m, zr, zz);
+
+    for (k = 0; k < nsweeps; ++k) {
+        fasp_darray_cp(m, zz, zold);
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS)
+#endif
+        for (i = 0; i < m; ++i) zz[i] = ilu_lrow_solve(iludata, i, zr[i], zold);
+    }
+}
+
+/**
+ * \fn static void ilu_jacobi_usolve (const ILU_data *iludata, const REAL *zz,
+ *                                    REAL *z)
+ *
+ * \brief Approximately solve U*z = zz by Jacobi sweeps
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ * \param zz       Pointer to the right hand side
+ * \param z        Pointer to the solution
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The diagonal of U is stored inverted in luval[0:m-1], so the initial
+ *       guess is z = D^{-1} zz. Uses iludata->work[3m:4m-1] for the previous
+ *       iterate.
+ */
+static void ilu_jacobi_usolve(const ILU_data* iludata, const REAL* zz, REAL* z)
+{
+    const INT   m       = iludata->row;
+    const INT   nsweeps = iludata->jacobi_sweeps;
+    const REAL* dinv    = iludata->diaginv ? iludata->diaginv : iludata->luval;
+
+    REAL* zold = iludata->work + 3 * m;
+    INT   i, k;
+
+    if (iludata->nwork < 4 * m) {
+        printf("### ERROR: Need %d memory, only %d available!\n", 4 * m,
+               iludata->nwork);
+        fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < m; ++i) z[i] = zz[i] * dinv[i];
+
+    for (k = 0; k < nsweeps; ++k) {
+        fasp_darray_cp(m, z, zold);
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS)
+#endif
+        for (i = 0; i < m; ++i) z[i] = ilu_urow_solve(iludata, i, zz[i], zold);
+    }
+}
+
+/**
+ * \fn static inline REAL ilu_lrow_solve (const ILU_data *iludata, const INT i,
+ *                                        REAL t, const REAL *x)
+ *
+ * \brief Return t - L(i,0:i-1)*x(0:i-1) for the strictly lower part of L
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ * \param i        Row index
+ * \param t        Right hand side of row i
+ * \param x        Pointer to the current solution
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Reads the split storage if it has been built; otherwise scans the L part
+ *       of the MSR row. The order of the updates is the same in both cases.
+ */
+static inline REAL ilu_lrow_solve(const ILU_data* iludata, const INT i, REAL t,
+                                  const REAL* x)
+{
+    INT j, jj;
+
+    if (iludata->diaginv != NULL) {
+        const INT*  ia  = iludata->L.IA;
+        const INT*  ja  = iludata->L.JA;
+        const REAL* val = iludata->L.val;
+
+        for (j = ia[i]; j < ia[i + 1]; ++j) t -= val[j] * x[ja[j]];
+    } else {
+        const INT*  ijlu = iludata->ijlu;
+        const REAL* lu   = iludata->luval;
+
+        for (j = ijlu[i]; j < ijlu[i + 1]; ++j) {
+            jj = ijlu[j];
+            if (jj < i)
+                t -= lu[j] * x[jj];
+            else
+                break;
+        }
+    }
+
+    return t;
+}
+
+/**
+ * \fn static inline REAL ilu_urow_solve (const ILU_data *iludata, const INT i,
+ *                                        REAL t, const REAL *x)
+ *
+ * \brief Return (t - U(i,i+1:m-1)*x(i+1:m-1)) / U(i,i)
+ *
+ * \param iludata  Pointer to ILU_data of a dCSRmat matrix
+ * \param i        Row index
+ * \param t        Right hand side of row i
+ * \param x        Pointer to the current solution
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Reads the split storage if it has been built; otherwise scans the U part
+ *       of the MSR row backward. The order of the updates is the same in both.
+ */
+static inline REAL ilu_urow_solve(const ILU_data* iludata, const INT i, REAL t,
+                                  const REAL* x)
+{
+    INT j, jj;
+
+    if (iludata->diaginv != NULL) {
+        const INT*  ia  = iludata->U.IA;
+        const INT*  ja  = iludata->U.JA;
+        const REAL* val = iludata->U.val;
+
+        for (j = ia[i + 1] - 1; j >= ia[i]; --j) t -= val[j] * x[ja[j]];
+
+        return t * iludata->diaginv[i];
+    } else {
+        const INT*  ijlu = iludata->ijlu;
+        const REAL* lu   = iludata->luval;
+
+        for (j = ijlu[i + 1] - 1; j >= ijlu[i]; --j) {
+            jj = ijlu[j];
+            if (jj > i)
+                t -= lu[j] * x[jj];
+            else
+                break;
+        }
+
+        return t * lu[i];
+    }
+}
+
+/**
+ * \fn static void ilu_bj_block (const dCSRmat *A, const INT s, const INT e,
+ *                               dCSRmat *B)
+ *
+ * \brief Extract the diagonal block A(s:e-1, s:e-1) with local indices
+ *
+ * \param A   Pointer to dCSRmat matrix
+ * \param s   First row of the block
+ * \param e   Last row of the block plus one
+ * \param B   Pointer to the diagonal block (output)
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void ilu_bj_block(const dCSRmat* A, const INT s, const INT e, dCSRmat* B)
+{
+    const INT*  IA = A->IA;
+    const INT*  JA = A->JA;
+    const REAL* val = A->val;
+
+    INT i, j, col, nz = 0;
+
+    for (i = s; i < e; ++i) {
+        for (j = IA[i]; j < IA[i + 1]; ++j) {
+            if (JA[j] >= s && JA[j] < e) nz++;
+        }
+    }
+
+    *B = fasp_dcsr_create(e - s, e - s, nz);
+
+    nz       = 0;
+    B->IA[0] = 0;
+    for (i = s; i < e; ++i) {
+        for (j = IA[i]; j < IA[i + 1]; ++j) {
+            col = JA[j];
+            if (col >= s && col < e) {
+                B->JA[nz]  = col - s;
+                B->val[nz] = val[j];
+                nz++;
+            }
+        }
+        B->IA[i - s + 1] = nz;
+    }
+}
+
+/**
+ * \fn static dCSRmat ilu_split_create (const INT m, const INT nnz)
+ *
+ * \brief Create an m x m strictly triangular factor with nnz entries
+ *
+ * \param m    Number of rows and columns
+ * \param nnz  Number of nonzeros
+ *
+ * \return     The new dCSRmat matrix
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note An empty factor (e.g., L of a diagonal block) only gets IA; JA and val
+ *       are left NULL instead of allocating zero bytes.
+ */
+static dCSRmat ilu_split_create(const INT m, const INT nnz)
+{
+    dCSRmat B = fasp_dcsr_create(m, nnz > 0 ? m : 0, nnz);
+
+    B.col = m;
+
+    return B;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -11,12 +11,19 @@
  */
 
 #include "fasp.h"
+#include "fasp_functs.h"
+
+#define ND_MIN_SIZE 64 /**< subgraphs up to this size are not dissected further */
 
 /*---------------------------------*/
 /*--  Declare Private Functions  --*/
 /*---------------------------------*/
 
 static void CMK_ordering (const dCSRmat *, INT, INT, INT, INT, INT *, INT *);
+static INT  ND_levels (const dCSRmat *, const INT *, const INT, const INT,
+                       const INT *, INT *, INT *, INT *);
+static INT  ND_search (const dCSRmat *, const INT *, const INT, const INT,
+                       const INT *, const INT, INT *, INT *);
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -99,6 +106,98 @@ void fasp_dcsr_RCMK_order (const dCSRmat *A,
     for (i=0; i<row; ++i) rorder[i] = order[row-1-i];
 }
 
+/**
+ * \fn void fasp_dcsr_ND_order (const dCSRmat *A, INT *order)
+ *
+ * \brief Nested dissection ordering of vertices of matrix graph corresponding to A
+ *
+ * \param A       Pointer to matrix
+ * \param order   Pointer to vertices in the new order: order[i] is the old index
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each connected subgraph is split by the middle level of a level structure
+ *       rooted at a pseudo-peripheral vertex. The two parts are ordered first and
+ *       the separator last, so that eliminating one part does not fill the other.
+ *       Subgraphs with at most ND_MIN_SIZE vertices keep their natural order. The
+ *       graph of A is assumed to be structurally symmetric.
+ */
+void fasp_dcsr_ND_order (const dCSRmat *A,
+                         INT           *order)
+{
+    const INT row = A->row;
+    
+    INT *seg   = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    INT *level = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    INT *queue = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    INT *stack = (INT *)fasp_mem_calloc(2*row+2, sizeof(INT));
+    
+    INT i, v, top = 0, start, size, nlev, mid, nreach, n0, n1;
+    
+    // seg[v] is the first position of the subgraph containing v; -1 if ordered
+    for (i=0; i<row; ++i) {
+        order[i] = i;
+        seg[i]   = 0;
+    }
+    
+    stack[top++] = 0;
+    stack[top++] = row;
+    
+    while (top > 0) {
+        size  = stack[--top];
+        start = stack[--top];
+        
+        if (size <= ND_MIN_SIZE) continue;
+        
+        nlev = ND_levels(A, order+start, size, start, seg, level, queue, &nreach);
+        
+        if (nreach < size) { // disconnected: reached part first, no separator
+            mid = nlev;
+        }
+        else if (nlev >= 3) { // middle level as separator
+            mid = nlev/2;
+        }
+        else { // no separating level
+            continue;
+        }
+        
+        // stable partition: levels < mid | unreached or levels > mid | level mid
+        for (i=0; i<size; ++i) queue[i] = order[start+i];
+        
+        n0 = 0;
+        for (i=0; i<size; ++i) {
+            v = queue[i];
+            if (level[v] >= 0 && level[v] < mid) order[start+n0++] = v;
+        }
+        n1 = n0;
+        for (i=0; i<size; ++i) {
+            v = queue[i];
+            if (level[v] < 0 || level[v] > mid) {
+                order[start+n1++] = v;
+                seg[v] = start+n0;
+            }
+        }
+        for (i=0; i<size; ++i) {
+            v = queue[i];
+            if (level[v] == mid) {
+                order[start+n1++] = v;
+                seg[v] = -1;
+            }
+        }
+        
+        stack[top++] = start;
+        stack[top++] = n0;
+        stack[top++] = start+n0;
+        stack[top++] = n1-n0;
+    }
+    
+    fasp_mem_free(seg);   seg   = NULL;
+    fasp_mem_free(level); level = NULL;
+    fasp_mem_free(queue); queue = NULL;
+    fasp_mem_free(stack); stack = NULL;
+}
+
 /*---------------------------------*/
 /*--      Private Functions      --*/
 /*---------------------------------*/
@@ -119,6 +218,9 @@ void fasp_dcsr_RCMK_order (const dCSRmat *A,
  *
  * \author Zheng Li, Chensong Zhang
  * \date   05/28/2014
+ *
+ * Modified by agent on 10/18/2026: sort every group of neighbors, do not
+ *             assume diagonal first, and fix the search for the next component
  */
 static void CMK_ordering (const dCSRmat *A,
                           INT            loc,
@@ -133,7 +235,7 @@ static void CMK_ordering (const dCSRmat *A,
     const INT *ja  = A->JA;
     
     INT       i, j, sp1, k;
-    SHORT     flag = 1;
+    SHORT     flag;
     
     if (s < row) {
         order[s] = jj;
@@ -143,8 +245,8 @@ static void CMK_ordering (const dCSRmat *A,
     while (loc <= s && s < row) {
         i = order[loc];
         sp1 = s+1;
-        // neighbor nodes are priority.
-        for (j=ia[i]+1; j<ia[i+1]; ++j) {
+        // neighbor nodes are priority; i itself is skipped as ordered already
+        for (j=ia[i]; j<ia[i+1]; ++j) {
             k = ja[j];
             if (oindex[k] < 0){
                 s++;
@@ -153,6 +255,7 @@ static void CMK_ordering (const dCSRmat *A,
         }
         // ordering neighbor nodes by increasing degree
         if (s > sp1) {
+            flag = 1;
             while (flag) {
                 flag = 0;
                 for (i=sp1+1; i<=s; ++i) {
@@ -171,20 +274,13 @@ static void CMK_ordering (const dCSRmat *A,
         loc ++;
     }
     
-    // deal with remainder
-    if (s < row) {
-        jj = 0;
-        i  = 0;
-        while (jj == 0) {
-            i ++;
-            if (i >= row) {
-                mindg++;
-                i = 0;
-            }
-            if (oindex[i] < 0 && (ia[i+1]-ia[i] == mindg)) {
-                jj = i;
-            }
+    // deal with remainder: start from an unordered vertex of minimal degree
+    if (s < row-1) {
+        jj = -1;
+        for (i=0; i<row; ++i) {
+            if (oindex[i] < 0 && (jj < 0 || ia[i+1]-ia[i] < ia[jj+1]-ia[jj])) jj = i;
         }
+        mindg = ia[jj+1]-ia[jj];
         
         s ++;
         
@@ -192,6 +288,129 @@ static void CMK_ordering (const dCSRmat *A,
     }
 }
 
+/**
+ * \fn static INT ND_levels (const dCSRmat *A, const INT *verts, const INT size,
+ *                           const INT id, const INT *seg, INT *level, INT *queue,
+ *                           INT *nreach)
+ *
+ * \brief Level structure of a subgraph rooted at a pseudo-peripheral vertex
+ *
+ * \param A       Pointer to matrix
+ * \param verts   Pointer to vertices of the subgraph
+ * \param size    Number of vertices of the subgraph
+ * \param id      Subgraph index: vertex v belongs to the subgraph if seg[v] == id
+ * \param seg     Pointer to subgraph index of each vertex
+ * \param level   Pointer to level of each vertex (OUTPUT, -1 if not reached)
+ * \param queue   Pointer to work space of size at least size
+ * \param nreach  Pointer to number of reached vertices (OUTPUT)
+ *
+ * \return        Number of levels
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The root is improved a few times by restarting from a vertex of minimal
+ *       degree in the last level as long as the number of levels grows.
+ */
+static INT ND_levels (const dCSRmat *A,
+                      const INT     *verts,
+                      const INT      size,
+                      const INT      id,
+                      const INT     *seg,
+                      INT           *level,
+                      INT           *queue,
+                      INT           *nreach)
+{
+    const INT *ia = A->IA;
+    
+    INT root = verts[0], best = verts[0], nlev, maxlev = 0;
+    INT i, v, tail, iter, mindg, next;
+    
+    for (iter=0; iter<6; ++iter) {
+        tail = ND_search(A, verts, size, id, seg, root, level, queue);
+        nlev = level[queue[tail-1]]+1;
+        
+        if (iter > 0 && nlev <= maxlev) break;
+        
+        maxlev = nlev;
+        best   = root;
+        
+        // vertex of minimal degree in the last level as the next root
+        mindg = -1;
+        next  = root;
+        for (i=tail-1; i>=0 && level[queue[i]] == nlev-1; --i) {
+            v = queue[i];
+            if (mindg < 0 || ia[v+1]-ia[v] < mindg) {
+                mindg = ia[v+1]-ia[v];
+                next  = v;
+            }
+        }
+        if (next == root) break;
+        root = next;
+    }
+    
+    // levels of the last search are not from the best root
+    if (root != best) tail = ND_search(A, verts, size, id, seg, best, level, queue);
+    
+    *nreach = tail;
+    
+    return maxlev;
+}
+
+/**
+ * \fn static INT ND_search (const dCSRmat *A, const INT *verts, const INT size,
+ *                           const INT id, const INT *seg, const INT root,
+ *                           INT *level, INT *queue)
+ *
+ * \brief Breadth first search from root within a subgraph
+ *
+ * \param A       Pointer to matrix
+ * \param verts   Pointer to vertices of the subgraph
+ * \param size    Number of vertices of the subgraph
+ * \param id      Subgraph index: vertex v belongs to the subgraph if seg[v] == id
+ * \param seg     Pointer to subgraph index of each vertex
+ * \param root    Root vertex
+ * \param level   Pointer to level of each vertex (OUTPUT, -1 if not reached)
+ * \param queue   Pointer to reached vertices in the search order (OUTPUT)
+ *
+ * \return        Number of reached vertices
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT ND_search (const dCSRmat *A,
+                      const INT     *verts,
+                      const INT      size,
+                      const INT      id,
+                      const INT     *seg,
+                      const INT      root,
+                      INT           *level,
+                      INT           *queue)
+{
+    const INT *ia = A->IA;
+    const INT *ja = A->JA;
+    
+    INT i, j, k, v, head = 0, tail = 1;
+    
+    for (i=0; i<size; ++i) level[verts[i]] = -1;
+    
+    level[root] = 0;
+    queue[0]    = root;
+    
+    while (head < tail) {
+        v = queue[head++];
+        for (j=ia[v]; j<ia[v+1]; ++j) {
+            k = ja[j];
+            if (seg[k] == id && level[k] < 0) {
+                level[k] = level[v]+1;
+                queue[tail++] = k;
+            }
+        }
+    }
+    
+    return tail;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
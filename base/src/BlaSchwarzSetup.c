@@ -14,6 +14,10 @@
 
 #include <math.h>
 #include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "fasp.h"
 #include "fasp_functs.h"
 
@@ -23,6 +27,11 @@
 
 static void SWZ_level(const INT, dCSRmat*, INT*, INT*, INT*, INT*, const INT);
 static void SWZ_block(SWZ_data*, const INT, const INT*, const INT*, INT*);
+static void SWZ_solve(SWZ_data*, const INT, const INT, dvector*, dvector*, INT*,
+                      dvector*, dvector*);
+#ifdef _OPENMP
+static void SWZ_color(SWZ_data*);
+#endif
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -42,6 +51,12 @@ static void SWZ_block(SWZ_data*, const INT, const INT*, const INT*, INT*);
  * \date   03/22/2011
  *
  * Modified by Zheng Li on 10/09/2014
+ * Modified by agent on 10/18/2026: form and factorize blocks in parallel
+ *                                  and color blocks for parallel sweeps
+ *
+ * \note The level sets are found in one pass with a single mask; blocks of the
+ *       same color are then formed and factorized concurrently, sharing that
+ *       mask, so the setup work space does not grow with the number of threads.
  */
 INT fasp_swz_dcsr_setup(SWZ_data* swzdata, SWZ_param* swzparam)
 {
@@ -53,9 +68,8 @@ INT fasp_swz_dcsr_setup(SWZ_data* swzdata, SWZ_param* swzparam)
     INT maxlev    = swzparam->SWZ_maxlvl;
 
     // local variables
-    INT     i;
-    INT     inroot = -10, nsizei = -10, nsizeall = -10, nlvl = 0;
-    INT*    jb = NULL;
+    INT     i, nlvl = 0, jsize;
+    INT*    level = NULL;
     ivector MIS;
 
     // data for Schwarz method
@@ -66,71 +80,70 @@ INT fasp_swz_dcsr_setup(SWZ_data* swzdata, SWZ_param* swzparam)
     INT flag = FASP_SUCCESS;
 
     swzdata->swzparam = swzparam;
+    swzdata->ncolors  = 0;
+    swzdata->icolor   = NULL;
+    swzdata->jcolor   = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
 #endif
 
+    // select root nodes
+    MIS  = fasp_sparse_mis(&A);
+    nblk = MIS.row;
+
     // allocate memory
     maxa   = (INT*)fasp_mem_calloc(n, sizeof(INT));
     mask   = (INT*)fasp_mem_calloc(n, sizeof(INT));
-    iblock = (INT*)fasp_mem_calloc(n, sizeof(INT));
-    jblock = (INT*)fasp_mem_calloc(n, sizeof(INT));
-
-    nsizeall = 0;
-    memset(mask, 0, sizeof(INT) * n);
-    memset(iblock, 0, sizeof(INT) * n);
-    memset(maxa, 0, sizeof(INT) * n);
-
-    maxa[0] = 0;
-
-    // select root nodes
-    MIS = fasp_sparse_mis(&A);
+    iblock = (INT*)fasp_mem_calloc(nblk + 1, sizeof(INT));
+    level  = (INT*)fasp_mem_calloc(maxlev + 2, sizeof(INT));
+    jsize  = 2 * n;
+    jblock = (INT*)fasp_mem_calloc(jsize, sizeof(INT));
 
     /*-------------------------------------------*/
     // find the blocks
     /*-------------------------------------------*/
 
-    // first pass: do a maxlev level sets out for each node
-    for (i = 0; i < MIS.row; i++) {
-        inroot = MIS.val[i];
-        SWZ_level(inroot, &A, mask, &nlvl, maxa, jblock, maxlev);
-        nsizei = maxa[nlvl];
-        nsizeall += nsizei;
+    // do a maxlev level sets out for each node and store them one after another;
+    // one level set has at most n nodes, so only grow jblock if it may overflow
+    for (i = 0; i < nblk; i++) {
+        if (iblock[i] + n > jsize) {
+            jsize  = MAX(2 * jsize, iblock[i] + n);
+            jblock = (INT*)fasp_mem_realloc(jblock, jsize * sizeof(INT));
+        }
+        SWZ_level(MIS.val[i], &A, mask, &nlvl, level, jblock + iblock[i], maxlev);
+        iblock[i + 1] = iblock[i] + level[nlvl];
     }
 
+    fasp_mem_free(level);
+    level = NULL;
+    fasp_ivec_free(&MIS);
+
 #if DEBUG_MODE > 1
-    printf("### DEBUG: nsizeall = %d\n", nsizeall);
+    printf("### DEBUG: nsizeall = %d\n", iblock[nblk]);
 #endif
 
-    // calculated the size of jblock up to here
-    jblock = (INT*)fasp_mem_realloc(jblock, (nsizeall + n) * sizeof(INT));
-
-    // second pass: redo the same again, but this time we store in jblock
-    maxa[0]   = 0;
-    iblock[0] = 0;
-    nsizeall  = 0;
-    jb        = jblock;
-    for (i = 0; i < MIS.row; i++) {
-        inroot = MIS.val[i];
-        SWZ_level(inroot, &A, mask, &nlvl, maxa, jb, maxlev);
-        nsizei        = maxa[nlvl];
-        iblock[i + 1] = iblock[i] + nsizei;
-        nsizeall += nsizei;
-        jb += nsizei;
-    }
-    nblk = MIS.row;
+    swzdata->nblk     = nblk;
+    swzdata->iblock   = iblock;
+    swzdata->jblock   = jblock;
+    swzdata->mask     = mask;
+    swzdata->maxa     = maxa;
+    swzdata->SWZ_type = swzparam->SWZ_type;
+
+#ifdef _OPENMP
+    // color the blocks for parallel setup and sweeps (MUMPS is not thread-safe)
+    if (fasp_get_num_threads() > 1 && nblk > 1 && blksolver != SOLVER_MUMPS)
+        SWZ_color(swzdata);
+#endif
 
 #if DEBUG_MODE > 1
-    printf("### DEBUG: nsizeall = %d, %d\n", nsizeall, iblock[nblk]);
+    printf("### DEBUG: #colors = %d\n", swzdata->ncolors);
 #endif
 
     /*-------------------------------------------*/
     //  LU decomposition of blocks
     /*-------------------------------------------*/
 
-    memset(mask, 0, sizeof(INT) * n);
-
     swzdata->blk_data = (dCSRmat*)fasp_mem_calloc(nblk, sizeof(dCSRmat));
 
     SWZ_block(swzdata, nblk, iblock, jblock, mask);
@@ -159,15 +172,18 @@ INT fasp_swz_dcsr_setup(SWZ_data* swzdata, SWZ_param* swzparam)
                 /* use UMFPACK direct solver on each block */
                 dCSRmat* blk     = swzdata->blk_data;
                 void**   numeric = (void**)fasp_mem_calloc(nblk, sizeof(void*));
-                dCSRmat  Ac_tran;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) private(i) if (nblk > 1)
+#endif
                 for (i = 0; i < nblk; ++i) {
-                    Ac_tran = fasp_dcsr_create(blk[i].row, blk[i].col, blk[i].nnz);
+                    dCSRmat Ac_tran =
+                        fasp_dcsr_create(blk[i].row, blk[i].col, blk[i].nnz);
                     fasp_dcsr_transz(&blk[i], NULL, &Ac_tran);
                     fasp_dcsr_cp(&Ac_tran, &blk[i]);
                     numeric[i] = fasp_umfpack_factorize(&blk[i], 0);
+                    fasp_dcsr_free(&Ac_tran);
                 }
                 swzdata->numeric = numeric;
-                fasp_dcsr_free(&Ac_tran);
 
                 break;
             }
@@ -187,13 +203,6 @@ INT fasp_swz_dcsr_setup(SWZ_data* swzdata, SWZ_param* swzparam)
     /*-------------------------------------------*/
     //  return
     /*-------------------------------------------*/
-    swzdata->nblk     = nblk;
-    swzdata->iblock   = iblock;
-    swzdata->jblock   = jblock;
-    swzdata->mask     = mask;
-    swzdata->maxa     = maxa;
-    swzdata->SWZ_type = swzparam->SWZ_type;
-
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
@@ -214,100 +223,52 @@ INT fasp_swz_dcsr_setup(SWZ_data* swzdata, SWZ_param* swzparam)
  *
  * \author Zheng Li, Chensong Zhang
  * \date   2014/10/5
+ *
+ * Modified by agent on 10/18/2026: sweep colors of blocks in parallel
  */
 void fasp_dcsr_swz_forward(SWZ_data* swzdata, SWZ_param* swzparam, dvector* x,
                            dvector* b)
 {
-    INT i, j, iblk, ki, kj, kij, is, ibl0, ibl1, nloc, iaa, iab;
+    INT is;
 
     // Schwarz partition
-    INT      nblk      = swzdata->nblk;
-    dCSRmat* blk       = swzdata->blk_data;
-    INT*     iblock    = swzdata->iblock;
-    INT*     jblock    = swzdata->jblock;
-    INT*     mask      = swzdata->mask;
-    INT      blksolver = swzparam->SWZ_blksolver;
-
-    // Schwarz data
-    dCSRmat A   = swzdata->A;
-    INT*    ia  = A.IA;
-    INT*    ja  = A.JA;
-    REAL*   val = A.val;
-
-    // Local solution and right hand vectors
-    dvector rhs = swzdata->rhsloc1;
-    dvector u   = swzdata->xloc1;
-
-#if WITH_UMFPACK
-    void** numeric = swzdata->numeric;
-#endif
-
-#if WITH_MUMPS
-    Mumps_data* mumps = swzdata->mumps;
-#endif
-
-    for (is = 0; is < nblk; ++is) {
-        // Form the right hand of eack block
-        ibl0 = iblock[is];
-        ibl1 = iblock[is + 1];
-        nloc = ibl1 - ibl0;
-        for (i = 0; i < nloc; ++i) {
-            iblk     = ibl0 + i;
-            ki       = jblock[iblk];
-            mask[ki] = i + 1;
-        }
-
-        for (i = 0; i < nloc; ++i) {
-            iblk       = ibl0 + i;
-            ki         = jblock[iblk];
-            rhs.val[i] = b->val[ki];
-            iaa        = ia[ki] - 1;
-            iab        = ia[ki + 1] - 1;
-            for (kij = iaa; kij < iab; ++kij) {
-                kj = ja[kij] - 1;
-                j  = mask[kj];
-                if (j == 0) {
-                    rhs.val[i] -= val[kij] * x->val[kj];
+    INT  nblk      = swzdata->nblk;
+    INT* mask      = swzdata->mask;
+    INT  blksolver = swzparam->SWZ_blksolver;
+
+#ifdef _OPENMP
+    if (swzdata->ncolors > 0) {
+        const INT  ncolors  = swzdata->ncolors;
+        const INT* icolor   = swzdata->icolor;
+        const INT* jcolor   = swzdata->jcolor;
+        const INT  maxbs    = swzdata->maxbs;
+        const INT  nthreads = swzdata->memt / maxbs;
+
+#pragma omp parallel private(is) num_threads(nthreads)
+        {
+            // local solution and right hand vectors of this thread
+            const INT myid = omp_get_thread_num();
+            dvector   rhs  = {maxbs, swzdata->rhsloc1.val + myid * maxbs};
+            dvector   u    = {maxbs, swzdata->xloc1.val + myid * maxbs};
+            INT       c, k;
+
+            // blocks of the same color do not share vertices or neighbors
+            for (c = 0; c < ncolors; ++c) {
+#pragma omp for schedule(dynamic)
+                for (k = icolor[c]; k < icolor[c + 1]; ++k) {
+                    is = jcolor[k];
+                    SWZ_solve(swzdata, blksolver, is, x, b, mask, &rhs, &u);
                 }
             }
         }
 
-        // Solve each block
-        switch (blksolver) {
-
-#if WITH_MUMPS
-            case SOLVER_MUMPS:
-                {
-                    /* use MUMPS direct solver on each block */
-                    fasp_mumps_solve(&blk[is], &rhs, &u, mumps[is], 0);
-                    break;
-                }
-#endif
-
-#if WITH_UMFPACK
-            case SOLVER_UMFPACK:
-                {
-                    /* use UMFPACK direct solver on each block */
-                    fasp_umfpack_solve(&blk[is], &rhs, &u, numeric[is], 0);
-                    break;
-                }
+        return;
+    }
 #endif
-            default:
-                /* use iterative solver on each block */
-                u.row   = blk[is].row;
-                rhs.row = blk[is].row;
-                fasp_dvec_set(u.row, &u, 0);
-                fasp_solver_dcsr_pvgmres(&blk[is], &rhs, &u, NULL, 1e-8, 1e-20, 100, 20,
-                                         1, 0);
-        }
 
-        // zero the mask so that everyting is as it was
-        for (i = 0; i < nloc; ++i) {
-            iblk       = ibl0 + i;
-            ki         = jblock[iblk];
-            mask[ki]   = 0;
-            x->val[ki] = u.val[i];
-        }
+    for (is = 0; is < nblk; ++is) {
+        SWZ_solve(swzdata, blksolver, is, x, b, mask, &swzdata->rhsloc1,
+                  &swzdata->xloc1);
     }
 }
 
@@ -324,100 +285,52 @@ void fasp_dcsr_swz_forward(SWZ_data* swzdata, SWZ_param* swzparam, dvector* x,
  *
  * \author Zheng Li, Chensong Zhang
  * \date   2014/10/5
+ *
+ * Modified by agent on 10/18/2026: sweep colors of blocks in parallel
  */
 void fasp_dcsr_swz_backward(SWZ_data* swzdata, SWZ_param* swzparam, dvector* x,
                             dvector* b)
 {
-    INT i, j, iblk, ki, kj, kij, is, ibl0, ibl1, nloc, iaa, iab;
+    INT is;
 
     // Schwarz partition
-    INT      nblk      = swzdata->nblk;
-    dCSRmat* blk       = swzdata->blk_data;
-    INT*     iblock    = swzdata->iblock;
-    INT*     jblock    = swzdata->jblock;
-    INT*     mask      = swzdata->mask;
-    INT      blksolver = swzparam->SWZ_blksolver;
-
-    // Schwarz data
-    dCSRmat A   = swzdata->A;
-    INT*    ia  = A.IA;
-    INT*    ja  = A.JA;
-    REAL*   val = A.val;
-
-    // Local solution and right hand vectors
-    dvector rhs = swzdata->rhsloc1;
-    dvector u   = swzdata->xloc1;
-
-#if WITH_UMFPACK
-    void** numeric = swzdata->numeric;
-#endif
-
-#if WITH_MUMPS
-    Mumps_data* mumps = swzdata->mumps;
-#endif
-
-    for (is = nblk - 1; is >= 0; --is) {
-        // Form the right hand of eack block
-        ibl0 = iblock[is];
-        ibl1 = iblock[is + 1];
-        nloc = ibl1 - ibl0;
-        for (i = 0; i < nloc; ++i) {
-            iblk     = ibl0 + i;
-            ki       = jblock[iblk];
-            mask[ki] = i + 1;
-        }
-
-        for (i = 0; i < nloc; ++i) {
-            iblk       = ibl0 + i;
-            ki         = jblock[iblk];
-            rhs.val[i] = b->val[ki];
-            iaa        = ia[ki] - 1;
-            iab        = ia[ki + 1] - 1;
-            for (kij = iaa; kij < iab; ++kij) {
-                kj = ja[kij] - 1;
-                j  = mask[kj];
-                if (j == 0) {
-                    rhs.val[i] -= val[kij] * x->val[kj];
+    INT  nblk      = swzdata->nblk;
+    INT* mask      = swzdata->mask;
+    INT  blksolver = swzparam->SWZ_blksolver;
+
+#ifdef _OPENMP
+    if (swzdata->ncolors > 0) {
+        const INT  ncolors  = swzdata->ncolors;
+        const INT* icolor   = swzdata->icolor;
+        const INT* jcolor   = swzdata->jcolor;
+        const INT  maxbs    = swzdata->maxbs;
+        const INT  nthreads = swzdata->memt / maxbs;
+
+#pragma omp parallel private(is) num_threads(nthreads)
+        {
+            // local solution and right hand vectors of this thread
+            const INT myid = omp_get_thread_num();
+            dvector   rhs  = {maxbs, swzdata->rhsloc1.val + myid * maxbs};
+            dvector   u    = {maxbs, swzdata->xloc1.val + myid * maxbs};
+            INT       c, k;
+
+            // blocks of the same color do not share vertices or neighbors
+            for (c = ncolors - 1; c >= 0; --c) {
+#pragma omp for schedule(dynamic)
+                for (k = icolor[c + 1] - 1; k >= icolor[c]; --k) {
+                    is = jcolor[k];
+                    SWZ_solve(swzdata, blksolver, is, x, b, mask, &rhs, &u);
                 }
             }
         }
 
-        // Solve each block
-        switch (blksolver) {
-
-#if WITH_MUMPS
-            case SOLVER_MUMPS:
-                {
-                    /* use MUMPS direct solver on each block */
-                    fasp_mumps_solve(&blk[is], &rhs, &u, mumps[is], 0);
-                    break;
-                }
-#endif
-
-#if WITH_UMFPACK
-            case SOLVER_UMFPACK:
-                {
-                    /* use UMFPACK direct solver on each block */
-                    fasp_umfpack_solve(&blk[is], &rhs, &u, numeric[is], 0);
-                    break;
-                }
+        return;
+    }
 #endif
-            default:
-                /* use iterative solver on each block */
-                rhs.row = blk[is].row;
-                u.row   = blk[is].row;
-                fasp_dvec_set(u.row, &u, 0);
-                fasp_solver_dcsr_pvgmres(&blk[is], &rhs, &u, NULL, 1e-8, 1e-20, 100, 20,
-                                         1, 0);
-        }
 
-        // zero the mask so that everyting is as it was
-        for (i = 0; i < nloc; ++i) {
-            iblk       = ibl0 + i;
-            ki         = jblock[iblk];
-            mask[ki]   = 0;
-            x->val[ki] = u.val[i];
-        }
+    for (is = nblk - 1; is >= 0; --is) {
+        SWZ_solve(swzdata, blksolver, is, x, b, mask, &swzdata->rhsloc1,
+                  &swzdata->xloc1);
     }
 }
 
@@ -517,16 +430,26 @@ static void SWZ_level(const INT inroot, dCSRmat* A, INT* mask, INT* nlvl, INT* i
  *
  * \author Zheng Li, Chensong Zhang
  * \date   2014/09/29
+ *
+ * Modified by agent on 10/18/2026: form blocks of each color in parallel
+ *
+ * \note Blocks of the same color share neither vertices nor neighbors, so they
+ *       are formed concurrently with the same mask. The local vectors rhsloc1
+ *       and xloc1 hold maxbs entries for each thread of the colored sweeps.
  */
 static void SWZ_block(SWZ_data* swzdata, const INT nblk, const INT* iblock,
                       const INT* jblock, INT* mask)
 {
     INT i, j, iblk, ki, kj, kij, is, ibl0, ibl1, nloc, iaa, iab;
-    INT maxbs = 0, count, nnz;
+    INT maxbs = 0, count, nnz, c, k, kbeg, kend, nthreads = 1;
 
     dCSRmat  A   = swzdata->A;
     dCSRmat* blk = swzdata->blk_data;
 
+    const INT  ncolors = swzdata->ncolors;
+    const INT* icolor  = swzdata->icolor;
+    const INT* jcolor  = swzdata->jcolor;
+
     INT*  ia  = A.IA;
     INT*  ja  = A.JA;
     REAL* val = A.val;
@@ -539,58 +462,263 @@ static void SWZ_block(SWZ_data* swzdata, const INT nblk, const INT* iblock,
         maxbs = MAX(maxbs, nloc);
     }
 
+#ifdef _OPENMP
+    if (ncolors > 0) nthreads = fasp_get_num_threads();
+#endif
+
     swzdata->maxbs = maxbs;
+    swzdata->memt  = maxbs * nthreads;
 
     // allocate memory for each sub_block's right hand
-    swzdata->xloc1   = fasp_dvec_create(maxbs);
-    swzdata->rhsloc1 = fasp_dvec_create(maxbs);
+    swzdata->xloc1   = fasp_dvec_create(swzdata->memt);
+    swzdata->rhsloc1 = fasp_dvec_create(swzdata->memt);
+
+    // without colors, all blocks are formed one by one as a single color
+    for (c = 0; c < MAX(ncolors, 1); ++c) {
+        kbeg = (ncolors > 0) ? icolor[c] : 0;
+        kend = (ncolors > 0) ? icolor[c + 1] : nblk;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) private(                               \
+        i, j, iblk, ki, kj, kij, is, ibl0, ibl1, nloc, iaa, iab, count, nnz)          \
+    if (ncolors > 0)
+#endif
+        for (k = kbeg; k < kend; ++k) {
+            is    = (ncolors > 0) ? jcolor[k] : k;
+            ibl0  = iblock[is];
+            ibl1  = iblock[is + 1];
+            nloc  = ibl1 - ibl0;
+            count = 0;
+            for (i = 0; i < nloc; ++i) {
+                iblk = ibl0 + i;
+                ki   = jblock[iblk];
+                iaa  = ia[ki] - 1;
+                iab  = ia[ki + 1] - 1;
+                count += iab - iaa;
+                mask[ki] = i + 1;
+            }
 
-    for (is = 0; is < nblk; ++is) {
-        ibl0  = iblock[is];
-        ibl1  = iblock[is + 1];
-        nloc  = ibl1 - ibl0;
-        count = 0;
-        for (i = 0; i < nloc; ++i) {
-            iblk = ibl0 + i;
-            ki   = jblock[iblk];
-            iaa  = ia[ki] - 1;
-            iab  = ia[ki + 1] - 1;
-            count += iab - iaa;
-            mask[ki] = i + 1;
+            blk[is]       = fasp_dcsr_create(nloc, nloc, count);
+            blk[is].IA[0] = 0;
+            nnz           = 0;
+
+            for (i = 0; i < nloc; ++i) {
+                iblk = ibl0 + i;
+                ki   = jblock[iblk];
+                iaa  = ia[ki] - 1;
+                iab  = ia[ki + 1] - 1;
+                for (kij = iaa; kij < iab; ++kij) {
+                    kj = ja[kij] - 1;
+                    j  = mask[kj];
+                    if (j != 0) {
+                        blk[is].JA[nnz]  = j - 1;
+                        blk[is].val[nnz] = val[kij];
+                        nnz++;
+                    }
+                }
+                blk[is].IA[i + 1] = nnz;
+            }
+
+            blk[is].nnz = nnz;
+
+            // zero the mask so that everyting is as it was
+            for (i = 0; i < nloc; ++i) {
+                iblk     = ibl0 + i;
+                ki       = jblock[iblk];
+                mask[ki] = 0;
+            }
         }
+    }
+}
 
-        blk[is]       = fasp_dcsr_create(nloc, nloc, count);
-        blk[is].IA[0] = 0;
-        nnz           = 0;
-
-        for (i = 0; i < nloc; ++i) {
-            iblk = ibl0 + i;
-            ki   = jblock[iblk];
-            iaa  = ia[ki] - 1;
-            iab  = ia[ki + 1] - 1;
-            for (kij = iaa; kij < iab; ++kij) {
-                kj = ja[kij] - 1;
-                j  = mask[kj];
-                if (j != 0) {
-                    blk[is].JA[nnz]  = j - 1;
-                    blk[is].val[nnz] = val[kij];
-                    nnz++;
-                }
+/**
+ * \fn static void SWZ_solve (SWZ_data *swzdata, const INT blksolver, const INT is,
+ *                            dvector *x, dvector *b, INT *mask, dvector *rhs,
+ *                            dvector *u)
+ *
+ * \brief Solve one block of the Schwarz partition and update the solution
+ *
+ * \param swzdata    Pointer to the Schwarz data
+ * \param blksolver  Solver for the blocks
+ * \param is         Index of the block
+ * \param x          Pointer to solution vector
+ * \param b          Pointer to right hand
+ * \param mask       Pointer to flag array
+ * \param rhs        Pointer to local right hand vector (at least maxbs)
+ * \param u          Pointer to local solution vector (at least maxbs)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Blocks sharing neither vertices nor neighbors can be solved concurrently
+ *       with the same mask, as long as each thread has its own rhs and u.
+ */
+static void SWZ_solve(SWZ_data* swzdata, const INT blksolver, const INT is,
+                      dvector* x, dvector* b, INT* mask, dvector* rhs, dvector* u)
+{
+    INT i, j, iblk, ki, kj, kij, iaa, iab;
+
+    // Schwarz partition
+    dCSRmat*   blk    = swzdata->blk_data;
+    const INT* iblock = swzdata->iblock;
+    const INT* jblock = swzdata->jblock;
+
+    // Schwarz data
+    const INT*  ia  = swzdata->A.IA;
+    const INT*  ja  = swzdata->A.JA;
+    const REAL* val = swzdata->A.val;
+
+    const INT ibl0 = iblock[is];
+    const INT nloc = iblock[is + 1] - ibl0;
+
+    // Form the right hand of eack block
+    for (i = 0; i < nloc; ++i) {
+        iblk     = ibl0 + i;
+        ki       = jblock[iblk];
+        mask[ki] = i + 1;
+    }
+
+    for (i = 0; i < nloc; ++i) {
+        iblk        = ibl0 + i;
+        ki          = jblock[iblk];
+        rhs->val[i] = b->val[ki];
+        iaa         = ia[ki] - 1;
+        iab         = ia[ki + 1] - 1;
+        for (kij = iaa; kij < iab; ++kij) {
+            kj = ja[kij] - 1;
+            j  = mask[kj];
+            if (j == 0) {
+                rhs->val[i] -= val[kij] * x->val[kj];
             }
-            blk[is].IA[i + 1] = nnz;
         }
+    }
 
-        blk[is].nnz = nnz;
+    // Solve each block
+    switch (blksolver) {
 
-        // zero the mask so that everyting is as it was
-        for (i = 0; i < nloc; ++i) {
-            iblk     = ibl0 + i;
-            ki       = jblock[iblk];
-            mask[ki] = 0;
+#if WITH_MUMPS
+        case SOLVER_MUMPS:
+            {
+                /* use MUMPS direct solver on each block */
+                fasp_mumps_solve(&blk[is], rhs, u, swzdata->mumps[is], 0);
+                break;
+            }
+#endif
+
+#if WITH_UMFPACK
+        case SOLVER_UMFPACK:
+            {
+                /* use UMFPACK direct solver on each block */
+                fasp_umfpack_solve(&blk[is], rhs, u, swzdata->numeric[is], 0);
+                break;
+            }
+#endif
+        default:
+            /* use iterative solver on each block */
+            u->row   = blk[is].row;
+            rhs->row = blk[is].row;
+            fasp_dvec_set(u->row, u, 0);
+            fasp_solver_dcsr_pvgmres(&blk[is], rhs, u, NULL, 1e-8, 1e-20, 100, 20, 1,
+                                     0);
+    }
+
+    // zero the mask so that everyting is as it was
+    for (i = 0; i < nloc; ++i) {
+        iblk       = ibl0 + i;
+        ki         = jblock[iblk];
+        mask[ki]   = 0;
+        x->val[ki] = u->val[i];
+    }
+}
+
+#ifdef _OPENMP
+
+/**
+ * \fn static void SWZ_color (SWZ_data *swzdata)
+ *
+ * \brief Color the blocks so that blocks of the same color can be solved in parallel
+ *
+ * \param swzdata  Pointer to the Schwarz data
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Two blocks get different colors if one contains a vertex or a neighbor of
+ *       the other. The pattern of A is assumed symmetric (swzdata->A is the
+ *       symmetric part of the coarse matrix). Blocks are colored greedily in
+ *       their natural order and kept in that order within each color.
+ */
+static void SWZ_color(SWZ_data* swzdata)
+{
+    const INT  n      = swzdata->A.row;
+    const INT  nblk   = swzdata->nblk;
+    const INT* ia     = swzdata->A.IA;
+    const INT* ja     = swzdata->A.JA;
+    const INT* iblock = swzdata->iblock;
+    const INT* jblock = swzdata->jblock;
+
+    INT i, j, k, v, w, c, ncolors = 0;
+
+    // blocks containing each vertex
+    INT* iw    = (INT*)fasp_mem_calloc(n + 1, sizeof(INT));
+    INT* jw    = (INT*)fasp_mem_calloc(iblock[nblk], sizeof(INT));
+    INT* color = (INT*)fasp_mem_calloc(nblk, sizeof(INT));
+    INT* used  = (INT*)fasp_mem_calloc(nblk + 1, sizeof(INT));
+    INT* icolor;
+    INT* jcolor;
+
+    for (k = 0; k < iblock[nblk]; ++k) iw[jblock[k] + 1]++;
+    for (i = 0; i < n; ++i) iw[i + 1] += iw[i];
+    for (j = 0; j < nblk; ++j) {
+        for (k = iblock[j]; k < iblock[j + 1]; ++k) jw[iw[jblock[k]]++] = j;
+    }
+    for (i = n; i > 0; --i) iw[i] = iw[i - 1];
+    iw[0] = 0;
+
+    // greedy coloring: forbid colors of blocks touching V_j and its neighbors
+    for (c = 0; c <= nblk; ++c) used[c] = -1;
+    for (j = 0; j < nblk; ++j) {
+        for (k = iblock[j]; k < iblock[j + 1]; ++k) {
+            v = jblock[k];
+            for (i = ia[v] - 1; i < ia[v + 1] - 1; ++i) {
+                w = ja[i] - 1;
+                for (c = iw[w]; c < iw[w + 1]; ++c) {
+                    if (jw[c] < j) used[color[jw[c]]] = j;
+                }
+            }
+            // the vertex itself in case the diagonal entry is not stored
+            for (c = iw[v]; c < iw[v + 1]; ++c) {
+                if (jw[c] < j) used[color[jw[c]]] = j;
+            }
         }
+        for (c = 0; used[c] == j; ++c)
+            ;
+        color[j] = c;
+        ncolors  = MAX(ncolors, c + 1);
     }
+
+    // group blocks by color
+    icolor = (INT*)fasp_mem_calloc(ncolors + 1, sizeof(INT));
+    jcolor = (INT*)fasp_mem_calloc(nblk, sizeof(INT));
+
+    for (j = 0; j < nblk; ++j) icolor[color[j] + 1]++;
+    for (c = 0; c < ncolors; ++c) icolor[c + 1] += icolor[c];
+    for (j = 0; j < nblk; ++j) jcolor[icolor[color[j]]++] = j;
+    for (c = ncolors; c > 0; --c) icolor[c] = icolor[c - 1];
+    icolor[0] = 0;
+
+    swzdata->ncolors = ncolors;
+    swzdata->icolor  = icolor;
+    swzdata->jcolor  = jcolor;
+
+    fasp_mem_free(iw);
+    fasp_mem_free(jw);
+    fasp_mem_free(color);
+    fasp_mem_free(used);
 }
 
+#endif
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -11,9 +11,12 @@
  */
 
 #include <math.h>
+#include <string.h>
 
 #include "fasp.h"
 
+#define LU_BLK_SIZE 64 /**< panel width of the blocked LU decomposition */
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -149,6 +152,154 @@ SHORT fasp_smat_lu_solve (const REAL  *A,
     return FASP_SUCCESS;
 }
 
+/**
+ * \fn SHORT fasp_smat_lu_decomp_blk (REAL *A, INT pivot[], const INT n)
+ *
+ * \brief Blocked LU decomposition of A with partial pivoting
+ *
+ * \param A       Pointer to the full matrix (row-major, overwritten by L and U)
+ * \param pivot   Pivoting positions: row k has been interchanged with row pivot[k]
+ * \param n       Size of matrix A
+ *
+ * \return        FASP_SUCCESS if successed; ERROR_SOLVER_EXIT if A is (numerically)
+ *                singular
+ *
+ * \note
+ * Right-looking LU with panels of LU_BLK_SIZE columns: a panel is factorized with
+ * partial pivoting, the corresponding block row of U is formed, and the trailing
+ * matrix is updated row by row (in parallel if n is large). The unit lower
+ * triangular L and the upper triangular U replace A. Unlike fasp_smat_lu_decomp,
+ * this routine is meant for the medium-sized dense matrices on the coarsest level.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+SHORT fasp_smat_lu_decomp_blk (REAL       *A,
+                               INT         pivot[],
+                               const INT   n)
+{
+    const INT nb = LU_BLK_SIZE;
+
+    INT   i, j, k, p, kb, kend;
+    REAL  amax = 0.0, piv, lik, tmp;
+    REAL *rowi, *rowk;
+
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if ( n > LU_BLK_SIZE * 4 ) use_openmp = TRUE;
+#endif
+
+    for ( i = 0; i < n * n; ++i ) amax = MAX(amax, fabs(A[i]));
+    if ( amax <= SMALLREAL ) return ERROR_SOLVER_EXIT;
+
+    for ( kb = 0; kb < n; kb += nb ) {
+
+        kend = MIN(kb + nb, n);
+
+        // 1. Factorize the panel A[kb:n, kb:kend] with partial pivoting
+        for ( k = kb; k < kend; ++k ) {
+
+            rowk = A + k * n;
+
+            // find the pivot row and interchange whole rows
+            for ( p = k, piv = fabs(rowk[k]), i = k + 1; i < n; ++i ) {
+                if ( fabs(A[i * n + k]) > piv ) { piv = fabs(A[i * n + k]); p = i; }
+            }
+            pivot[k] = p;
+
+            if ( p != k ) {
+                rowi = A + p * n;
+                for ( j = 0; j < n; ++j ) {
+                    tmp = rowk[j]; rowk[j] = rowi[j]; rowi[j] = tmp;
+                }
+            }
+
+            // relative test for singular matrices
+            if ( piv <= 1e-12 * amax ) return ERROR_SOLVER_EXIT;
+
+            for ( i = k + 1; i < n; ++i ) {
+                rowi     = A + i * n;
+                lik      = rowi[k] / rowk[k];
+                rowi[k]  = lik;
+                for ( j = k + 1; j < kend; ++j ) rowi[j] -= lik * rowk[j];
+            }
+        }
+
+        if ( kend == n ) break;
+
+        // 2. Block row of U: U12 = L11^{-1} A12
+        for ( i = kb + 1; i < kend; ++i ) {
+            rowi = A + i * n;
+            for ( k = kb; k < i; ++k ) {
+                lik  = rowi[k];
+                rowk = A + k * n;
+                for ( j = kend; j < n; ++j ) rowi[j] -= lik * rowk[j];
+            }
+        }
+
+        // 3. Update the trailing matrix: A22 = A22 - L21 * U12
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, lik, rowi, rowk) if (use_openmp)
+#endif
+        for ( i = kend; i < n; ++i ) {
+            rowi = A + i * n;
+            for ( k = kb; k < kend; ++k ) {
+                lik  = rowi[k];
+                if ( lik == 0.0 ) continue;
+                rowk = A + k * n;
+                for ( j = kend; j < n; ++j ) rowi[j] -= lik * rowk[j];
+            }
+        }
+    }
+
+    return FASP_SUCCESS;
+}
+
+/**
+ * \fn void fasp_smat_lu_solve_blk (const REAL *LU, const INT pivot[],
+ *                                  const REAL b[], REAL x[], const INT n)
+ *
+ * \brief Solve Ax=b with the LU factors from fasp_smat_lu_decomp_blk
+ *
+ * \param LU     Pointer to the LU factors of A
+ * \param pivot  Pivoting positions
+ * \param b      Right hand side array (not changed)
+ * \param x      Pointer to the solution array
+ * \param n      Size of matrix A
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_smat_lu_solve_blk (const REAL  *LU,
+                             const INT    pivot[],
+                             const REAL   b[],
+                             REAL         x[],
+                             const INT    n)
+{
+    INT         i, j;
+    REAL        sum;
+    const REAL *rowi;
+
+    if ( x != b ) memcpy(x, b, n * sizeof(REAL));
+
+    // apply the row interchanges
+    for ( i = 0; i < n; ++i ) {
+        if ( pivot[i] != i ) { sum = x[i]; x[i] = x[pivot[i]]; x[pivot[i]] = sum; }
+    }
+
+    // solve Ly = Pb
+    for ( i = 1, rowi = LU + n; i < n; ++i, rowi += n ) {
+        for ( sum = x[i], j = 0; j < i; ++j ) sum -= rowi[j] * x[j];
+        x[i] = sum;
+    }
+
+    // solve Ux = y
+    for ( i = n - 1, rowi = LU + (n - 1) * n; i >= 0; --i, rowi -= n ) {
+        for ( sum = x[i], j = i + 1; j < n; ++j ) sum -= rowi[j] * x[j];
+        x[i] = sum / rowi[i];
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -0,0 +1,719 @@
+/*! \file  BlaSpGEMM.c
+ *
+ *  \brief Sparse matrix-matrix multiplication engine for CSR and BSR matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxMemory.c, AuxThreads.c, BlaArray.c, and BlaSmallMat.c
+ *
+ *  \note  Products C = R*A*P and C = R*P are computed row by row in two runs:
+ *         a symbolic run gives the exact number of nonzeros of each row of C,
+ *         and a numeric run fills in JA and val. The intermediate product R*A is
+ *         never formed. Each row of C is accumulated in a small hash table, or
+ *         in a dense array of length col if an upper bound of its length is
+ *         larger than col/SPGEMM_DENSE.
+ *
+ *  \note  Work space: each thread keeps a marker over the rows of P (the fine
+ *         level size for Galerkin products) to skip rows of P reached twice, and
+ *         the dense array (col) once a dense row shows up. So the work space is
+ *         O(mid+col) per thread and O((mid+col)*nthreads) in total; the hash
+ *         tables and column lists only grow with the longest sparse row of C.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+#define SPGEMM_CHUNK   64 /**< rows per chunk of the dynamic schedule */
+#define SPGEMM_DENSE   1024 /**< dense accumulator if row bound > col/SPGEMM_DENSE */
+#define SPGEMM_HASHMIN 16 /**< minimal size of the hash table */
+
+/**
+ * \struct spgemm_fac
+ * \brief One factor of a sparse product (val = NULL: unit entries or blocks)
+ */
+typedef struct {
+    const INT*  IA;  /**< row pointers */
+    const INT*  JA;  /**< column indices */
+    const REAL* val; /**< nonzero entries */
+    const INT*  map; /**< positions of the entries in val (NULL: in order; CSR only) */
+} spgemm_fac;
+
+/**
+ * \struct spgemm_acc
+ * \brief Thread-local row accumulator of the SpGEMM engine
+ */
+typedef struct {
+    INT   col;   /**< number of columns of C */
+    INT*  lmark; /**< last row of C which reached each row of P */
+    INT*  list;  /**< hash: column indices of the current row in the symbolic run */
+    INT   base;  /**< dense: number of entries in the rows done by this thread */
+    INT*  pos;   /**< dense: base plus position of each column in its row */
+    INT   hcap;  /**< hash: allocated size of the table */
+    INT*  hkey;  /**< hash: column indices, -1 for empty slots */
+    INT*  hpos;  /**< hash: position of each column in the current row */
+    REAL* tmp;   /**< small block work space */
+} spgemm_acc;
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static void spgemm_run(const INT, const INT, const INT, const INT, const spgemm_fac*,
+                       const spgemm_fac*, const spgemm_fac*, const SHORT, INT**,
+                       INT**, REAL**);
+static void spgemm_acc_init(spgemm_acc*, const INT, const INT, const INT);
+static void spgemm_acc_free(spgemm_acc*);
+static INT  spgemm_acc_row(spgemm_acc*, const INT);
+static INT  spgemm_symbolic_row(const INT, const SHORT, const spgemm_fac*,
+                                const spgemm_fac*, const spgemm_fac*, const INT,
+                                spgemm_acc*);
+static void spgemm_numeric_row(const INT, const SHORT, const spgemm_fac*,
+                               const spgemm_fac*, const spgemm_fac*, const INT,
+                               spgemm_acc*, INT*, REAL*);
+static void spgemm_numeric_row_blk(const INT, const INT, const SHORT,
+                                   const spgemm_fac*, const spgemm_fac*,
+                                   const spgemm_fac*, const INT, spgemm_acc*, INT*,
+                                   REAL*);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_blas_spgemm (const INT row, const INT col, const INT mid,
+ *                            const INT nb, const INT *ir, const INT *jr,
+ *                            const REAL *rj,
+ *                            const INT *ia, const INT *ja, const REAL *aj,
+ *                            const INT *ip, const INT *jp, const REAL *pj,
+ *                            const SHORT diag, INT **iac, INT **jac, REAL **acj)
+ *
+ * \brief Sparse matrix product C = R*A*P (or C = R*P if ia is NULL)
+ *
+ * \param row    Number of (block) rows of R and C
+ * \param col    Number of (block) columns of P and C
+ * \param mid    Number of (block) rows of P
+ * \param nb     Size of the small blocks (1 for CSR matrices)
+ * \param ir     Row pointers of R
+ * \param jr     Column indices of R
+ * \param rj     Entries of R (NULL: all entries are 1 or identity blocks)
+ * \param ia     Row pointers of A (NULL: A is the identity)
+ * \param ja     Column indices of A
+ * \param aj     Entries of A (NULL: all entries are 1 or identity blocks)
+ * \param ip     Row pointers of P
+ * \param jp     Column indices of P
+ * \param pj     Entries of P (NULL: all entries are 1 or identity blocks)
+ * \param diag   Store the diagonal entry first in each row of C if TRUE
+ * \param iac    Pointer to the row pointers of C (output)
+ * \param jac    Pointer to the column indices of C (output)
+ * \param acj    Pointer to the entries of C (output)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Rows are distributed to threads with a dynamic schedule, so a few long
+ *       rows do not stall the others. Within each row, the columns of C appear
+ *       in the order they are first reached, as in the SMMP algorithm.
+ */
+void fasp_blas_spgemm(const INT   row,
+                      const INT   col,
+                      const INT   mid,
+                      const INT   nb,
+                      const INT*  ir,
+                      const INT*  jr,
+                      const REAL* rj,
+                      const INT*  ia,
+                      const INT*  ja,
+                      const REAL* aj,
+                      const INT*  ip,
+                      const INT*  jp,
+                      const REAL* pj,
+                      const SHORT diag,
+                      INT**       iac,
+                      INT**       jac,
+                      REAL**      acj)
+{
+    const spgemm_fac R = {ir, jr, rj, NULL}, A = {ia, ja, aj, NULL},
+                     P = {ip, jp, pj, NULL};
+
+    spgemm_run(row, col, mid, nb, &R, &A, &P, diag, iac, jac, acj);
+}
+
+/**
+ * \fn void fasp_blas_spgemm_ptap (const INT row, const INT col, const INT mid,
+ *                                 const INT *it, const INT *jt, const INT *map,
+ *                                 const INT *ia, const INT *ja, const REAL *aj,
+ *                                 const INT *ip, const INT *jp, const REAL *pj,
+ *                                 const SHORT diag, INT **iac, INT **jac,
+ *                                 REAL **acj)
+ *
+ * \brief Sparse matrix product C = P'*A*P with P' given by positions in P
+ *
+ * \param row    Number of rows of P' and C
+ * \param col    Number of columns of P and C
+ * \param mid    Number of rows of P
+ * \param it     Row pointers of P'
+ * \param jt     Column indices of P'
+ * \param map    Positions of the entries of P' in pj
+ * \param ia     Row pointers of A
+ * \param ja     Column indices of A
+ * \param aj     Entries of A
+ * \param ip     Row pointers of P
+ * \param jp     Column indices of P
+ * \param pj     Entries of P
+ * \param diag   Store the diagonal entry first in each row of C if TRUE
+ * \param iac    Pointer to the row pointers of C (output)
+ * \param jac    Pointer to the column indices of C (output)
+ * \param acj    Pointer to the entries of C (output)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The entries of P' are read from P, so P' is never stored with values.
+ */
+void fasp_blas_spgemm_ptap(const INT   row,
+                           const INT   col,
+                           const INT   mid,
+                           const INT*  it,
+                           const INT*  jt,
+                           const INT*  map,
+                           const INT*  ia,
+                           const INT*  ja,
+                           const REAL* aj,
+                           const INT*  ip,
+                           const INT*  jp,
+                           const REAL* pj,
+                           const SHORT diag,
+                           INT**       iac,
+                           INT**       jac,
+                           REAL**      acj)
+{
+    const spgemm_fac R = {it, jt, pj, map}, A = {ia, ja, aj, NULL},
+                     P = {ip, jp, pj, NULL};
+
+    spgemm_run(row, col, mid, 1, &R, &A, &P, diag, iac, jac, acj);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void spgemm_run (const INT row, const INT col, const INT mid,
+ *                             const INT nb, const spgemm_fac *R,
+ *                             const spgemm_fac *A, const spgemm_fac *P,
+ *                             const SHORT diag, INT **iac, INT **jac, REAL **acj)
+ *
+ * \brief Symbolic and numeric runs of C = R*A*P
+ *
+ * \param row    Number of (block) rows of R and C
+ * \param col    Number of (block) columns of P and C
+ * \param mid    Number of (block) rows of P
+ * \param nb     Size of the small blocks (1 for CSR matrices)
+ * \param R      Pointer to the left factor
+ * \param A      Pointer to the middle factor (A->IA = NULL: the identity)
+ * \param P      Pointer to the right factor
+ * \param diag   Store the diagonal entry first in each row of C if TRUE
+ * \param iac    Pointer to the row pointers of C (output)
+ * \param jac    Pointer to the column indices of C (output)
+ * \param acj    Pointer to the entries of C (output)
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void spgemm_run(const INT         row,
+                       const INT         col,
+                       const INT         mid,
+                       const INT         nb,
+                       const spgemm_fac* R,
+                       const spgemm_fac* A,
+                       const spgemm_fac* P,
+                       const SHORT       diag,
+                       INT**             iac,
+                       INT**             jac,
+                       REAL**            acj)
+{
+    const INT nb2 = nb * nb;
+    const INT *ir = R->IA, *jr = R->JA, *ip = P->IA;
+
+    INT *             ic, *jc, *ub, *eye = NULL;
+    REAL*             vc;
+    INT               i, k, pmax = 0;
+    LONG              bound, work = 0;
+    spgemm_fac        I = {NULL, NULL, NULL, NULL};
+    const spgemm_fac* M = A;
+
+    // C = R*I*P: eye[] serves as both row pointers and column indices of I
+    if (A->IA == NULL) {
+        eye = (INT*)fasp_mem_calloc(mid + 1, sizeof(INT));
+        for (k = 0; k <= mid; ++k) eye[k] = k;
+        I.IA = I.JA = eye;
+        M           = &I;
+    }
+
+    ic = (INT*)fasp_mem_calloc(row + 1, sizeof(INT));
+    ub = (INT*)fasp_mem_calloc(MAX(row, 1), sizeof(INT));
+
+    // Step 1: upper bound of the number of nonzeros in each row of C
+    for (k = 0; k < mid; ++k) pmax = MAX(pmax, ip[k + 1] - ip[k]);
+
+    for (i = 0; i < row; ++i) {
+        bound = 0;
+        for (k = ir[i]; k < ir[i + 1]; ++k) bound += M->IA[jr[k] + 1] - M->IA[jr[k]];
+        bound = bound * pmax + ((diag && i < col) ? 1 : 0);
+        ub[i] = (INT)MIN(bound, col);
+        work += bound;
+    }
+
+    // Step 2: symbolic run to get the row pointers of C
+#ifdef _OPENMP
+#pragma omp parallel private(i) if (work > OPENMP_HOLDS)
+#endif
+    {
+        spgemm_acc acc;
+        spgemm_acc_init(&acc, col, mid, nb);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, SPGEMM_CHUNK)
+#endif
+        for (i = 0; i < row; ++i) {
+            ic[i + 1] = spgemm_symbolic_row(i, diag, R, M, P, ub[i], &acc);
+        }
+        spgemm_acc_free(&acc);
+    }
+
+    for (i = 0; i < row; ++i) ic[i + 1] += ic[i];
+
+    jc = (INT*)fasp_mem_calloc(MAX(ic[row], 1), sizeof(INT));
+    vc = (REAL*)fasp_mem_calloc(MAX(ic[row], 1) * nb2, sizeof(REAL));
+
+    // Step 3: numeric run to get the column indices and entries of C
+#ifdef _OPENMP
+#pragma omp parallel private(i) if (work > OPENMP_HOLDS)
+#endif
+    {
+        spgemm_acc acc;
+        spgemm_acc_init(&acc, col, mid, nb);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, SPGEMM_CHUNK)
+#endif
+        for (i = 0; i < row; ++i) {
+            if (nb == 1)
+                spgemm_numeric_row(i, diag, R, M, P, ub[i], &acc, jc + ic[i],
+                                   vc + ic[i]);
+            else
+                spgemm_numeric_row_blk(i, nb, diag, R, M, P, ub[i], &acc,
+                                       jc + ic[i], vc + (LONG)ic[i] * nb2);
+        }
+        spgemm_acc_free(&acc);
+    }
+
+    fasp_mem_free(ub);
+    ub = NULL;
+    fasp_mem_free(eye);
+    eye = NULL;
+
+    *iac = ic;
+    *jac = jc;
+    *acj = vc;
+}
+
+/**
+ * \fn static void spgemm_acc_init (spgemm_acc *acc, const INT col,
+ *                                  const INT nmid, const INT nb)
+ *
+ * \brief Initialize a row accumulator; the dense and hash arrays are allocated
+ *        when first needed
+ *
+ * \param acc   Pointer to the accumulator
+ * \param col   Number of columns of C
+ * \param nmid  Number of rows of P
+ * \param nb    Size of the small blocks
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void spgemm_acc_init(spgemm_acc* acc, const INT col, const INT nmid,
+                            const INT nb)
+{
+    const INT nb2 = nb * nb;
+
+    acc->col   = col;
+    acc->lmark = NULL;
+    acc->list  = NULL;
+    acc->base  = 0;
+    acc->pos   = NULL;
+    acc->hcap  = 0;
+    acc->hkey  = NULL;
+    acc->hpos  = NULL;
+    acc->tmp   = NULL;
+
+    if (nmid > 0) {
+        acc->lmark = (INT*)fasp_mem_calloc(nmid, sizeof(INT));
+        fasp_iarray_set(nmid, acc->lmark, -1);
+    }
+
+    if (nb > 1) acc->tmp = (REAL*)fasp_mem_calloc(2 * nb2, sizeof(REAL));
+}
+
+/**
+ * \fn static void spgemm_acc_free (spgemm_acc *acc)
+ *
+ * \brief Free the work arrays of a row accumulator
+ *
+ * \param acc   Pointer to the accumulator
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void spgemm_acc_free(spgemm_acc* acc)
+{
+    fasp_mem_free(acc->lmark);
+    acc->lmark = NULL;
+    fasp_mem_free(acc->list);
+    acc->list = NULL;
+    fasp_mem_free(acc->pos);
+    acc->pos = NULL;
+    fasp_mem_free(acc->hkey);
+    acc->hkey = NULL;
+    fasp_mem_free(acc->hpos);
+    acc->hpos = NULL;
+    fasp_mem_free(acc->tmp);
+    acc->tmp = NULL;
+}
+
+/**
+ * \fn static INT spgemm_acc_row (spgemm_acc *acc, const INT ub)
+ *
+ * \brief Choose and prepare the accumulator for a new row of C
+ *
+ * \param acc   Pointer to the accumulator
+ * \param ub    Upper bound of the number of nonzeros in the row
+ *
+ * \return      Size of the hash table minus one, or -1 for the dense accumulator
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT spgemm_acc_row(spgemm_acc* acc, const INT ub)
+{
+    const INT col   = acc->col;
+    INT       hsize = SPGEMM_HASHMIN;
+
+    if ((LONG)ub * SPGEMM_DENSE > col) {
+        if (acc->pos == NULL) {
+            acc->pos = (INT*)fasp_mem_calloc(col, sizeof(INT));
+            fasp_iarray_set(col, acc->pos, -1);
+        }
+        return -1;
+    }
+
+    while (hsize < 2 * ub) hsize *= 2;
+    if (hsize > acc->hcap) {
+        fasp_mem_free(acc->hkey);
+        fasp_mem_free(acc->hpos);
+        fasp_mem_free(acc->list);
+        acc->hcap = hsize;
+        acc->hkey = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
+        acc->hpos = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
+        acc->list = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
+    }
+    fasp_iarray_set(hsize, acc->hkey, -1);
+
+    return hsize - 1;
+}
+
+/**
+ * \fn static inline INT spgemm_insert (const INT c, INT *pos, const INT base,
+ *                                      INT *hkey, INT *hpos, const INT mask,
+ *                                      INT *cnt, INT *jc)
+ *
+ * \brief Find column c in the current row of C; append it if it is new
+ *
+ * \param c     Column index
+ * \param pos   Dense accumulator: base plus position of each column
+ * \param base  Dense accumulator: values below base belong to previous rows
+ * \param hkey  Hash accumulator: column indices, -1 for empty slots
+ * \param hpos  Hash accumulator: position of each column
+ * \param mask  Size of the hash table minus one, or -1 for the dense accumulator
+ * \param cnt   Number of columns found so far in the current row (updated)
+ * \param jc    Column indices of the current row of C
+ *
+ * \return      Position of column c in the current row of C
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline INT spgemm_insert(const INT c, INT* pos, const INT base, INT* hkey,
+                                INT* hpos, const INT mask, INT* cnt, INT* jc)
+{
+    INT h, p;
+
+    if (mask < 0) { // dense accumulator
+        p = pos[c] - base;
+        if (p < 0) {
+            p      = (*cnt)++;
+            pos[c] = base + p;
+            jc[p]  = c;
+        }
+        return p;
+    }
+
+    // hash accumulator with linear probing
+    h = (INT)(((unsigned)c * 107u) & (unsigned)mask);
+    while (hkey[h] != -1) {
+        if (hkey[h] == c) return hpos[h];
+        h = (h + 1) & mask;
+    }
+    p = hpos[h] = (*cnt)++;
+    hkey[h]     = c;
+    jc[p]       = c;
+    return p;
+}
+
+/**
+ * \fn static INT spgemm_symbolic_row (const INT i, const SHORT diag,
+ *                                     const spgemm_fac *R, const spgemm_fac *A,
+ *                                     const spgemm_fac *P, const INT ub,
+ *                                     spgemm_acc *acc)
+ *
+ * \brief Number of nonzeros in row i of C = R*A*P
+ *
+ * \param i     Row index
+ * \param diag  Count the diagonal entry if TRUE
+ * \param R     Pointer to the left factor
+ * \param A     Pointer to the middle factor
+ * \param P     Pointer to the right factor
+ * \param ub    Upper bound of the number of nonzeros in row i of C
+ * \param acc   Pointer to the accumulator
+ *
+ * \return      Number of nonzeros in row i of C
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT spgemm_symbolic_row(const INT         i,
+                               const SHORT       diag,
+                               const spgemm_fac* R,
+                               const spgemm_fac* A,
+                               const spgemm_fac* P,
+                               const INT         ub,
+                               spgemm_acc*       acc)
+{
+    const INT *ir = R->IA, *jr = R->JA, *ia = A->IA, *ja = A->JA;
+    const INT *ip = P->IA, *jp = P->JA;
+    const INT  mask = spgemm_acc_row(acc, ub), base = acc->base;
+
+    INT *lmark = acc->lmark, *pos = acc->pos, *hkey = acc->hkey, *hpos = acc->hpos;
+    INT  k1, k2, k3, k, l, cnt = 0, first;
+
+    // only the hash accumulator needs the column list; the dense one keeps pos[]
+    INT* list = (mask < 0) ? &first : acc->list;
+
+    if (diag && i < acc->col) spgemm_insert(i, pos, base, hkey, hpos, mask, &cnt, list);
+
+    for (k1 = ir[i]; k1 < ir[i + 1]; ++k1) {
+        k = jr[k1];
+        for (k2 = ia[k]; k2 < ia[k + 1]; ++k2) {
+            l = ja[k2];
+            if (lmark[l] == i) continue; // a row of P reached twice adds nothing
+            lmark[l] = i;
+            if (mask < 0) {
+                for (k3 = ip[l]; k3 < ip[l + 1]; ++k3) {
+                    if (pos[jp[k3]] < base) pos[jp[k3]] = base + cnt++;
+                }
+            }
+            else {
+                for (k3 = ip[l]; k3 < ip[l + 1]; ++k3)
+                    spgemm_insert(jp[k3], pos, base, hkey, hpos, mask, &cnt, list);
+            }
+        }
+    }
+
+    acc->base += cnt;
+
+    return cnt;
+}
+
+/**
+ * \fn static void spgemm_numeric_row (const INT i, const SHORT diag,
+ *                                     const spgemm_fac *R, const spgemm_fac *A,
+ *                                     const spgemm_fac *P, const INT ub,
+ *                                     spgemm_acc *acc, INT *jc, REAL *vc)
+ *
+ * \brief Compute row i of C = R*A*P for CSR matrices
+ *
+ * \param i     Row index
+ * \param diag  Store the diagonal entry first if TRUE
+ * \param R     Pointer to the left factor
+ * \param A     Pointer to the middle factor
+ * \param P     Pointer to the right factor
+ * \param ub    Upper bound of the number of nonzeros in row i of C
+ * \param acc   Pointer to the accumulator
+ * \param jc    Column indices of row i of C
+ * \param vc    Entries of row i of C (zero on entry)
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void spgemm_numeric_row(const INT         i,
+                               const SHORT       diag,
+                               const spgemm_fac* R,
+                               const spgemm_fac* A,
+                               const spgemm_fac* P,
+                               const INT         ub,
+                               spgemm_acc*       acc,
+                               INT*              jc,
+                               REAL*             vc)
+{
+    const INT * ir = R->IA, *jr = R->JA, *ia = A->IA, *ja = A->JA;
+    const INT * ip = P->IA, *jp = P->JA;
+    const REAL *rj = R->val, *aj = A->val, *pj = P->val;
+    const INT * rmap = R->map;
+    const INT   mask = spgemm_acc_row(acc, ub), base = acc->base;
+
+    INT *lmark = acc->lmark, *pos = acc->pos, *hkey = acc->hkey, *hpos = acc->hpos;
+    INT  k1, k2, k3, k, l, c, p, end, cnt = 0;
+    REAL wr, w, v;
+
+    if (diag && i < acc->col) spgemm_insert(i, pos, base, hkey, hpos, mask, &cnt, jc);
+
+    for (k1 = ir[i]; k1 < ir[i + 1]; ++k1) {
+        k  = jr[k1];
+        wr = (rj == NULL) ? 1.0 : rj[(rmap == NULL) ? k1 : rmap[k1]];
+        for (k2 = ia[k]; k2 < ia[k + 1]; ++k2) {
+            l = ja[k2];
+            w = (aj == NULL) ? wr : wr * aj[k2];
+
+            end = ip[l + 1];
+
+            if (mask < 0 && lmark[l] == i) {
+                // all columns of this row of P are in the dense accumulator
+                if (pj == NULL)
+                    for (k3 = ip[l]; k3 < end; ++k3) vc[pos[jp[k3]] - base] += w;
+                else
+                    for (k3 = ip[l]; k3 < end; ++k3)
+                        vc[pos[jp[k3]] - base] += w * pj[k3];
+                continue;
+            }
+
+            lmark[l] = i;
+            if (mask < 0) {
+                for (k3 = ip[l]; k3 < end; ++k3) {
+                    c = jp[k3];
+                    v = (pj == NULL) ? w : w * pj[k3];
+                    p = pos[c] - base;
+                    if (p < 0) {
+                        pos[c]  = base + cnt;
+                        jc[cnt] = c;
+                        vc[cnt++] = v;
+                    }
+                    else
+                        vc[p] += v;
+                }
+                continue;
+            }
+            for (k3 = ip[l]; k3 < end; ++k3) {
+                p = spgemm_insert(jp[k3], pos, base, hkey, hpos, mask, &cnt, jc);
+                vc[p] += (pj == NULL) ? w : w * pj[k3];
+            }
+        }
+    }
+
+    acc->base += cnt;
+}
+
+/**
+ * \fn static void spgemm_numeric_row_blk (const INT i, const INT nb,
+ *                                         const SHORT diag, const spgemm_fac *R,
+ *                                         const spgemm_fac *A, const spgemm_fac *P,
+ *                                         const INT ub, spgemm_acc *acc, INT *jc,
+ *                                         REAL *vc)
+ *
+ * \brief Compute row i of C = R*A*P for BSR matrices
+ *
+ * \param i     Row index
+ * \param nb    Size of the small blocks
+ * \param diag  Store the diagonal block first if TRUE
+ * \param R     Pointer to the left factor
+ * \param A     Pointer to the middle factor
+ * \param P     Pointer to the right factor
+ * \param ub    Upper bound of the number of nonzero blocks in row i of C
+ * \param acc   Pointer to the accumulator
+ * \param jc    Column indices of row i of C
+ * \param vc    Blocks of row i of C (zero on entry)
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void spgemm_numeric_row_blk(const INT         i,
+                                   const INT         nb,
+                                   const SHORT       diag,
+                                   const spgemm_fac* R,
+                                   const spgemm_fac* A,
+                                   const spgemm_fac* P,
+                                   const INT         ub,
+                                   spgemm_acc*       acc,
+                                   INT*              jc,
+                                   REAL*             vc)
+{
+    const INT   nb2 = nb * nb;
+    const INT * ir = R->IA, *jr = R->JA, *ia = A->IA, *ja = A->JA;
+    const INT * ip = P->IA, *jp = P->JA;
+    const REAL *rj = R->val, *aj = A->val, *pj = P->val;
+    const INT   mask = spgemm_acc_row(acc, ub), base = acc->base;
+
+    INT *       pos = acc->pos, *hkey = acc->hkey, *hpos = acc->hpos;
+    INT         k1, k2, k3, k, l, p, d, cnt = 0;
+    REAL *      tmp = acc->tmp, *v;
+    const REAL* w;
+
+    if (diag && i < acc->col) spgemm_insert(i, pos, base, hkey, hpos, mask, &cnt, jc);
+
+    for (k1 = ir[i]; k1 < ir[i + 1]; ++k1) {
+        k = jr[k1];
+        for (k2 = ia[k]; k2 < ia[k + 1]; ++k2) {
+            l = ja[k2];
+
+            // w = R(i,k)*A(k,l); w = NULL stands for the identity block
+            if (rj == NULL)
+                w = (aj == NULL) ? NULL : aj + (LONG)k2 * nb2;
+            else if (aj == NULL)
+                w = rj + (LONG)k1 * nb2;
+            else {
+                fasp_blas_smat_mul(rj + (LONG)k1 * nb2, aj + (LONG)k2 * nb2, tmp, nb);
+                w = tmp;
+            }
+
+            for (k3 = ip[l]; k3 < ip[l + 1]; ++k3) {
+                p = spgemm_insert(jp[k3], pos, base, hkey, hpos, mask, &cnt, jc);
+                v = vc + (LONG)p * nb2;
+                if (pj == NULL) {
+                    if (w == NULL)
+                        for (d = 0; d < nb2; d += nb + 1) v[d] += 1.0;
+                    else
+                        fasp_blas_darray_axpy(nb2, 1.0, w, v);
+                }
+                else if (w == NULL) {
+                    fasp_blas_darray_axpy(nb2, 1.0, pj + (LONG)k3 * nb2, v);
+                }
+                else {
+                    fasp_blas_smat_mul(w, pj + (LONG)k3 * nb2, tmp + nb2, nb);
+                    fasp_blas_darray_axpy(nb2, 1.0, tmp + nb2, v);
+                }
+            }
+        }
+    }
+
+    acc->base += cnt;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
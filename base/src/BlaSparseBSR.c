@@ -242,6 +242,9 @@ SHORT fasp_dbsr_compress_inplace(dBSRmat* A, const REAL dtol)
  * \date   2011/06/08
  *
  * Modified by Xiaozhe Hu (08/06/2011)
+ * Modified by agent on 10/18/2026: per-thread histograms and scatter
+ *
+ * \note Column indices of A' are in ascending order.
  */
 INT fasp_dbsr_trans(const dBSRmat* A, dBSRmat* AT)
 {
@@ -249,6 +252,12 @@ INT fasp_dbsr_trans(const dBSRmat* A, dBSRmat* AT)
 
     INT status = FASP_SUCCESS;
     INT i, j, k, p, inb, jnb, nb2;
+    INT myid, mybegin, myend, cnt, sum;
+    INT nthreads = 1;
+
+#ifdef _OPENMP
+    if (nnz > OPENMP_HOLDS) nthreads = fasp_get_num_threads();
+#endif
 
     AT->ROW            = m;
     AT->COL            = n;
@@ -266,45 +275,61 @@ INT fasp_dbsr_trans(const dBSRmat* A, dBSRmat* AT)
         AT->val = NULL;
     }
 
-    // first pass: find the number of nonzeros in the first m-1 columns of A
-    // Note: these numbers are stored in the array AT.IA from 1 to m-1
-    fasp_iarray_set(m + 1, AT->IA, 0);
+    // first pass: count columns of each block of rows in a private histogram
+    INT* pos = (INT*)fasp_mem_calloc(MAX(nthreads * m, 1), sizeof(INT));
 
-    for (j = 0; j < nnz; ++j) {
-        i = A->JA[j]; // column number of A = row number of A'
-        if (i < m - 1) AT->IA[i + 2]++;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, p) if (nthreads > 1)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mypos = pos + myid * m;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for (i = mybegin; i < myend; ++i) {
+            for (p = A->IA[i]; p < A->IA[i + 1]; ++p) mypos[A->JA[p]]++;
+        }
     }
 
-    for (i = 2; i <= m; ++i) AT->IA[i] += AT->IA[i - 1];
+    for (i = 0; i < m; ++i) {
+        for (sum = 0, myid = 0; myid < nthreads; ++myid) sum += pos[myid * m + i];
+        AT->IA[i + 1] = AT->IA[i] + sum;
+    }
 
-    // second pass: form A'
-    if (A->val) {
-        for (i = 0; i < n; ++i) {
-            INT ibegin = A->IA[i], iend1 = A->IA[i + 1];
-            for (p = ibegin; p < iend1; p++) {
-                j         = A->JA[p] + 1;
-                k         = AT->IA[j];
-                AT->JA[k] = i;
-                for (inb = 0; inb < nb; inb++)
-                    for (jnb = 0; jnb < nb; jnb++)
-                        AT->val[nb2 * k + inb * nb + jnb] =
-                            A->val[nb2 * p + jnb * nb + inb];
-                AT->IA[j] = k + 1;
-            } // end for p
-        }     // end for i
+    // starting position of each thread in each row of A'
+#ifdef _OPENMP
+#pragma omp parallel for private(i, myid, cnt, sum) if (nthreads > 1 && m > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < m; ++i) {
+        for (sum = AT->IA[i], myid = 0; myid < nthreads; ++myid) {
+            cnt               = pos[myid * m + i];
+            pos[myid * m + i] = sum;
+            sum += cnt;
+        }
+    }
 
-    } else {
-        for (i = 0; i < n; ++i) {
-            INT ibegin = A->IA[i], iend1 = A->IA[i + 1];
-            for (p = ibegin; p < iend1; p++) {
-                j         = A->JA[p] + 1;
-                k         = AT->IA[j];
+    // second pass: form A', blocks are transposed as well
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k, p, inb, jnb) if (nthreads > 1)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mypos = pos + myid * m;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for (i = mybegin; i < myend; ++i) {
+            for (p = A->IA[i]; p < A->IA[i + 1]; p++) {
+                j         = A->JA[p];
+                k         = mypos[j]++;
                 AT->JA[k] = i;
-                AT->IA[j] = k + 1;
+                if (A->val) {
+                    for (inb = 0; inb < nb; inb++)
+                        for (jnb = 0; jnb < nb; jnb++)
+                            AT->val[nb2 * k + inb * nb + jnb] =
+                                A->val[nb2 * p + jnb * nb + inb];
+                }
             } // end for p
-        }     // end of i
+        }     // end for i
+    }
 
-    }         // end if
+    fasp_mem_free(pos);
+    pos = NULL;
 
     return (status);
 }
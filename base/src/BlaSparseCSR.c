@@ -22,6 +22,8 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
+static INT* csr_trans_pos(const INT, const INT, const INT*, const INT*, const INT, INT*);
+
 #if MULTI_COLOR_ORDER
 static void generate_S_theta(dCSRmat*, iCSRmat*, REAL);
 #endif
@@ -871,19 +873,26 @@ void fasp_dcsr_cp(const dCSRmat* A, dCSRmat* B)
  * \date   04/06/2010
  *
  * Modified by Chunsheng Feng, Zheng Li on 06/20/2012
+ * Modified by agent on 10/18/2026: scatter in parallel
+ *
+ * \note Column indices of A' are in ascending order.
  */
 void fasp_icsr_trans(const iCSRmat* A, iCSRmat* AT)
 {
-    const INT n = A->row, m = A->col, nnz = A->nnz, m1 = m - 1;
+    const INT n = A->row, m = A->col, nnz = A->nnz;
 
     // Local variables
-    INT i, j, k, p;
-    INT ibegin, iend;
+    INT i, j, k, p, myid, mybegin, myend;
+    INT nthreads = 1;
 
 #if DEBUG_MODE > 1
     printf("### DEBUG: m=%d, n=%d, nnz=%d\n", m, n, nnz);
 #endif
 
+#ifdef _OPENMP
+    if (nnz > OPENMP_HOLDS) nthreads = fasp_get_num_threads();
+#endif
+
     AT->row = m;
     AT->col = n;
     AT->nnz = nnz;
@@ -898,42 +907,28 @@ void fasp_icsr_trans(const iCSRmat* A, iCSRmat* AT)
         AT->val = NULL;
     }
 
-    // first pass: find the Number of nonzeros in the first m-1 columns of A
-    // Note: these Numbers are stored in the array AT.IA from 1 to m-1
-    fasp_iarray_set(m + 1, AT->IA, 0);
-
-    for (j = 0; j < nnz; ++j) {
-        i = A->JA[j]; // column Number of A = row Number of A'
-        if (i < m1) AT->IA[i + 2]++;
-    }
-
-    for (i = 2; i <= m; ++i) AT->IA[i] += AT->IA[i - 1];
+    // first pass: row pointers of A' and where each thread puts its entries
+    INT* pos = csr_trans_pos(n, m, A->IA, A->JA, nthreads, AT->IA);
 
     // second pass: form A'
-    if (A->val != NULL) {
-        for (i = 0; i < n; ++i) {
-            ibegin = A->IA[i];
-            iend   = A->IA[i + 1];
-            for (p = ibegin; p < iend; p++) {
-                j          = A->JA[p] + 1;
-                k          = AT->IA[j];
-                AT->JA[k]  = i;
-                AT->val[k] = A->val[p];
-                AT->IA[j]  = k + 1;
-            } // end for p
-        }     // end for i
-    } else {
-        for (i = 0; i < n; ++i) {
-            ibegin = A->IA[i];
-            iend   = A->IA[i + 1];
-            for (p = ibegin; p < iend; p++) {
-                j         = A->JA[p] + 1;
-                k         = AT->IA[j];
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k, p) if (nthreads > 1)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mypos = pos + myid * m;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for (i = mybegin; i < myend; ++i) {
+            for (p = A->IA[i]; p < A->IA[i + 1]; p++) {
+                j         = A->JA[p];
+                k         = mypos[j]++;
                 AT->JA[k] = i;
-                AT->IA[j] = k + 1;
+                if (A->val) AT->val[k] = A->val[p];
             } // end for p
         }     // end for i
-    }         // end if
+    }
+
+    fasp_mem_free(pos);
+    pos = NULL;
 }
 
 /**
@@ -948,13 +943,21 @@ void fasp_icsr_trans(const iCSRmat* A, iCSRmat* AT)
  * \date   04/06/2010
  *
  *  Modified by Chunsheng Feng, Zheng Li on 06/20/2012
+ *  Modified by agent on 10/18/2026: scatter in parallel
+ *
+ * \note Column indices of A' are in ascending order.
  */
 INT fasp_dcsr_trans(const dCSRmat* A, dCSRmat* AT)
 {
     const INT n = A->row, m = A->col, nnz = A->nnz;
 
     // Local variables
-    INT i, j, k, p;
+    INT i, j, k, p, myid, mybegin, myend;
+    INT nthreads = 1;
+
+#ifdef _OPENMP
+    if (nnz > OPENMP_HOLDS) nthreads = fasp_get_num_threads();
+#endif
 
     AT->row = m;
     AT->col = n;
@@ -977,44 +980,139 @@ INT fasp_dcsr_trans(const dCSRmat* A, dCSRmat* AT)
     AT->ICMAP = NULL;
 #endif
 
-    // first pass: find the Number of nonzeros in the first m-1 columns of A
-    // Note: these Numbers are stored in the array AT.IA from 1 to m-1
-
-    // fasp_iarray_set(m+1, AT->IA, 0);
-    memset(AT->IA, 0, sizeof(INT) * (m + 1));
+    // first pass: row pointers of A' and where each thread puts its entries
+    INT* pos = csr_trans_pos(n, m, A->IA, A->JA, nthreads, AT->IA);
 
-    for (j = 0; j < nnz; ++j) {
-        i = A->JA[j]; // column Number of A = row Number of A'
-        if (i < m - 1) AT->IA[i + 2]++;
+    // second pass: form A'
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k, p) if (nthreads > 1)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mypos = pos + myid * m;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        if (A->val) {
+            for (i = mybegin; i < myend; ++i) {
+                for (p = A->IA[i]; p < A->IA[i + 1]; p++) {
+                    j          = A->JA[p];
+                    k          = mypos[j]++;
+                    AT->JA[k]  = i;
+                    AT->val[k] = A->val[p];
+                } // end for p
+            }     // end for i
+        } else {
+            for (i = mybegin; i < myend; ++i) {
+                for (p = A->IA[i]; p < A->IA[i + 1]; p++) {
+                    j         = A->JA[p];
+                    k         = mypos[j]++;
+                    AT->JA[k] = i;
+                } // end for p
+            }     // end of i
+        }         // end if
     }
 
-    for (i = 2; i <= m; ++i) AT->IA[i] += AT->IA[i - 1];
+    fasp_mem_free(pos);
+    pos = NULL;
 
-    // second pass: form A'
-    if (A->val) {
-        for (i = 0; i < n; ++i) {
-            INT ibegin = A->IA[i], iend = A->IA[i + 1];
-            for (p = ibegin; p < iend; p++) {
-                j          = A->JA[p] + 1;
-                k          = AT->IA[j];
+    return FASP_SUCCESS;
+}
+
+/**
+ * \fn void fasp_dcsr_trans_map (const dCSRmat *A, iCSRmat *AT)
+ *
+ * \brief Find the pattern of A' and the positions of its entries in A
+ *
+ * \param A   Pointer to the dCSRmat matrix
+ * \param AT  Pointer to the pattern of A' (output); AT->val[k] is the position
+ *            of the k-th entry of A' in A->val
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Column indices of A' are in ascending order, as in fasp_dcsr_trans.
+ *       A' can then be applied with the entries of A and no copy of them.
+ */
+void fasp_dcsr_trans_map(const dCSRmat* A, iCSRmat* AT)
+{
+    const INT n = A->row, m = A->col, nnz = A->nnz;
+
+    // Local variables
+    INT i, k, p, myid, mybegin, myend;
+    INT nthreads = 1;
+
+#ifdef _OPENMP
+    if (nnz > OPENMP_HOLDS) nthreads = fasp_get_num_threads();
+#endif
+
+    AT->row = m;
+    AT->col = n;
+    AT->nnz = nnz;
+    AT->IA  = (INT*)fasp_mem_calloc(m + 1, sizeof(INT));
+    AT->JA  = (INT*)fasp_mem_calloc(nnz, sizeof(INT));
+    AT->val = (INT*)fasp_mem_calloc(nnz, sizeof(INT));
+
+    // first pass: row pointers of A' and where each thread puts its entries
+    INT* pos = csr_trans_pos(n, m, A->IA, A->JA, nthreads, AT->IA);
+
+    // second pass: column indices of A' and positions in A
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, k, p) if (nthreads > 1)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mypos = pos + myid * m;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for (i = mybegin; i < myend; ++i) {
+            for (p = A->IA[i]; p < A->IA[i + 1]; p++) {
+                k          = mypos[A->JA[p]]++;
                 AT->JA[k]  = i;
-                AT->val[k] = A->val[p];
-                AT->IA[j]  = k + 1;
-            } // end for p
-        }     // end for i
-    } else {
-        for (i = 0; i < n; ++i) {
-            INT ibegin = A->IA[i], iend1 = A->IA[i + 1];
-            for (p = ibegin; p < iend1; p++) {
-                j         = A->JA[p] + 1;
-                k         = AT->IA[j];
-                AT->JA[k] = i;
-                AT->IA[j] = k + 1;
-            } // end for p
-        }     // end of i
-    }         // end if
+                AT->val[k] = p;
+            }
+        }
+    }
 
-    return FASP_SUCCESS;
+    fasp_mem_free(pos);
+    pos = NULL;
+}
+
+/**
+ * \fn void fasp_aggmap_trans (const ivector *map, const INT nc, iCSRmat *R)
+ *
+ * \brief Find the pattern of R = P' for the boolean P given by an aggregate map
+ *
+ * \param map  Pointer to the aggregate of each fine node (negative: no aggregate)
+ * \param nc   Number of aggregates
+ * \param R    Pointer to the fine nodes of each aggregate (output); R->val = NULL
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Fine nodes of each aggregate are in ascending order.
+ */
+void fasp_aggmap_trans(const ivector* map, const INT nc, iCSRmat* R)
+{
+    const INT  n   = map->row;
+    const INT* agg = map->val;
+
+    INT i, I;
+
+    R->row = nc;
+    R->col = n;
+    R->IA  = (INT*)fasp_mem_calloc(nc + 1, sizeof(INT));
+    R->val = NULL;
+
+    for (i = 0; i < n; ++i) {
+        if (agg[i] >= 0) R->IA[agg[i] + 1]++;
+    }
+    for (I = 0; I < nc; ++I) R->IA[I + 1] += R->IA[I];
+
+    R->nnz = R->IA[nc];
+    R->JA  = (INT*)fasp_mem_calloc(MAX(R->nnz, 1), sizeof(INT));
+
+    // R->IA[I] is used as the next free position of aggregate I
+    for (i = 0; i < n; ++i) {
+        if (agg[i] >= 0) R->JA[R->IA[agg[i]]++] = i;
+    }
+    for (I = nc; I > 0; --I) R->IA[I] = R->IA[I - 1];
+    R->IA[0] = 0;
 }
 
 /**
@@ -1196,6 +1294,73 @@ SHORT fasp_dcsr_compress_inplace(dCSRmat* A, const REAL dtol)
     return (status);
 }
 
+/**
+ * \fn SHORT fasp_dcsr_sparsify (dCSRmat *A, const REAL tol)
+ *
+ * \brief Sparsify a CSR matrix A IN PLACE by lumping small off-diagonal entries
+ *        to the diagonal
+ *
+ * \param A     Pointer to dCSRmat CSR matrix
+ * \param tol   Relative drop tolerance
+ *
+ * \return      FASP_SUCCESS if succeeded; otherwise, error information.
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Let mi = max_{k!=i} |aik|. An entry aij is dropped if |aij| < tol*min(mi,mj)
+ *       and added to aii. The test is symmetric in i and j, so a symmetric A stays
+ *       symmetric; the largest entry of each row is never dropped; row sums, and
+ *       thus the constant vectors in the null space, are preserved.
+ */
+SHORT fasp_dcsr_sparsify(dCSRmat* A, const REAL tol)
+{
+    const INT  row = A->row;
+    const INT *ia = A->IA, *ja = A->JA;
+    REAL*      aj = A->val;
+
+    INT   i, j, k, kd;
+    REAL  lump, *amax;
+
+    if (tol <= 0.0 || row <= 0) return FASP_SUCCESS;
+
+    amax = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, k) if (A->nnz > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < row; ++i) {
+        for (k = ia[i]; k < ia[i + 1]; ++k) {
+            if (ja[k] != i) amax[i] = MAX(amax[i], ABS(aj[k]));
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, kd, lump) if (A->nnz > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < row; ++i) {
+        for (kd = ia[i]; kd < ia[i + 1] && ja[kd] != i; ++kd)
+            ;
+        if (kd == ia[i + 1]) continue; // nowhere to lump to
+
+        lump = 0.0;
+        for (k = ia[i]; k < ia[i + 1]; ++k) {
+            j = ja[k];
+            if (j != i && j < row && ABS(aj[k]) < tol * MIN(amax[i], amax[j])) {
+                lump += aj[k];
+                aj[k] = 0.0;
+            }
+        }
+        aj[kd] += lump;
+    }
+
+    fasp_mem_free(amax);
+    amax = NULL;
+
+    // remove the lumped entries; diagonal entries are always kept
+    return fasp_dcsr_compress_inplace(A, 0.0);
+}
+
 /**
  * \fn void fasp_dcsr_shift (dCSRmat *A, const INT offset)
  *
@@ -1773,6 +1938,82 @@ void dCSRmat_Multicoloring(dCSRmat* A, INT* rowmax, INT* groups)
 #endif
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static INT* csr_trans_pos (const INT n, const INT m, const INT *IA,
+ *                                const INT *JA, const INT nthreads, INT *IAT)
+ *
+ * \brief Row pointers of a transpose and scatter positions of each thread
+ *
+ * \param n          Number of rows of A
+ * \param m          Number of columns of A
+ * \param IA         Row pointers of A
+ * \param JA         Column indices of A
+ * \param nthreads   Number of threads, each handles a contiguous block of rows
+ * \param IAT        Row pointers of A' (OUTPUT, size m+1)
+ *
+ * \return           Array of size nthreads*m: position in A' of the first entry
+ *                   of thread myid in row j of A' is stored at [myid*m+j]
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each thread counts the columns of its own rows in a private histogram.
+ *       Since the blocks of rows are in order, scattering the rows of each block
+ *       from these positions gives A' with ascending column indices.
+ */
+static INT* csr_trans_pos(const INT  n,
+                          const INT  m,
+                          const INT* IA,
+                          const INT* JA,
+                          const INT  nthreads,
+                          INT*       IAT)
+{
+    INT  i, p, myid, mybegin, myend, cnt, sum;
+    INT* pos = (INT*)fasp_mem_calloc(MAX(nthreads * m, 1), sizeof(INT));
+
+    // column histogram of each block of rows
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, p) if (nthreads > 1)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mypos = pos + myid * m;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for (i = mybegin; i < myend; ++i) {
+            for (p = IA[i]; p < IA[i + 1]; ++p) mypos[JA[p]]++;
+        }
+    }
+
+    // number of nonzeros in each row of A'
+#ifdef _OPENMP
+#pragma omp parallel for private(i, myid, sum) if (nthreads > 1 && m > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < m; ++i) {
+        for (sum = 0, myid = 0; myid < nthreads; ++myid) sum += pos[myid * m + i];
+        IAT[i + 1] = sum;
+    }
+
+    IAT[0] = 0;
+    for (i = 0; i < m; ++i) IAT[i + 1] += IAT[i];
+
+    // starting positions of each thread in each row of A'
+#ifdef _OPENMP
+#pragma omp parallel for private(i, myid, cnt, sum) if (nthreads > 1 && m > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < m; ++i) {
+        for (sum = IAT[i], myid = 0; myid < nthreads; ++myid) {
+            cnt              = pos[myid * m + i];
+            pos[myid * m + i] = sum;
+            sum += cnt;
+        }
+    }
+
+    return pos;
+}
+
 #if MULTI_COLOR_ORDER
 static void generate_S_theta(dCSRmat* A, iCSRmat* S, REAL theta)
 {
@@ -2116,6 +2357,68 @@ void dCSRmat_Multicoloring_Theta(dCSRmat* A, REAL theta, INT* rowmax, INT* group
     return;
 }
 
+/**
+ * \fn void fasp_dcsr_multicolor_perm (const dCSRmat *A, dCSRmat *Amc,
+ *                                     dvector *dinv)
+ *
+ * \brief Permute a colored matrix to color-contiguous order for multicolor GS
+ *
+ * \param A     Pointer to the dCSRmat matrix with colors (IC, ICMAP)
+ * \param Amc   Pointer to the off-diagonal part of A in color order (OUT)
+ * \param dinv  Pointer to the inverse diagonal of A in color order (OUT)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Row I of Amc is row ICMAP[I] of A without its diagonal entry, and its
+ *       column indices are in color order as well, so the rows of each color
+ *       are contiguous in Amc, dinv and the permuted vectors. Amc keeps copies
+ *       of color, IC and ICMAP. Zero diagonal entries give dinv = 0.
+ */
+void fasp_dcsr_multicolor_perm(const dCSRmat* A, dCSRmat* Amc, dvector* dinv)
+{
+#if MULTI_COLOR_ORDER
+    const INT  n = A->row, ncolor = A->color;
+    const INT *ia = A->IA, *ja = A->JA, *ICMAP = A->ICMAP;
+    INT        I, i, j, k, nnz;
+
+    INT* pinv = (INT*)fasp_mem_calloc(n, sizeof(INT));
+
+    for (I = 0; I < n; ++I) pinv[ICMAP[I]] = I;
+
+    fasp_dcsr_alloc(n, n, A->nnz, Amc);
+    fasp_dvec_alloc(n, dinv);
+
+    Amc->color = ncolor;
+    Amc->IC    = (INT*)fasp_mem_calloc(ncolor + 1, sizeof(INT));
+    Amc->ICMAP = (INT*)fasp_mem_calloc(n, sizeof(INT));
+    fasp_iarray_cp(ncolor + 1, A->IC, Amc->IC);
+    fasp_iarray_cp(n, ICMAP, Amc->ICMAP);
+
+    Amc->IA[0] = nnz = 0;
+    for (I = 0; I < n; ++I) {
+        i            = ICMAP[I];
+        dinv->val[I] = 0.0;
+        for (k = ia[i]; k < ia[i + 1]; ++k) {
+            j = ja[k];
+            if (j == i) {
+                if (ABS(A->val[k]) > SMALLREAL) dinv->val[I] = 1.0 / A->val[k];
+            } else {
+                Amc->JA[nnz]    = pinv[j];
+                Amc->val[nnz++] = A->val[k];
+            }
+        }
+        Amc->IA[I + 1] = nnz;
+    }
+    Amc->nnz = nnz;
+
+    fasp_mem_free(pinv);
+    pinv = NULL;
+#else
+    printf("### ERROR: MULTI_COLOR_ORDER  has not been turn on!!! \n");
+#endif
+}
+
 /* 
  * TODO: Why it is not in ItrSmootherCSR.c? Move? 
  * TODO: Add Doxygen!
@@ -958,6 +958,132 @@ ivector fasp_sparse_mis (dCSRmat *A)
     return MIS;
 }
 
+/**
+ * \fn void fasp_sparse_mis2 (dCSRmat *A, const INT seed, INT *state)
+ *
+ * \brief Get a distance-2 maximal independent set of the graph of a CSR matrix
+ *
+ * \param A      pointer to the matrix (only the sparsity is used)
+ * \param seed   seed of the random priorities
+ * \param state  on entry, 0 for candidates and nonzero for excluded nodes;
+ *               on exit, 1 for nodes in the set and -1 for the other candidates
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note  Index starts from 0 (C style). Excluded nodes keep their state.
+ *
+ * \note  Luby-type rounds: a candidate joins the set if its random priority is
+ *        the largest among the candidates within distance two. The largest
+ *        candidate priority in the closed neighborhood is computed for every
+ *        node, decided or not, so that paths through decided nodes count.
+ *        Each round only reads results of the previous one, so the set does
+ *        not depend on the number of threads.
+ *
+ *        Refer to N. Bell, S. Dalton, and L. Olson. "Exposing fine-grained
+ *        parallelism in algebraic multigrid methods", SIAM J. Sci. Comput., 2012
+ */
+void fasp_sparse_mis2 (dCSRmat    *A,
+                       const INT   seed,
+                       INT        *state)
+{
+    const INT  n  = A->row;
+    const INT *IA = A->IA;
+    const INT *JA = A->JA;
+
+    // local variables
+    INT       i, j, k, num_left;
+    unsigned  h;
+    LONGLONG  kmax;
+
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if ( n > OPENMP_HOLDS ) use_openmp = TRUE;
+#endif
+
+    INT      *snew  = (INT *)fasp_mem_calloc(n, sizeof(INT));
+    LONGLONG *key   = (LONGLONG *)fasp_mem_calloc(n, sizeof(LONGLONG));
+    LONGLONG *kmax1 = (LONGLONG *)fasp_mem_calloc(n, sizeof(LONGLONG));
+
+    // random priorities: hash of (index, seed), ties broken by index
+#ifdef _OPENMP
+#pragma omp parallel for private(i, h) if (use_openmp)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        h = (unsigned)i * 2654435761u + (unsigned)seed * 40503u;
+        h ^= h >> 16;
+        h *= 2246822519u;
+        h ^= h >> 13;
+        key[i] = ((LONGLONG)(h & 0x7fffffff) << 32) | (LONGLONG)i;
+    }
+
+    for ( num_left = n; num_left > 0; ) {
+
+        // largest key of candidates in the closed neighborhood of every node
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, kmax) if (use_openmp)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            kmax = (state[i] == 0) ? key[i] : -1;
+            for ( j = IA[i]; j < IA[i+1]; ++j ) {
+                if ( state[JA[j]] == 0 ) kmax = MAX(kmax, key[JA[j]]);
+            }
+            kmax1[i] = kmax;
+        }
+
+        // a candidate joins the set if its key is the largest within distance two
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, kmax) if (use_openmp)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            snew[i] = state[i];
+            if ( state[i] != 0 ) continue;
+            kmax = kmax1[i];
+            for ( j = IA[i]; j < IA[i+1]; ++j ) kmax = MAX(kmax, kmax1[JA[j]]);
+            if ( kmax == key[i] ) snew[i] = 1;
+        }
+
+        // mark whether a new member is within distance one
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k) if (use_openmp)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            kmax1[i] = (snew[i] == 1 && state[i] == 0);
+            for ( j = IA[i]; j < IA[i+1] && !kmax1[i]; ++j ) {
+                k = JA[j];
+                if ( snew[k] == 1 && state[k] == 0 ) kmax1[i] = 1;
+            }
+        }
+
+        // candidates within distance two of a new member are not in the set
+        num_left = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j) reduction(+:num_left) if (use_openmp)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            state[i] = snew[i];
+            if ( snew[i] != 0 ) continue;
+            if ( kmax1[i] ) {
+                state[i] = -1;
+                continue;
+            }
+            for ( j = IA[i]; j < IA[i+1]; ++j ) {
+                if ( kmax1[JA[j]] ) {
+                    state[i] = -1;
+                    break;
+                }
+            }
+            if ( state[i] == 0 ) num_left++;
+        }
+
+    }
+
+    // clean
+    fasp_mem_free(snew);  snew  = NULL;
+    fasp_mem_free(key);   key   = NULL;
+    fasp_mem_free(kmax1); kmax1 = NULL;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -4,7 +4,7 @@
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxThreads.c, BlaSparseCSR.c, BlaSparseUtil.c,
- *         and BlaArray.c
+ *         BlaSpGEMM.c, and BlaArray.c
  *
  *  \note Sparse functions usually contain three runs. The three runs are all the
  *        same but thy serve different purpose.
@@ -475,6 +475,52 @@ void fasp_blas_dcsr_mxv_agg(const dCSRmat* A, const REAL* x, REAL* y)
 #endif
 }
 
+/**
+ * \fn void fasp_blas_dcsr_mxtv (const dCSRmat *A, const iCSRmat *At,
+ *                               const REAL *x, REAL *y)
+ *
+ * \brief Transposed matrix-vector multiplication y = A'*x
+ *
+ * \param A   Pointer to dCSRmat matrix A
+ * \param At  Pointer to the pattern of A' with positions in A (NULL: not available)
+ * \param x   Pointer to array x (size A->row)
+ * \param y   Pointer to array y (size A->col)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note With the pattern At from fasp_dcsr_trans_map, each entry of y is a sum
+ *       over one row of A' with the entries read from A, so rows of A' are split
+ *       among threads without work space or atomics. Otherwise the rows of A are
+ *       scattered into y sequentially.
+ */
+void fasp_blas_dcsr_mxtv(const dCSRmat* A, const iCSRmat* At, const REAL* x, REAL* y)
+{
+    const INT   n  = A->row, m = A->col;
+    const INT * ia = A->IA, *ja = A->JA;
+    const REAL* aj = A->val;
+
+    INT  i, k;
+    REAL xi, sum;
+
+    if (At != NULL) {
+        const INT *it = At->IA, *jt = At->JA, *map = At->val;
+#ifdef _OPENMP
+#pragma omp parallel for private(i, k, sum) if (At->nnz > OPENMP_HOLDS)
+#endif
+        for (i = 0; i < m; ++i) {
+            for (sum = 0.0, k = it[i]; k < it[i + 1]; ++k) sum += aj[map[k]] * x[jt[k]];
+            y[i] = sum;
+        }
+    } else {
+        memset(y, 0x0, m * sizeof(REAL));
+        for (i = 0; i < n; ++i) {
+            xi = x[i];
+            for (k = ia[i]; k < ia[i + 1]; ++k) y[ja[k]] += aj[k] * xi;
+        }
+    }
+}
+
 /**
  * \fn void fasp_blas_dcsr_aAxpy (const REAL alpha, const dCSRmat *A,
  *                                const REAL *x, REAL *y)
@@ -824,6 +870,83 @@ void fasp_blas_dcsr_aAxpy_agg(const REAL     alpha,
     }
 }
 
+/**
+ * \fn void fasp_blas_aggmap_mxtv (const iCSRmat *R, const REAL *x, REAL *y)
+ *
+ * \brief Restriction y = P'*x with an aggregate map (P is boolean)
+ *
+ * \param R    Pointer to the fine nodes of each aggregate (see fasp_aggmap_trans)
+ * \param x    Pointer to array x (size of number of fine nodes)
+ * \param y    Pointer to array y (size R->row)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Segmented sum over the aggregates: each entry of y is the sum of x over
+ *       the nodes of one aggregate, so aggregates are split among threads
+ *       without work space or atomics.
+ */
+void fasp_blas_aggmap_mxtv(const iCSRmat* R, const REAL* x, REAL* y)
+{
+    const INT  nc  = R->row;
+    const INT *ptr = R->IA, *mem = R->JA;
+
+    INT  I, p;
+    REAL sum;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(I, p, sum) if (R->nnz > OPENMP_HOLDS)
+#endif
+    for (I = 0; I < nc; ++I) {
+        for (sum = 0.0, p = ptr[I]; p < ptr[I + 1]; ++p) sum += x[mem[p]];
+        y[I] = sum;
+    }
+}
+
+/**
+ * \fn void fasp_blas_aggmap_aAxpy (const REAL alpha, const ivector *map,
+ *                                  const REAL *x, REAL *y)
+ *
+ * \brief Prolongation y = alpha*P*x + y with an aggregate map (P is boolean)
+ *
+ * \param alpha  REAL factor alpha
+ * \param map    Pointer to the aggregate of each fine node (negative: no aggregate)
+ * \param x      Pointer to array x (size of number of aggregates)
+ * \param y      Pointer to array y (size map->row)
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_blas_aggmap_aAxpy(const REAL alpha, const ivector* map, const REAL* x,
+                            REAL* y)
+{
+    const INT  n   = map->row;
+    const INT* agg = map->val;
+
+    INT i;
+
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if (n > OPENMP_HOLDS) use_openmp = TRUE;
+#endif
+
+    if (alpha == 1.0) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if (use_openmp)
+#endif
+        for (i = 0; i < n; ++i) {
+            if (agg[i] >= 0) y[i] += x[agg[i]];
+        }
+    } else {
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if (use_openmp)
+#endif
+        for (i = 0; i < n; ++i) {
+            if (agg[i] >= 0) y[i] += alpha * x[agg[i]];
+        }
+    }
+}
+
 /**
  * \fn REAL fasp_blas_dcsr_vmv (const dCSRmat *A, const REAL *x, const REAL *y)
  *
@@ -888,93 +1011,17 @@ REAL fasp_blas_dcsr_vmv(const dCSRmat* A, const REAL* x, const REAL* y)
  * \author Xiaozhe Hu
  * \date   11/07/2009
  *
- * \warning This fct will be replaced! --Chensong
+ * Modified by agent on 10/18/2026: use the SpGEMM engine
  */
 void fasp_blas_dcsr_mxm(const dCSRmat* A, const dCSRmat* B, dCSRmat* C)
 {
-    INT i, j, k, l, count;
-
-    INT* JD = (INT*)fasp_mem_calloc(B->col, sizeof(INT));
-
     C->row = A->row;
     C->col = B->col;
-    C->val = NULL;
-    C->JA  = NULL;
-    C->IA  = (INT*)fasp_mem_calloc(C->row + 1, sizeof(INT));
-
-    for (i = 0; i < B->col; ++i) JD[i] = -1;
-
-    // step 1: Find first the structure IA of C
-    for (i = 0; i < C->row; ++i) {
-        count = 0;
-
-        for (k = A->IA[i]; k < A->IA[i + 1]; ++k) {
-            for (j = B->IA[A->JA[k]]; j < B->IA[A->JA[k] + 1]; ++j) {
-                for (l = 0; l < count; l++) {
-                    if (JD[l] == B->JA[j]) break;
-                }
-
-                if (l == count) {
-                    JD[count] = B->JA[j];
-                    count++;
-                }
-            }
-        }
-        C->IA[i + 1] = count;
-        for (j = 0; j < count; ++j) {
-            JD[j] = -1;
-        }
-    }
-
-    for (i = 0; i < C->row; ++i) C->IA[i + 1] += C->IA[i];
 
-    // step 2: Find the structure JA of C
-    INT countJD;
+    fasp_blas_spgemm(A->row, B->col, B->row, 1, A->IA, A->JA, A->val, NULL, NULL,
+                     NULL, B->IA, B->JA, B->val, FALSE, &C->IA, &C->JA, &C->val);
 
-    C->JA = (INT*)fasp_mem_calloc(C->IA[C->row], sizeof(INT));
-
-    for (i = 0; i < C->row; ++i) {
-        countJD = 0;
-        count   = C->IA[i];
-        for (k = A->IA[i]; k < A->IA[i + 1]; ++k) {
-            for (j = B->IA[A->JA[k]]; j < B->IA[A->JA[k] + 1]; ++j) {
-                for (l = 0; l < countJD; l++) {
-                    if (JD[l] == B->JA[j]) break;
-                }
-
-                if (l == countJD) {
-                    C->JA[count] = B->JA[j];
-                    JD[countJD]  = B->JA[j];
-                    count++;
-                    countJD++;
-                }
-            }
-        }
-
-        // for (j=0;j<countJD;++j) JD[j]=-1;
-        fasp_iarray_set(countJD, JD, -1);
-    }
-
-    fasp_mem_free(JD);
-    JD = NULL;
-
-    // step 3: Find the structure A of C
-    C->val = (REAL*)fasp_mem_calloc(C->IA[C->row], sizeof(REAL));
-
-    for (i = 0; i < C->row; ++i) {
-        for (j = C->IA[i]; j < C->IA[i + 1]; ++j) {
-            C->val[j] = 0;
-            for (k = A->IA[i]; k < A->IA[i + 1]; ++k) {
-                for (l = B->IA[A->JA[k]]; l < B->IA[A->JA[k] + 1]; l++) {
-                    if (B->JA[l] == C->JA[j]) {
-                        C->val[j] += A->val[k] * B->val[l];
-                    } // end if
-                }     // end for l
-            }         // end for k
-        }             // end for j
-    }                 // end for i
-
-    C->nnz = C->IA[C->row] - C->IA[0];
+    C->nnz = C->IA[C->row];
 }
 
 /**
@@ -992,6 +1039,7 @@ void fasp_blas_dcsr_mxm(const dCSRmat* A, const dCSRmat* B, dCSRmat* C)
  * \date   05/10/2010
  *
  * Modified by Chunsheng Feng, Xiaoqiang Yue on 05/26/2012
+ * Modified by agent on 10/18/2026: use the SpGEMM engine
  *
  * \note Ref. R.E. Bank and C.C. Douglas. SMMP: Sparse Matrix Multiplication Package.
  *       Advances in Computational Mathematics, 1 (1993), pp. 127-137.
@@ -1001,260 +1049,14 @@ void fasp_blas_dcsr_rap(const dCSRmat* R,
                         const dCSRmat* P,
                         dCSRmat*       RAP)
 {
-    const INT   n_coarse = R->row;
-    const INT*  R_i      = R->IA;
-    const INT*  R_j      = R->JA;
-    const REAL* R_data   = R->val;
-
-    const INT   n_fine = A->row;
-    const INT*  A_i    = A->IA;
-    const INT*  A_j    = A->JA;
-    const REAL* A_data = A->val;
-
-    const INT*  P_i    = P->IA;
-    const INT*  P_j    = P->JA;
-    const REAL* P_data = P->val;
-
-    INT   RAP_size;
-    INT*  RAP_i    = NULL;
-    INT*  RAP_j    = NULL;
-    REAL* RAP_data = NULL;
-
-#ifdef _OPENMP
-    INT* P_marker = NULL;
-    INT* A_marker = NULL;
-#endif
-
-    INT* Ps_marker = NULL;
-    INT* As_marker = NULL;
-
-    INT  ic, i1, i2, i3, jj1, jj2, jj3;
-    INT  jj_counter, jj_row_begining;
-    REAL r_entry, r_a_product, r_a_p_product;
-
-    INT nthreads = 1;
-
-#ifdef _OPENMP
-    INT myid, mybegin, myend, Ctemp;
-    nthreads = fasp_get_num_threads();
-#endif
-
-    INT coarse_mul_nthreads = n_coarse * nthreads;
-    INT fine_mul_nthreads   = n_fine * nthreads;
-    INT coarse_add_nthreads = n_coarse + nthreads;
-    INT minus_one_length    = coarse_mul_nthreads + fine_mul_nthreads;
-    INT total_calloc        = minus_one_length + coarse_add_nthreads + nthreads;
-
-    Ps_marker = (INT*)fasp_mem_calloc(total_calloc, sizeof(INT));
-    As_marker = Ps_marker + coarse_mul_nthreads;
-
-    /*------------------------------------------------------*
-     *  First Pass: Determine size of RAP and set up RAP_i  *
-     *------------------------------------------------------*/
-    RAP_i = (INT*)fasp_mem_calloc(n_coarse + 1, sizeof(INT));
-
-    fasp_iarray_set(minus_one_length, Ps_marker, -1);
-
-#ifdef _OPENMP
-    INT* RAP_temp = As_marker + fine_mul_nthreads;
-    INT* part_end = RAP_temp + coarse_add_nthreads;
-
-    if (n_coarse > OPENMP_HOLDS) {
-#pragma omp parallel for private(myid, mybegin, myend, Ctemp, P_marker, A_marker,      \
-                                     jj_counter, ic, jj_row_begining, jj1, i1, jj2,    \
-                                     i2, jj3, i3)
-        for (myid = 0; myid < nthreads; myid++) {
-            fasp_get_start_end(myid, nthreads, n_coarse, &mybegin, &myend);
-            P_marker   = Ps_marker + myid * n_coarse;
-            A_marker   = As_marker + myid * n_fine;
-            jj_counter = 0;
-            for (ic = mybegin; ic < myend; ic++) {
-                P_marker[ic]    = jj_counter;
-                jj_row_begining = jj_counter;
-                jj_counter++;
-
-                for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                    i1 = R_j[jj1];
-                    for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                        i2 = A_j[jj2];
-                        if (A_marker[i2] != ic) {
-                            A_marker[i2] = ic;
-                            for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                                i3 = P_j[jj3];
-                                if (P_marker[i3] < jj_row_begining) {
-                                    P_marker[i3] = jj_counter;
-                                    jj_counter++;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                RAP_temp[ic + myid] = jj_row_begining;
-            }
-            RAP_temp[myend + myid] = jj_counter;
-
-            part_end[myid] = myend + myid + 1;
-        }
-        fasp_iarray_cp(part_end[0], RAP_temp, RAP_i);
-        jj_counter = part_end[0];
-        Ctemp      = 0;
-        for (i1 = 1; i1 < nthreads; i1++) {
-            Ctemp += RAP_temp[part_end[i1 - 1] - 1];
-            for (jj1 = part_end[i1 - 1] + 1; jj1 < part_end[i1]; jj1++) {
-                RAP_i[jj_counter] = RAP_temp[jj1] + Ctemp;
-                jj_counter++;
-            }
-        }
-        RAP_size = RAP_i[n_coarse];
-    }
-
-    else {
-#endif
-        jj_counter = 0;
-        for (ic = 0; ic < n_coarse; ic++) {
-            Ps_marker[ic]   = jj_counter;
-            jj_row_begining = jj_counter;
-            jj_counter++;
-
-            for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                i1 = R_j[jj1];
-
-                for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                    i2 = A_j[jj2];
-                    if (As_marker[i2] != ic) {
-                        As_marker[i2] = ic;
-                        for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                            i3 = P_j[jj3];
-                            if (Ps_marker[i3] < jj_row_begining) {
-                                Ps_marker[i3] = jj_counter;
-                                jj_counter++;
-                            }
-                        }
-                    }
-                }
-            }
-
-            RAP_i[ic] = jj_row_begining;
-        }
-
-        RAP_i[n_coarse] = jj_counter;
-        RAP_size        = jj_counter;
-#ifdef _OPENMP
-    }
-#endif
-
-    RAP_j    = (INT*)fasp_mem_calloc(RAP_size, sizeof(INT));
-    RAP_data = (REAL*)fasp_mem_calloc(RAP_size, sizeof(REAL));
+    RAP->row = R->row;
+    RAP->col = P->col;
 
-    fasp_iarray_set(minus_one_length, Ps_marker, -1);
+    fasp_blas_spgemm(R->row, P->col, P->row, 1, R->IA, R->JA, R->val, A->IA, A->JA,
+                     A->val, P->IA, P->JA, P->val, TRUE, &RAP->IA, &RAP->JA,
+                     &RAP->val);
 
-#ifdef _OPENMP
-    if (n_coarse > OPENMP_HOLDS) {
-#pragma omp parallel for private(myid, mybegin, myend, P_marker, A_marker, jj_counter, \
-                                     ic, jj_row_begining, jj1, r_entry, i1, jj2,       \
-                                     r_a_product, i2, jj3, r_a_p_product, i3)
-        for (myid = 0; myid < nthreads; myid++) {
-            fasp_get_start_end(myid, nthreads, n_coarse, &mybegin, &myend);
-            P_marker   = Ps_marker + myid * n_coarse;
-            A_marker   = As_marker + myid * n_fine;
-            jj_counter = RAP_i[mybegin];
-            for (ic = mybegin; ic < myend; ic++) {
-                P_marker[ic]         = jj_counter;
-                jj_row_begining      = jj_counter;
-                RAP_j[jj_counter]    = ic;
-                RAP_data[jj_counter] = 0.0;
-                jj_counter++;
-                for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                    r_entry = R_data[jj1];
-
-                    i1 = R_j[jj1];
-                    for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                        r_a_product = r_entry * A_data[jj2];
-
-                        i2 = A_j[jj2];
-                        if (A_marker[i2] != ic) {
-                            A_marker[i2] = ic;
-                            for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                                r_a_p_product = r_a_product * P_data[jj3];
-
-                                i3 = P_j[jj3];
-                                if (P_marker[i3] < jj_row_begining) {
-                                    P_marker[i3]         = jj_counter;
-                                    RAP_data[jj_counter] = r_a_p_product;
-                                    RAP_j[jj_counter]    = i3;
-                                    jj_counter++;
-                                } else {
-                                    RAP_data[P_marker[i3]] += r_a_p_product;
-                                }
-                            }
-                        } else {
-                            for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                                i3            = P_j[jj3];
-                                r_a_p_product = r_a_product * P_data[jj3];
-                                RAP_data[P_marker[i3]] += r_a_p_product;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-#endif
-        jj_counter = 0;
-        for (ic = 0; ic < n_coarse; ic++) {
-            Ps_marker[ic]        = jj_counter;
-            jj_row_begining      = jj_counter;
-            RAP_j[jj_counter]    = ic;
-            RAP_data[jj_counter] = 0.0;
-            jj_counter++;
-
-            for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                r_entry = R_data[jj1];
-
-                i1 = R_j[jj1];
-                for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                    r_a_product = r_entry * A_data[jj2];
-
-                    i2 = A_j[jj2];
-                    if (As_marker[i2] != ic) {
-                        As_marker[i2] = ic;
-                        for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                            r_a_p_product = r_a_product * P_data[jj3];
-
-                            i3 = P_j[jj3];
-                            if (Ps_marker[i3] < jj_row_begining) {
-                                Ps_marker[i3]        = jj_counter;
-                                RAP_data[jj_counter] = r_a_p_product;
-                                RAP_j[jj_counter]    = i3;
-                                jj_counter++;
-                            } else {
-                                RAP_data[Ps_marker[i3]] += r_a_p_product;
-                            }
-                        }
-                    } else {
-                        for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                            i3            = P_j[jj3];
-                            r_a_p_product = r_a_product * P_data[jj3];
-                            RAP_data[Ps_marker[i3]] += r_a_p_product;
-                        }
-                    }
-                }
-            }
-        }
-#ifdef _OPENMP
-    }
-#endif
-
-    RAP->row = n_coarse;
-    RAP->col = n_coarse;
-    RAP->nnz = RAP_size;
-    RAP->IA  = RAP_i;
-    RAP->JA  = RAP_j;
-    RAP->val = RAP_data;
-
-    fasp_mem_free(Ps_marker);
-    Ps_marker = NULL;
+    RAP->nnz = RAP->IA[RAP->row];
 }
 
 /**
@@ -1272,251 +1074,127 @@ void fasp_blas_dcsr_rap(const dCSRmat* R,
  * \date   05/10/2010
  *
  * Modified by Chunsheng Feng, Xiaoqiang Yue on 05/26/2012
+ * Modified by agent on 10/18/2026: use the SpGEMM engine
  */
 void fasp_blas_dcsr_rap_agg(const dCSRmat* R,
                             const dCSRmat* A,
                             const dCSRmat* P,
                             dCSRmat*       RAP)
 {
-    const INT  n_coarse = R->row;
-    const INT* R_i      = R->IA;
-    const INT* R_j      = R->JA;
-
-    const INT   n_fine = A->row;
-    const INT*  A_i    = A->IA;
-    const INT*  A_j    = A->JA;
-    const REAL* A_data = A->val;
+    RAP->row = R->row;
+    RAP->col = P->col;
 
-    const INT* P_i = P->IA;
-    const INT* P_j = P->JA;
-
-    INT   RAP_size;
-    INT*  RAP_i    = NULL;
-    INT*  RAP_j    = NULL;
-    REAL* RAP_data = NULL;
-
-#ifdef _OPENMP
-    INT* P_marker = NULL;
-    INT* A_marker = NULL;
-#endif
+    fasp_blas_spgemm(R->row, P->col, P->row, 1, R->IA, R->JA, NULL, A->IA, A->JA,
+                     A->val, P->IA, P->JA, NULL, TRUE, &RAP->IA, &RAP->JA,
+                     &RAP->val);
 
-    INT* Ps_marker = NULL;
-    INT* As_marker = NULL;
+    RAP->nnz = RAP->IA[RAP->row];
+}
 
-    INT ic, i1, i2, i3, jj1, jj2, jj3;
-    INT jj_counter, jj_row_begining;
+/**
+ * \fn void fasp_blas_dcsr_rap_aggmap (const dCSRmat *A, const ivector *map,
+ *                                     const iCSRmat *R, dCSRmat *RAP)
+ *
+ * \brief Galerkin product RAP = P'*A*P with an aggregate map (P is boolean)
+ *
+ * \param A    Pointer to the dCSRmat matrix A
+ * \param map  Pointer to the aggregate of each fine node (negative: no aggregate)
+ * \param R    Pointer to the fine nodes of each aggregate (see fasp_aggmap_trans)
+ * \param RAP  Pointer to dCSRmat matrix equal to P'*A*P
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Same as fasp_blas_dcsr_rap_agg, but P and R are not formed: the entries
+ *       of the rows of each aggregate are summed up by the aggregates of their
+ *       columns. The diagonal entry always comes first in each row of RAP.
+ */
+void fasp_blas_dcsr_rap_aggmap(const dCSRmat* A, const ivector* map, const iCSRmat* R,
+                               dCSRmat* RAP)
+{
+    const INT   nc  = R->row;
+    const INT*  agg = map->val;
+    const INT * ptr = R->IA, *mem = R->JA;
+    const INT * ia = A->IA, *ja = A->JA;
+    const REAL* aj = A->val;
 
+    INT i, j, k, p, I, J, cnt, myid, mybegin, myend;
     INT nthreads = 1;
 
 #ifdef _OPENMP
-    INT myid, mybegin, myend, Ctemp;
-    nthreads = fasp_get_num_threads();
+    if (nc > OPENMP_HOLDS) nthreads = fasp_get_num_threads();
 #endif
 
-    INT coarse_mul_nthreads = n_coarse * nthreads;
-    INT fine_mul_nthreads   = n_fine * nthreads;
-    INT coarse_add_nthreads = n_coarse + nthreads;
-    INT minus_one_length    = coarse_mul_nthreads + fine_mul_nthreads;
-    INT total_calloc        = minus_one_length + coarse_add_nthreads + nthreads;
-
-    Ps_marker = (INT*)fasp_mem_calloc(total_calloc, sizeof(INT));
-    As_marker = Ps_marker + coarse_mul_nthreads;
-
-    /*------------------------------------------------------*
-     *  First Pass: Determine size of RAP and set up RAP_i  *
-     *------------------------------------------------------*/
-    RAP_i = (INT*)fasp_mem_calloc(n_coarse + 1, sizeof(INT));
-
-    fasp_iarray_set(minus_one_length, Ps_marker, -1);
+    // 1. Count nonzeros in each row of RAP
+    INT* IAc    = (INT*)fasp_mem_calloc(nc + 1, sizeof(INT));
+    INT* marker = (INT*)fasp_mem_calloc(nthreads * nc, sizeof(INT));
+    fasp_iarray_set(nthreads * nc, marker, -1);
 
 #ifdef _OPENMP
-    INT* RAP_temp = As_marker + fine_mul_nthreads;
-    INT* part_end = RAP_temp + coarse_add_nthreads;
-
-    if (n_coarse > OPENMP_HOLDS) {
-#pragma omp parallel for private(myid, mybegin, myend, Ctemp, P_marker, A_marker,      \
-                                     jj_counter, ic, jj_row_begining, jj1, i1, jj2,    \
-                                     i2, jj3, i3)
-        for (myid = 0; myid < nthreads; myid++) {
-            fasp_get_start_end(myid, nthreads, n_coarse, &mybegin, &myend);
-            P_marker   = Ps_marker + myid * n_coarse;
-            A_marker   = As_marker + myid * n_fine;
-            jj_counter = 0;
-            for (ic = mybegin; ic < myend; ic++) {
-                P_marker[ic]    = jj_counter;
-                jj_row_begining = jj_counter;
-                jj_counter++;
-
-                for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                    i1 = R_j[jj1];
-                    for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                        i2 = A_j[jj2];
-                        if (A_marker[i2] != ic) {
-                            A_marker[i2] = ic;
-                            for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                                i3 = P_j[jj3];
-                                if (P_marker[i3] < jj_row_begining) {
-                                    P_marker[i3] = jj_counter;
-                                    jj_counter++;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                RAP_temp[ic + myid] = jj_row_begining;
-            }
-            RAP_temp[myend + myid] = jj_counter;
-
-            part_end[myid] = myend + myid + 1;
-        }
-        fasp_iarray_cp(part_end[0], RAP_temp, RAP_i);
-        jj_counter = part_end[0];
-        Ctemp      = 0;
-        for (i1 = 1; i1 < nthreads; i1++) {
-            Ctemp += RAP_temp[part_end[i1 - 1] - 1];
-            for (jj1 = part_end[i1 - 1] + 1; jj1 < part_end[i1]; jj1++) {
-                RAP_i[jj_counter] = RAP_temp[jj1] + Ctemp;
-                jj_counter++;
-            }
-        }
-        RAP_size = RAP_i[n_coarse];
-    }
-
-    else {
+#pragma omp parallel for private(myid, mybegin, myend, I, J, p, i, k, cnt) if (nthreads > 1)
 #endif
-        jj_counter = 0;
-        for (ic = 0; ic < n_coarse; ic++) {
-            Ps_marker[ic]   = jj_counter;
-            jj_row_begining = jj_counter;
-            jj_counter++;
-
-            for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                i1 = R_j[jj1];
-
-                for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                    i2 = A_j[jj2];
-                    if (As_marker[i2] != ic) {
-                        As_marker[i2] = ic;
-                        for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                            i3 = P_j[jj3];
-                            if (Ps_marker[i3] < jj_row_begining) {
-                                Ps_marker[i3] = jj_counter;
-                                jj_counter++;
-                            }
-                        }
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mark = marker + myid * nc;
+        fasp_get_start_end(myid, nthreads, nc, &mybegin, &myend);
+        for (I = mybegin; I < myend; ++I) {
+            mark[I] = I; // diagonal entry
+            for (cnt = 1, p = ptr[I]; p < ptr[I + 1]; ++p) {
+                i = mem[p];
+                for (k = ia[i]; k < ia[i + 1]; ++k) {
+                    J = agg[ja[k]];
+                    if (J >= 0 && mark[J] != I) {
+                        mark[J] = I;
+                        cnt++;
                     }
                 }
             }
-
-            RAP_i[ic] = jj_row_begining;
+            IAc[I + 1] = cnt;
         }
-
-        RAP_i[n_coarse] = jj_counter;
-        RAP_size        = jj_counter;
-#ifdef _OPENMP
     }
-#endif
 
-    RAP_j    = (INT*)fasp_mem_calloc(RAP_size, sizeof(INT));
-    RAP_data = (REAL*)fasp_mem_calloc(RAP_size, sizeof(REAL));
+    for (I = 0; I < nc; ++I) IAc[I + 1] += IAc[I];
 
-    fasp_iarray_set(minus_one_length, Ps_marker, -1);
+    // 2. Sum up entries of A into RAP
+    INT*  JAc = (INT*)fasp_mem_calloc(MAX(IAc[nc], 1), sizeof(INT));
+    REAL* Ac  = (REAL*)fasp_mem_calloc(MAX(IAc[nc], 1), sizeof(REAL));
+    fasp_iarray_set(nthreads * nc, marker, -1);
 
 #ifdef _OPENMP
-    if (n_coarse > OPENMP_HOLDS) {
-#pragma omp parallel for private(myid, mybegin, myend, P_marker, A_marker, jj_counter, \
-                                     ic, jj_row_begining, jj1, i1, jj2, i2, jj3, i3)
-        for (myid = 0; myid < nthreads; myid++) {
-            fasp_get_start_end(myid, nthreads, n_coarse, &mybegin, &myend);
-            P_marker   = Ps_marker + myid * n_coarse;
-            A_marker   = As_marker + myid * n_fine;
-            jj_counter = RAP_i[mybegin];
-            for (ic = mybegin; ic < myend; ic++) {
-                P_marker[ic]         = jj_counter;
-                jj_row_begining      = jj_counter;
-                RAP_j[jj_counter]    = ic;
-                RAP_data[jj_counter] = 0.0;
-                jj_counter++;
-                for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-
-                    i1 = R_j[jj1];
-                    for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-
-                        i2 = A_j[jj2];
-                        if (A_marker[i2] != ic) {
-                            A_marker[i2] = ic;
-                            for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-
-                                i3 = P_j[jj3];
-                                if (P_marker[i3] < jj_row_begining) {
-                                    P_marker[i3]         = jj_counter;
-                                    RAP_data[jj_counter] = A_data[jj2];
-                                    RAP_j[jj_counter]    = i3;
-                                    jj_counter++;
-                                } else {
-                                    RAP_data[P_marker[i3]] += A_data[jj2];
-                                }
-                            }
-                        } else {
-                            for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                                i3 = P_j[jj3];
-                                RAP_data[P_marker[i3]] += A_data[jj2];
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    } else {
+#pragma omp parallel for private(myid, mybegin, myend, I, J, p, i, j, k, cnt) if (nthreads > 1)
 #endif
-        jj_counter = 0;
-        for (ic = 0; ic < n_coarse; ic++) {
-            Ps_marker[ic]        = jj_counter;
-            jj_row_begining      = jj_counter;
-            RAP_j[jj_counter]    = ic;
-            RAP_data[jj_counter] = 0.0;
-            jj_counter++;
-
-            for (jj1 = R_i[ic]; jj1 < R_i[ic + 1]; jj1++) {
-                i1 = R_j[jj1];
-                for (jj2 = A_i[i1]; jj2 < A_i[i1 + 1]; jj2++) {
-                    i2 = A_j[jj2];
-                    if (As_marker[i2] != ic) {
-                        As_marker[i2] = ic;
-                        for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                            i3 = P_j[jj3];
-                            if (Ps_marker[i3] < jj_row_begining) {
-                                Ps_marker[i3]        = jj_counter;
-                                RAP_data[jj_counter] = A_data[jj2];
-                                RAP_j[jj_counter]    = i3;
-                                jj_counter++;
-                            } else {
-                                RAP_data[Ps_marker[i3]] += A_data[jj2];
-                            }
-                        }
+    for (myid = 0; myid < nthreads; ++myid) {
+        INT* mark = marker + myid * nc;
+        fasp_get_start_end(myid, nthreads, nc, &mybegin, &myend);
+        for (I = mybegin; I < myend; ++I) {
+            mark[I]      = IAc[I]; // diagonal entry comes first
+            JAc[IAc[I]]  = I;
+            for (cnt = IAc[I] + 1, p = ptr[I]; p < ptr[I + 1]; ++p) {
+                i = mem[p];
+                for (k = ia[i]; k < ia[i + 1]; ++k) {
+                    J = agg[ja[k]];
+                    if (J < 0) continue;
+                    j = mark[J];
+                    if (j < IAc[I]) { // first time in this row
+                        mark[J]  = cnt;
+                        JAc[cnt] = J;
+                        Ac[cnt]  = aj[k];
+                        cnt++;
                     } else {
-                        for (jj3 = P_i[i2]; jj3 < P_i[i2 + 1]; jj3++) {
-                            i3 = P_j[jj3];
-                            RAP_data[Ps_marker[i3]] += A_data[jj2];
-                        }
+                        Ac[j] += aj[k];
                     }
                 }
             }
         }
-#ifdef _OPENMP
     }
-#endif
 
-    RAP->row = n_coarse;
-    RAP->col = n_coarse;
-    RAP->nnz = RAP_size;
-    RAP->IA  = RAP_i;
-    RAP->JA  = RAP_j;
-    RAP->val = RAP_data;
+    fasp_mem_free(marker);
+    marker = NULL;
 
-    fasp_mem_free(Ps_marker);
-    Ps_marker = NULL;
+    RAP->row = RAP->col = nc;
+    RAP->nnz            = IAc[nc];
+    RAP->IA             = IAc;
+    RAP->JA             = JAc;
+    RAP->val            = Ac;
 }
 
 /**
@@ -1733,108 +1411,52 @@ void fasp_blas_dcsr_rap_agg1(const dCSRmat* R,
  * \date   05/10/2010
  *
  * Modified by Chunsheng Feng, Zheng Li on 10/19/2012
- *
- * \note Driver to compute triple matrix product P'*A*P using ltz CSR format.
- *       In ltx format: ia[0]=1, ja[0] and a[0] are used as usual. When called
- *       from Fortran, ia[0], ja[0] and a[0] will be just ia(1),ja(1),a(1).
- *       For the indices,
- *           ia_ltz[k] = ia_usual[k]+1,
- *           ja_ltz[k] = ja_usual[k]+1,
- *            a_ltz[k] =  a_usual[k].
+ * Modified by agent on 10/18/2026: use the SpGEMM engine
  */
 void fasp_blas_dcsr_ptap(const dCSRmat* Pt,
                          const dCSRmat* A,
                          const dCSRmat* P,
                          dCSRmat*       Ac)
 {
-    const INT nc = Pt->row, n = Pt->col, nnzP = P->nnz, nnzA = A->nnz;
-    INT       i, maxrpout;
-
-    // shift A from usual to ltz format
-#ifdef _OPENMP
-#pragma omp parallel for if (n > OPENMP_HOLDS)
-#endif
-    for (i = 0; i <= n; ++i) {
-        A->IA[i]++;
-        P->IA[i]++;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel for if (nnzA > OPENMP_HOLDS)
-#endif
-    for (i = 0; i < nnzA; ++i) {
-        A->JA[i]++;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel for if (nc > OPENMP_HOLDS)
-#endif
-    for (i = 0; i <= nc; ++i) {
-        Pt->IA[i]++;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel for if (nnzP > OPENMP_HOLDS)
-#endif
-    for (i = 0; i < nnzP; ++i) {
-        P->JA[i]++;
-        Pt->JA[i]++;
-    }
-
-    // compute P' A P
-    dCSRmat PtAP =
-        fasp_blas_dcsr_rap2(Pt->IA, Pt->JA, Pt->val, A->IA, A->JA, A->val, Pt->IA,
-                            Pt->JA, Pt->val, n, nc, &maxrpout, P->IA, P->JA);
-
-    Ac->row = PtAP.row;
-    Ac->col = PtAP.col;
-    Ac->nnz = PtAP.nnz;
-    Ac->IA  = PtAP.IA;
-    Ac->JA  = PtAP.JA;
-    Ac->val = PtAP.val;
-
-    // shift A back from ltz format
-#ifdef _OPENMP
-#pragma omp parallel for if (Ac->row > OPENMP_HOLDS)
-#endif
-    for (i = 0; i <= Ac->row; ++i) Ac->IA[i]--;
-
-#ifdef _OPENMP
-#pragma omp parallel for if (Ac->nnz > OPENMP_HOLDS)
-#endif
-    for (i = 0; i < Ac->nnz; ++i) Ac->JA[i]--;
+    Ac->row = Pt->row;
+    Ac->col = P->col;
 
-#ifdef _OPENMP
-#pragma omp parallel for if (n > OPENMP_HOLDS)
-#endif
-    for (i = 0; i <= n; ++i) A->IA[i]--;
-
-#ifdef _OPENMP
-#pragma omp parallel for if (nnzA > OPENMP_HOLDS)
-#endif
-    for (i = 0; i < nnzA; ++i) A->JA[i]--;
+    fasp_blas_spgemm(Pt->row, P->col, P->row, 1, Pt->IA, Pt->JA, Pt->val, A->IA,
+                     A->JA, A->val, P->IA, P->JA, P->val, TRUE, &Ac->IA, &Ac->JA,
+                     &Ac->val);
 
-#ifdef _OPENMP
-#pragma omp parallel for if (n > OPENMP_HOLDS)
-#endif
-    for (i = 0; i <= n; ++i) P->IA[i]--;
-
-#ifdef _OPENMP
-#pragma omp parallel for if (nnzP > OPENMP_HOLDS)
-#endif
-    for (i = 0; i < nnzP; ++i) P->JA[i]--;
+    Ac->nnz = Ac->IA[Ac->row];
+}
 
-#ifdef _OPENMP
-#pragma omp parallel for if (nc > OPENMP_HOLDS)
-#endif
-    for (i = 0; i <= nc; ++i) Pt->IA[i]--;
+/**
+ * \fn void fasp_blas_dcsr_ptap_map (const iCSRmat *Pt, const dCSRmat *A,
+ *                                   const dCSRmat *P, dCSRmat *Ac)
+ *
+ * \brief Triple sparse matrix multiplication B=P'*A*P without storing P'
+ *
+ * \param Pt  Pointer to the pattern of P' with positions in P (see fasp_dcsr_trans_map)
+ * \param A   Pointer to the fine coefficient matrix
+ * \param P   Pointer to the prolongation matrix
+ * \param Ac  Pointer to the coarse coefficient matrix (output)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Ac is the same as the one given by fasp_blas_dcsr_ptap with R = P'.
+ */
+void fasp_blas_dcsr_ptap_map(const iCSRmat* Pt,
+                             const dCSRmat* A,
+                             const dCSRmat* P,
+                             dCSRmat*       Ac)
+{
+    Ac->row = Pt->row;
+    Ac->col = P->col;
 
-#ifdef _OPENMP
-#pragma omp parallel for if (nnzP > OPENMP_HOLDS)
-#endif
-    for (i = 0; i < nnzP; ++i) Pt->JA[i]--;
+    fasp_blas_spgemm_ptap(Pt->row, P->col, P->row, Pt->IA, Pt->JA, Pt->val, A->IA,
+                          A->JA, A->val, P->IA, P->JA, P->val, TRUE, &Ac->IA,
+                          &Ac->JA, &Ac->val);
 
-    return;
+    Ac->nnz = Ac->IA[Ac->row];
 }
 
 /*!
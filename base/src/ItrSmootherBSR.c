@@ -36,6 +36,9 @@ static inline void invperm(const INT, const INT, const REAL*, const INT*, REAL*)
 
 #endif
 
+static inline void l1gs_block_bsr(const dBSRmat*, const REAL*, const REAL*, REAL*,
+                                  const REAL*, const INT, const INT, const INT, REAL*);
+
 REAL ilu_solve_time = 0.0; /**< ILU time for the SOLVE phase */
 
 /*---------------------------------*/
@@ -386,6 +389,88 @@ void fasp_smoother_dbsr_jacobi1(dBSRmat* A, dvector* b, dvector* u, REAL* diagin
     }
 }
 
+/**
+ * \fn void fasp_smoother_dbsr_cheby (dBSRmat *A, dvector *b, dvector *u,
+ *                                    REAL *diaginv, const REAL lmin,
+ *                                    const REAL lmax, const INT ndeg)
+ *
+ * \brief Chebyshev polynomial relaxation for D^{-1}A on [lmin, lmax]
+ *
+ * \param A        Pointer to dBSRmat: the coefficient matrix
+ * \param b        Pointer to dvector: the right hand side
+ * \param u        Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param diaginv  Inverses for all the diagonal blocks of A
+ * \param lmin     Lower bound of the eigenvalues of D^{-1}A to be damped
+ * \param lmax     Upper bound of the eigenvalues of D^{-1}A
+ * \param ndeg     Degree of the Chebyshev polynomial
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_smoother_dbsr_cheby(dBSRmat* A, dvector* b, dvector* u, REAL* diaginv,
+                              const REAL lmin, const REAL lmax, const INT ndeg)
+{
+    // members of A
+    const INT ROW  = A->ROW;
+    const INT nb   = A->nb;
+    const INT nb2  = nb * nb;
+    const INT size = ROW * nb;
+
+    // Chebyshev parameters on [lmin, lmax]
+    const REAL theta = 0.5 * (lmax + lmin);
+    const REAL delta = 0.5 * (lmax - lmin);
+    const REAL sigma = theta / delta;
+
+    REAL* u_val = u->val;
+    REAL *r, *z, *d;
+    REAL  rho, rho1, c1, c2;
+    INT   i, j;
+
+    if (ROW <= 0 || lmax <= 0.0 || delta <= 0.0) return;
+
+    r = (REAL*)fasp_mem_calloc(3 * size, sizeof(REAL));
+    z = r + size;
+    d = z + size;
+
+    rho = 1.0 / sigma;
+
+    for (j = 0; j < ndeg; ++j) {
+
+        if (j == 0) {
+            c1 = 0.0;
+            c2 = 1.0 / theta;
+        } else {
+            rho1 = 1.0 / (2.0 * sigma - rho);
+            c1   = rho1 * rho;
+            c2   = 2.0 * rho1 / delta;
+            rho  = rho1;
+        }
+
+        // r = b - Au
+        fasp_darray_cp(size, b->val, r);
+        fasp_blas_dbsr_aAxpy(-1.0, A, u_val, r);
+
+        // z = D^{-1}r
+#ifdef _OPENMP
+#pragma omp parallel for if (ROW > OPENMP_HOLDS)
+#endif
+        for (i = 0; i < ROW; ++i)
+            fasp_blas_smat_mxv(diaginv + i * nb2, r + i * nb, z + i * nb, nb);
+
+        // d = c1*d + c2*z, u = u + d
+#ifdef _OPENMP
+#pragma omp parallel for if (size > OPENMP_HOLDS)
+#endif
+        for (i = 0; i < size; ++i) {
+            d[i] = c1 * d[i] + c2 * z[i];
+            u_val[i] += d[i];
+        }
+    }
+
+    fasp_mem_free(r);
+    r = NULL;
+}
+
 /**
  * \fn void fasp_smoother_dbsr_gs (dBSRmat *A, dvector *b, dvector *u, INT order,
  *                                 INT *mark)
@@ -798,6 +883,67 @@ void fasp_smoother_dbsr_gs_descend1(dBSRmat* A, dvector* b, dvector* u)
     }
 }
 
+/**
+ * \fn void fasp_smoother_dbsr_l1gs (dBSRmat *A, dvector *b, dvector *u,
+ *                                   REAL *diaginv, const INT order)
+ *
+ * \brief Hybrid block l1-Gauss-Seidel relaxation
+ *
+ * \param A        Pointer to dBSRmat: the coefficient matrix
+ * \param b        Pointer to dvector: the right hand side
+ * \param u        Pointer to dvector: the unknowns (IN: initial guess, OUT: approximation)
+ * \param diaginv  Inverses for all the diagonal blocks of A
+ * \param order    Sweep order: ASCEND or DESCEND
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Block version of fasp_smoother_dcsr_l1gs: each thread runs block
+ *       Gauss-Seidel on its own block rows and uses the old values of u for the
+ *       couplings to other threads. Rows with such couplings add the l1 norms of
+ *       their rows in these blocks to the diagonal of A_ii and invert it on the
+ *       fly; all other rows use diaginv, so no extra setup is needed.
+ */
+void fasp_smoother_dbsr_l1gs(dBSRmat* A, dvector* b, dvector* u, REAL* diaginv,
+                             const INT order)
+{
+    const INT ROW = A->ROW;
+    const INT nb  = A->nb;
+    const INT nw  = nb * nb + 2 * nb; // work space of one thread
+    REAL*     u_val = u->val;
+
+#ifdef _OPENMP
+    const INT nthreads = fasp_get_num_threads();
+    INT       myid, mybegin, myend;
+
+    if (ROW > OPENMP_HOLDS && nthreads > 1) {
+        REAL* uold = (REAL*)fasp_mem_calloc(ROW * nb, sizeof(REAL));
+        REAL* work = (REAL*)fasp_mem_calloc(nthreads * nw, sizeof(REAL));
+
+        fasp_darray_cp(ROW * nb, u_val, uold);
+#pragma omp parallel for private(myid, mybegin, myend)
+        for (myid = 0; myid < nthreads; myid++) {
+            fasp_get_start_end(myid, nthreads, ROW, &mybegin, &myend);
+            l1gs_block_bsr(A, b->val, uold, u_val, diaginv, mybegin, myend, order,
+                           work + myid * nw);
+        }
+
+        fasp_mem_free(work);
+        work = NULL;
+        fasp_mem_free(uold);
+        uold = NULL;
+        return;
+    }
+#endif
+
+    {
+        REAL* work = (REAL*)fasp_mem_calloc(nw, sizeof(REAL));
+        l1gs_block_bsr(A, b->val, u_val, u_val, diaginv, 0, ROW, order, work);
+        fasp_mem_free(work);
+        work = NULL;
+    }
+}
+
 /**
  * \fn void fasp_smoother_dbsr_gs_order1 (dBSRmat *A, dvector *b, dvector *u,
  *                                        REAL *diaginv, INT *mark)
@@ -1613,6 +1759,87 @@ invperm(const INT n, const INT nb, const REAL* x, const INT* p, REAL* y)
 
 #endif // end of _OPENMP
 
+/**
+ * \fn static inline void l1gs_block_bsr (const dBSRmat *A, const REAL *b,
+ *                                        const REAL *uold, REAL *u,
+ *                                        const REAL *diaginv, const INT begin,
+ *                                        const INT end, const INT order,
+ *                                        REAL *work)
+ *
+ * \brief One block l1-Gauss-Seidel sweep over the block rows [begin, end)
+ *
+ * \param A        Pointer to dBSRmat: the coefficient matrix
+ * \param b        Pointer to the right hand side
+ * \param uold     Values of u for the block columns outside [begin, end)
+ * \param u        Pointer to the unknowns
+ * \param diaginv  Inverses for all the diagonal blocks of A
+ * \param begin    First block row
+ * \param end      One past the last block row
+ * \param order    Sweep order: ASCEND or DESCEND
+ * \param work     Work space of size nb*nb+2*nb
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void l1gs_block_bsr(const dBSRmat* A,
+                                  const REAL*    b,
+                                  const REAL*    uold,
+                                  REAL*          u,
+                                  const REAL*    diaginv,
+                                  const INT      begin,
+                                  const INT      end,
+                                  const INT      order,
+                                  REAL*          work)
+{
+    const INT   nb = A->nb, nb2 = nb * nb;
+    const INT * IA = A->IA, *JA = A->JA;
+    const REAL* val = A->val;
+
+    const INT first = (order == DESCEND) ? end - 1 : begin;
+    const INT last  = (order == DESCEND) ? begin - 1 : end;
+    const INT s     = (order == DESCEND) ? -1 : 1;
+
+    REAL* rhs  = work;
+    REAL* l1   = work + nb;
+    REAL* diag = work + 2 * nb;
+
+    INT   i, j, k, r, c, kd;
+    SHORT coupled;
+
+    for (i = first; i != last; i += s) {
+        memcpy(rhs, b + i * nb, nb * sizeof(REAL));
+        fasp_darray_set(nb, l1, 0.0);
+        coupled = FALSE, kd = -1;
+
+        for (k = IA[i]; k < IA[i + 1]; ++k) {
+            j = JA[k];
+            if (j == i)
+                kd = k;
+            else if (j >= begin && j < end)
+                fasp_blas_smat_ymAx(val + k * nb2, u + j * nb, rhs, nb);
+            else {
+                fasp_blas_smat_ymAx(val + k * nb2, uold + j * nb, rhs, nb);
+                for (r = 0; r < nb; ++r)
+                    for (c = 0; c < nb; ++c) l1[r] += ABS(val[k * nb2 + r * nb + c]);
+                coupled = TRUE;
+            }
+        }
+
+        if (!coupled) {
+            fasp_blas_smat_mxv(diaginv + i * nb2, rhs, u + i * nb, nb);
+        } else if (kd >= 0) {
+            // (A_ii + diag(l1)) u_i = rhs + diag(l1) u_i
+            memcpy(diag, val + kd * nb2, nb2 * sizeof(REAL));
+            for (r = 0; r < nb; ++r) {
+                diag[r * nb + r] += l1[r];
+                rhs[r] += l1[r] * u[i * nb + r];
+            }
+            fasp_smat_inv(diag, nb);
+            fasp_blas_smat_mxv(diag, rhs, u + i * nb, nb);
+        }
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
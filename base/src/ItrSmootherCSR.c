@@ -4,7 +4,7 @@
  *
  *  \note  This file contains Level-2 (Itr) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxThreads.c, BlaArray.c,
- *         and BlaSpmvCSR.c
+ *         BlaILUSetupCSR.c, and BlaSpmvCSR.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
@@ -21,6 +21,13 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static inline void l1gs_block(const dCSRmat*, const REAL*, const REAL*, REAL*,
+                              const INT, const INT, const INT);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -908,6 +915,152 @@ void fasp_smoother_dcsr_sgs(dvector* u, dCSRmat* A, dvector* b, INT L)
     return;
 }
 
+/**
+ * \fn void fasp_smoother_dcsr_l1gs (dvector *u, dCSRmat *A, dvector *b,
+ *                                   const INT order, INT L)
+ *
+ * \brief Hybrid l1-Gauss-Seidel method as a smoother
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSRmat: the coefficient matrix
+ * \param b      Pointer to dvector: the right hand side
+ * \param order  Sweep order: ASCEND or DESCEND
+ * \param L      Number of iterations
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The rows are split into contiguous blocks, one for each thread. Every
+ *       thread runs Gauss-Seidel on its own block and treats the couplings to
+ *       other blocks as Jacobi, i.e. with the values of u from the start of the
+ *       sweep. The l1 norm of these couplings is added to the diagonal, so the
+ *       smoother converges for SPD matrices with any number of threads. It needs
+ *       no setup; with one thread it is the standard Gauss-Seidel method.
+ */
+void fasp_smoother_dcsr_l1gs(dvector* u, dCSRmat* A, dvector* b, const INT order, INT L)
+{
+    const INT n    = A->row;
+    REAL*     uval = u->val;
+
+#ifdef _OPENMP
+    const INT nthreads = fasp_get_num_threads();
+    INT       myid, mybegin, myend;
+
+    if (n > OPENMP_HOLDS && nthreads > 1) {
+        REAL* uold = (REAL*)fasp_mem_calloc(n, sizeof(REAL));
+
+        while (L--) {
+            fasp_darray_cp(n, uval, uold);
+#pragma omp parallel for private(myid, mybegin, myend)
+            for (myid = 0; myid < nthreads; myid++) {
+                fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+                l1gs_block(A, b->val, uold, uval, mybegin, myend, order);
+            }
+        }
+
+        fasp_mem_free(uold);
+        uold = NULL;
+        return;
+    }
+#endif
+
+    while (L--) l1gs_block(A, b->val, uval, uval, 0, n, order);
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_l1sgs (dvector *u, dCSRmat *A, dvector *b, INT L)
+ *
+ * \brief Hybrid symmetric l1-Gauss-Seidel method as a smoother
+ *
+ * \param u    Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A    Pointer to dCSRmat: the coefficient matrix
+ * \param b    Pointer to dvector: the right hand side
+ * \param L    Number of iterations
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note A forward and a backward sweep of fasp_smoother_dcsr_l1gs per iteration.
+ */
+void fasp_smoother_dcsr_l1sgs(dvector* u, dCSRmat* A, dvector* b, INT L)
+{
+    while (L--) {
+        fasp_smoother_dcsr_l1gs(u, A, b, ASCEND, 1);
+        fasp_smoother_dcsr_l1gs(u, A, b, DESCEND, 1);
+    }
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_gs_multicolor_perm (dvector *u, dCSRmat *Amc,
+ *                                                 const REAL *dinv, dvector *b,
+ *                                                 INT L, const INT order,
+ *                                                 REAL *work)
+ *
+ * \brief Multicolor Gauss-Seidel method on a color-permuted matrix
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param Amc    Off-diagonal part of A in color order, see fasp_dcsr_multicolor_perm
+ * \param dinv   Inverse diagonal of A in color order
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ * \param order  1: from the first color to the last; -1: the other way around
+ * \param work   Work space of size 2*row
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Same iterates as fasp_smoother_dcsr_gs_multicolor. u and b are permuted
+ *       to color order on entry and u is permuted back on exit, so the sweeps
+ *       stream through contiguous rows without searching for the diagonal.
+ */
+void fasp_smoother_dcsr_gs_multicolor_perm(dvector*    u,
+                                           dCSRmat*    Amc,
+                                           const REAL* dinv,
+                                           dvector*    b,
+                                           INT         L,
+                                           const INT   order,
+                                           REAL*       work)
+{
+#if MULTI_COLOR_ORDER
+    const INT   n = Amc->row, ncolor = Amc->color;
+    const INT * ia = Amc->IA, *ja = Amc->JA, *IC = Amc->IC, *ICMAP = Amc->ICMAP;
+    const REAL* aval = Amc->val;
+    REAL *      xp = work, *bp = work + n;
+
+    INT  c, ic, I, k;
+    REAL t;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(I) if (n > OPENMP_HOLDS)
+#endif
+    for (I = 0; I < n; ++I) {
+        xp[I] = u->val[ICMAP[I]];
+        bp[I] = b->val[ICMAP[I]];
+    }
+
+    while (L--) {
+        for (c = 0; c < ncolor; ++c) {
+            ic = (order == -1) ? ncolor - 1 - c : c;
+#ifdef _OPENMP
+#pragma omp parallel for private(I, k, t) if (IC[ic + 1] - IC[ic] > OPENMP_HOLDS)
+#endif
+            for (I = IC[ic]; I < IC[ic + 1]; ++I) {
+                t = bp[I];
+                for (k = ia[I]; k < ia[I + 1]; ++k) t -= aval[k] * xp[ja[k]];
+                if (dinv[I] != 0.0) xp[I] = t * dinv[I];
+            }
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(I) if (n > OPENMP_HOLDS)
+#endif
+    for (I = 0; I < n; ++I) u->val[ICMAP[I]] = xp[I];
+#else
+    printf("### ERROR: MULTI_COLOR_ORDER  has not been turn on!!! \n");
+#endif
+}
+
 /**
  * \fn void fasp_smoother_dcsr_sor (dvector *u, const INT i_1, const INT i_n,
  *                                  const INT s, dCSRmat *A, dvector *b, INT L,
@@ -1276,59 +1429,46 @@ void fasp_smoother_dcsr_sor_cf(
  *
  * \author Shiquan Zhang, Xiaozhe Hu
  * \date   2010/11/12
+ *
+ * Modified by agent on 10/18/2026: level-scheduled solves of reordered ILU factors
  */
 void fasp_smoother_dcsr_ilu(dCSRmat* A, dvector* b, dvector* x, void* data)
 {
     const INT       m = A->row, m2 = 2 * m, memneed = 3 * m;
     const ILU_data* iludata = (ILU_data*)data;
+    const INT*      perm    = iludata->perm;
 
     REAL* zz = iludata->work;
     REAL* zr = iludata->work + m;
     REAL* z  = iludata->work + m2;
+    INT   i;
 
     if (iludata->nwork < memneed) goto MEMERR;
 
     {
-        INT   i, j, jj, begin_row, end_row;
-        REAL* lu   = iludata->luval;
-        INT*  ijlu = iludata->ijlu;
         REAL *xval = x->val, *bval = b->val;
 
-        /** form residual zr = b - A x */
-        fasp_darray_cp(m, bval, zr);
-        fasp_blas_dcsr_aAxpy(-1.0, A, xval, zr);
+        if (perm == NULL) {
+            /** form residual zr = b - A x */
+            fasp_darray_cp(m, bval, zr);
+            fasp_blas_dcsr_aAxpy(-1.0, A, xval, zr);
+        } else {
+            /** form residual z = b - A x and reorder it as LU = PAP' */
+            fasp_darray_cp(m, bval, z);
+            fasp_blas_dcsr_aAxpy(-1.0, A, xval, z);
+            for (i = 0; i < m; ++i) zr[i] = z[perm[i]];
+        }
 
         // forward sweep: solve unit lower matrix equation L*zz=zr
-        zz[0] = zr[0];
-        for (i = 1; i < m; ++i) {
-            begin_row = ijlu[i];
-            end_row   = ijlu[i + 1];
-            for (j = begin_row; j < end_row; ++j) {
-                jj = ijlu[j];
-                if (jj < i)
-                    zr[i] -= lu[j] * zz[jj];
-                else
-                    break;
-            }
-            zz[i] = zr[i];
-        }
+        fasp_ilu_dcsr_lsolve(iludata, zr, zz);
 
         // backward sweep: solve upper matrix equation U*z=zz
-        z[m - 1] = zz[m - 1] * lu[m - 1];
-        for (i = m - 2; i >= 0; --i) {
-            begin_row = ijlu[i];
-            end_row   = ijlu[i + 1] - 1;
-            for (j = end_row; j >= begin_row; --j) {
-                jj = ijlu[j];
-                if (jj > i)
-                    zz[i] -= lu[j] * z[jj];
-                else
-                    break;
-            }
-            z[i] = zz[i] * lu[i];
-        }
+        fasp_ilu_dcsr_usolve(iludata, zz, z);
 
-        fasp_blas_darray_axpy(m, 1, z, xval);
+        if (perm == NULL)
+            fasp_blas_darray_axpy(m, 1, z, xval);
+        else
+            for (i = 0; i < m; ++i) xval[perm[i]] += z[i];
     }
 
     return;
@@ -1339,6 +1479,54 @@ MEMERR:
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
 
+/**
+ * \fn void fasp_smoother_dcsr_bjilu (dvector *u, dCSRmat *A, dvector *b,
+ *                                    BJILU_data *bjdata, INT L)
+ *
+ * \brief Block-Jacobi ILU method as a smoother
+ *
+ * \param u       Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A       Pointer to dCSRmat: the coefficient matrix
+ * \param b       Pointer to dvector: the right hand side
+ * \param bjdata  Pointer to BJILU_data from fasp_ilu_dcsr_setup_bj
+ * \param L       Number of iterations
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each sweep is u = u + B^{-1}(b - Au), where B is the block diagonal part
+ *       of A and B^{-1} is approximated by the ILU factors of its blocks.
+ */
+void fasp_smoother_dcsr_bjilu(dvector* u, dCSRmat* A, dvector* b, BJILU_data* bjdata,
+                              INT L)
+{
+    const INT  m     = A->row;
+    const INT  nblk  = bjdata->nblk;
+    const INT* start = bjdata->start;
+    REAL*      r     = bjdata->work;
+    REAL*      z     = bjdata->work + m;
+    REAL*      uval  = u->val;
+    INT        k;
+
+    while (L--) {
+        // form residual r = b - A u
+        fasp_darray_cp(m, b->val, r);
+        fasp_blas_dcsr_aAxpy(-1.0, A, uval, r);
+
+        // solve with all diagonal blocks concurrently: z = B^{-1} r
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) if (nblk > 1)
+#endif
+        for (k = 0; k < nblk; ++k) {
+            ILU_data* LU = &bjdata->LU[k];
+            fasp_ilu_dcsr_lsolve(LU, r + start[k], LU->work);
+            fasp_ilu_dcsr_usolve(LU, LU->work, z + start[k]);
+        }
+
+        fasp_blas_darray_axpy(m, 1.0, z, uval);
+    }
+}
+
 /**
  * \fn void fasp_smoother_dcsr_kaczmarz (dvector *u, const INT i_1, const INT i_n,
  *                                       const INT s, dCSRmat *A, dvector *b,
@@ -1743,6 +1931,65 @@ static dCSRmat form_contractor (dCSRmat    *A,
 }
 #endif
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static inline void l1gs_block (const dCSRmat *A, const REAL *b,
+ *                                    const REAL *uold, REAL *u, const INT begin,
+ *                                    const INT end, const INT order)
+ *
+ * \brief One l1-Gauss-Seidel sweep over the rows [begin, end)
+ *
+ * \param A      Pointer to dCSRmat: the coefficient matrix
+ * \param b      Pointer to the right hand side
+ * \param uold   Values of u for the columns outside [begin, end)
+ * \param u      Pointer to the unknowns
+ * \param begin  First row of the block
+ * \param end    One past the last row of the block
+ * \param order  Sweep order: ASCEND or DESCEND
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void l1gs_block(const dCSRmat* A,
+                              const REAL*    b,
+                              const REAL*    uold,
+                              REAL*          u,
+                              const INT      begin,
+                              const INT      end,
+                              const INT      order)
+{
+    const INT * ia = A->IA, *ja = A->JA;
+    const REAL* aval = A->val;
+
+    const INT first = (order == DESCEND) ? end - 1 : begin;
+    const INT last  = (order == DESCEND) ? begin - 1 : end;
+    const INT s     = (order == DESCEND) ? -1 : 1;
+
+    INT  i, j, k;
+    REAL t, d, l1;
+
+    for (i = first; i != last; i += s) {
+        t = b[i], d = 0.0, l1 = 0.0;
+        for (k = ia[i]; k < ia[i + 1]; ++k) {
+            j = ja[k];
+            if (j == i)
+                d = aval[k];
+            else if (j >= begin && j < end)
+                t -= aval[k] * u[j];
+            else {
+                t -= aval[k] * uold[j];
+                l1 += ABS(aval[k]);
+            }
+        }
+        // u_i += r_i / (a_ii + l1_i), with the in-block values already updated
+        d += l1;
+        if (ABS(d) > SMALLREAL) u[i] = (t + l1 * u[i]) / d;
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
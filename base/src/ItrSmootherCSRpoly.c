@@ -309,6 +309,92 @@ void fasp_smoother_dcsr_poly_old (dCSRmat *Amat,
     return; 
 }
 
+/**
+ * \fn void fasp_smoother_dcsr_cheby (dvector *u, dCSRmat *A, dvector *b,
+ *                                    const REAL *dinv, const REAL lmin,
+ *                                    const REAL lmax, INT ndeg, INT L)
+ *
+ * \brief Chebyshev polynomial smoother for D^{-1}A on [lmin, lmax]
+ *
+ * \param u     Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A     Pointer to dCSRmat: the coefficient matrix
+ * \param b     Pointer to dvector: the right hand side
+ * \param dinv  Inverse of the diagonal of A
+ * \param lmin  Lower bound of the eigenvalues of D^{-1}A to be damped
+ * \param lmax  Upper bound of the eigenvalues of D^{-1}A
+ * \param ndeg  Degree of the Chebyshev polynomial
+ * \param L     Number of iterations
+ *
+ * \note Only SpMV and vector updates are needed, so the smoother is as parallel
+ *       as Jacobi. The eigenvalue bounds are computed once in the AMG setup by
+ *       fasp_amg_cheby_setup.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_smoother_dcsr_cheby (dvector     *u,
+                               dCSRmat     *A,
+                               dvector     *b,
+                               const REAL  *dinv,
+                               const REAL   lmin,
+                               const REAL   lmax,
+                               INT          ndeg,
+                               INT          L)
+{
+    const INT   n = A->row;
+    const INT  *ia = A->IA, *ja = A->JA;
+    const REAL *aj = A->val, *bval = b->val;
+    REAL       *uval = u->val;
+
+    // Chebyshev parameters on [lmin, lmax]
+    const REAL theta = 0.5 * (lmax + lmin);
+    const REAL delta = 0.5 * (lmax - lmin);
+    const REAL sigma = theta / delta;
+
+    REAL *d, rho, rho1, c1, c2, t;
+    INT   i, j, k;
+
+    if ( n <= 0 || lmax <= 0.0 || delta <= 0.0 ) return;
+
+    d = (REAL *)fasp_mem_calloc(n,sizeof(REAL));
+
+    while ( L-- ) {
+
+        rho = 1.0 / sigma;
+
+        for ( j = 0; j < ndeg; ++j ) {
+
+            if ( j == 0 ) {
+                c1 = 0.0; c2 = 1.0 / theta;
+            }
+            else {
+                rho1 = 1.0 / (2.0 * sigma - rho);
+                c1   = rho1 * rho;
+                c2   = 2.0 * rho1 / delta;
+                rho  = rho1;
+            }
+
+            // d = c1*d + c2*D^{-1}(b - Au)
+#ifdef _OPENMP
+#pragma omp parallel for private(i,k,t) if(n>OPENMP_HOLDS)
+#endif
+            for ( i = 0; i < n; ++i ) {
+                t = bval[i];
+                for ( k = ia[i]; k < ia[i+1]; ++k ) t -= aj[k] * uval[ja[k]];
+                d[i] = c1 * d[i] + c2 * dinv[i] * t;
+            }
+
+            // u = u + d
+#ifdef _OPENMP
+#pragma omp parallel for if(n>OPENMP_HOLDS)
+#endif
+            for ( i = 0; i < n; ++i ) uval[i] += d[i];
+        }
+    }
+
+    fasp_mem_free(d); d = NULL;
+}
+
 /*---------------------------------*/
 /*--      Private Functions      --*/
 /*---------------------------------*/
@@ -3,8 +3,8 @@
  *  \brief Krylov subspace methods -- Preconditioned CG
  *
  *  \note  This file contains Level-3 (Kry) functions. It requires:
- *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, BlaSpmvBLC.c,
- *         BlaSpmvBSR.c, BlaSpmvCSR.c, and BlaSpmvSTR.c
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, BlaEigen.c,
+ *         BlaSpmvBLC.c, BlaSpmvBSR.c, BlaSpmvCSR.c, and BlaSpmvSTR.c
  *
  *  \note  See KrySPcg.c for a safer version
  *
@@ -92,10 +92,53 @@
  *
  * \author Chensong Zhang, Xiaozhe Hu, Shiquan Zhang
  * \date   05/06/2010
+ *
+ * Modified by agent on 10/18/2026: call fasp_solver_dcsr_pcg_eig
  */
 INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
                          const REAL tol, const REAL abstol, const INT MaxIt,
                          const SHORT StopType, const SHORT PrtLvl)
+{
+    return fasp_solver_dcsr_pcg_eig(A, b, u, pc, tol, abstol, MaxIt, StopType, PrtLvl,
+                                    NULL, NULL);
+}
+
+/**
+ * \fn INT fasp_solver_dcsr_pcg_eig (dCSRmat *A, dvector *b, dvector *u,
+ *                                   precond *pc, const REAL tol, const REAL abstol,
+ *                                   const INT MaxIt, const SHORT StopType,
+ *                                   const SHORT PrtLvl, REAL *lmin, REAL *lmax)
+ *
+ * \brief Preconditioned conjugate gradient method for solving Au=b, which also
+ *        estimates the extreme eigenvalues of the preconditioned operator
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand side
+ * \param u            Pointer to dvector: unknowns
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for relative residual
+ * \param abstol       Tolerance for absolute residual
+ * \param MaxIt        Maximal number of iterations
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ * \param lmin         Smallest eigenvalue estimate of BA (OUT); NULL to skip
+ * \param lmax         Largest eigenvalue estimate of BA (OUT); NULL to skip
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \note The CG coefficients define the Lanczos matrix T with
+ *       T(j,j) = 1/alpha_j + beta_{j-1}/alpha_{j-1} and
+ *       T(j,j+1) = sqrt(beta_j)/alpha_j, whose extreme eigenvalues are returned.
+ *       Only the steps before the first restart are used. No extra matrix or
+ *       preconditioner applications are needed.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+INT fasp_solver_dcsr_pcg_eig(dCSRmat* A, dvector* b, dvector* u, precond* pc,
+                             const REAL tol, const REAL abstol, const INT MaxIt,
+                             const SHORT StopType, const SHORT PrtLvl, REAL* lmin,
+                             REAL* lmax)
 {
     const SHORT MaxStag = MAX_STAG, MaxRestartStep = MAX_RESTART;
     const INT   m           = b->row;
@@ -108,11 +151,18 @@ INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
     REAL relres = BIGREAL, normu = BIGREAL, normr0 = BIGREAL;
     REAL reldiff, factor, normuinf;
     REAL alpha, beta, temp1, temp2;
+    INT  i;
 
     // allocate temp memory (need 4*m REAL numbers)
     REAL* work = (REAL*)fasp_mem_calloc(4 * m, sizeof(REAL));
     REAL *p = work, *z = work + m, *r = z + m, *t = r + m;
 
+    // CG coefficients for the eigenvalue estimates
+    SHORT record = (lmin != NULL && lmax != NULL);
+    INT   nrec   = 0;
+    REAL* cgcoef = record ? (REAL*)fasp_mem_calloc(2 * MaxIt + 2, sizeof(REAL)) : NULL;
+    REAL *cga = cgcoef, *cgb = record ? cgcoef + MaxIt + 1 : NULL;
+
     // Output some info for debugging
     if (PrtLvl > PRINT_NONE) printf("\nCalling CG solver (CSR) ...\n");
 
@@ -176,6 +226,8 @@ INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
             goto FINISHED;
         }
 
+        if (record) cga[nrec++] = alpha;
+
         // u_k = u_{k-1} + alpha_k*p_{k-1}
         fasp_blas_darray_axpy(m, alpha, p, u->val);
 
@@ -266,6 +318,7 @@ INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
                         break;
                     }
                     fasp_darray_set(m, p, 0.0);
+                    record = FALSE;
                     ++stag;
                 }
 
@@ -319,6 +372,7 @@ INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
 
             // prepare for restarting method
             fasp_darray_set(m, p, 0.0);
+            record = FALSE;
             ++more_step;
 
         } // end of safe-guard check!
@@ -339,6 +393,13 @@ INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
         beta  = temp2 / temp1;
         temp1 = temp2;
 
+        if (record) {
+            if (beta > 0.0)
+                cgb[nrec - 1] = beta;
+            else
+                record = FALSE;
+        }
+
         // compute p_k = z_k + beta_k*p_{k-1}
         fasp_blas_darray_axpby(m, 1.0, z, beta, p);
 
@@ -347,6 +408,22 @@ INT fasp_solver_dcsr_pcg(dCSRmat* A, dvector* b, dvector* u, precond* pc,
 FINISHED: // finish iterative method
     if (PrtLvl > PRINT_NONE) ITS_FINAL(iter, MaxIt, relres);
 
+    // eigenvalue estimates from the Lanczos matrix of CG
+    if (lmin != NULL && lmax != NULL) {
+        *lmin = *lmax = 0.0;
+        if (nrec > 0) {
+            // T(j,j) in cga and T(j,j+1) in cgb, from the last step backwards
+            for (i = nrec - 1; i >= 0; --i) {
+                REAL d = 1.0 / cga[i] + (i > 0 ? cgb[i - 1] / cga[i - 1] : 0.0);
+                if (i < nrec - 1) cgb[i] = sqrt(cgb[i]) / cga[i];
+                cga[i] = d;
+            }
+            fasp_tridiag_extreme_eig(nrec, cga, cgb, lmin, lmax);
+        }
+        fasp_mem_free(cgcoef);
+        cgcoef = NULL;
+    }
+
     // clean up temp memory
     fasp_mem_free(work);
     work = NULL;
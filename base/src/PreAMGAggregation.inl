@@ -342,6 +342,86 @@ static double dense_matrix_norms(double* A, int m, int n, int type)
     return (norm);
 }
 
+/**
+ * \fn static void aggregation_neighbors (dCSRmat *A, AMG_param *param,
+ *                                        const INT NumLevels, dCSRmat *Neigh)
+ *
+ * \brief Form strongly coupled neighborhood for aggregation
+ *
+ * \param A                 Pointer to the coefficient matrices
+ * \param param             Pointer to AMG parameters
+ * \param NumLevels         Level number
+ * \param Neigh             Pointer to strongly coupled neighbors (OUTPUT)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Moved from aggregation_vmb; j is a strongly coupled neighbor of i if
+ *       a_ij^2 >= theta^2 |a_ii a_jj|. Rows are counted and filled in parallel.
+ */
+static void aggregation_neighbors(dCSRmat*   A,
+                                  AMG_param* param,
+                                  const INT  NumLevels,
+                                  dCSRmat*   Neigh)
+{
+    const INT   row = A->row, col = A->col;
+    const INT * AIA = A->IA, *AJA = A->JA;
+    const REAL* Aval = A->val;
+
+    REAL strongly_coupled, strongly_coupled2;
+    INT  i, j, index;
+
+    dvector diag;
+    fasp_dcsr_getdiag(0, A, &diag); // get the diagonal entries
+
+    if (GE(param->tentative_smooth, SMALLREAL)) {
+        strongly_coupled = param->strong_coupled * pow(0.5, NumLevels - 1);
+    } else {
+        strongly_coupled = param->strong_coupled;
+    }
+    strongly_coupled2 = pow(strongly_coupled, 2);
+
+    Neigh->row = row;
+    Neigh->col = col;
+    Neigh->IA  = (INT*)fasp_mem_calloc(row + 1, sizeof(INT));
+
+    // count strongly coupled neighbors of each row
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, index) if (row > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < row; ++i) {
+        for (index = 0, j = AIA[i]; j < AIA[i + 1]; ++j) {
+            if ((AJA[j] == i) || (pow(Aval[j], 2) >= strongly_coupled2 *
+                                                         ABS(diag.val[i] * diag.val[AJA[j]])))
+                index++;
+        }
+        Neigh->IA[i + 1] = index;
+    }
+
+    for (i = 0; i < row; ++i) Neigh->IA[i + 1] += Neigh->IA[i];
+
+    Neigh->nnz = Neigh->IA[row];
+    Neigh->JA  = (INT*)fasp_mem_calloc(Neigh->nnz, sizeof(INT));
+    Neigh->val = (REAL*)fasp_mem_calloc(Neigh->nnz, sizeof(REAL));
+
+    // copy strongly coupled neighbors
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, index) if (row > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < row; ++i) {
+        for (index = Neigh->IA[i], j = AIA[i]; j < AIA[i + 1]; ++j) {
+            if ((AJA[j] == i) || (pow(Aval[j], 2) >= strongly_coupled2 *
+                                                         ABS(diag.val[i] * diag.val[AJA[j]]))) {
+                Neigh->JA[index]  = AJA[j];
+                Neigh->val[index] = Aval[j];
+                index++;
+            }
+        }
+    }
+
+    fasp_dvec_free(&diag);
+}
+
 /**
  * \fn static SHORT aggregation_vmb (dCSRmat *A, ivector *vertices, AMG_param *param,
  *                                   const INT NumLevels, dCSRmat *Neigh,
@@ -364,6 +444,7 @@ static double dense_matrix_norms(double* A, int m, int n, int type)
  *       "Algebraic Multigrid on Unstructured Meshes", 1994
  *
  * Modified by Zheng Li, Chensong Zhang on 07/29/2014
+ * Modified by agent on 10/18/2026: form neighborhood in parallel
  */
 static SHORT aggregation_vmb(dCSRmat*   A,
                              ivector*   vertices,
@@ -372,9 +453,8 @@ static SHORT aggregation_vmb(dCSRmat*   A,
                              dCSRmat*   Neigh,
                              INT*       NumAggregates)
 {
-    const INT   row = A->row, col = A->col, nnz = A->IA[row] - A->IA[0];
-    const INT * AIA = A->IA, *AJA = A->JA;
-    const REAL* Aval            = A->val;
+    const INT   row = A->row;
+    const INT * AIA = A->IA;
     const INT   max_aggregation = param->max_aggregation;
 
     // return status
@@ -385,62 +465,16 @@ static SHORT aggregation_vmb(dCSRmat*   A,
     INT  subset, count;
     INT* num_each_agg;
 
-    REAL  strongly_coupled, strongly_coupled2;
-    INT   i, j, index, row_start, row_end;
-    INT * NIA, *NJA;
-    REAL* Nval;
-
-    dvector diag;
-    fasp_dcsr_getdiag(0, A, &diag); // get the diagonal entries
-
-    if (GE(param->tentative_smooth, SMALLREAL)) {
-        strongly_coupled = param->strong_coupled * pow(0.5, NumLevels - 1);
-    } else {
-        strongly_coupled = param->strong_coupled;
-    }
-    strongly_coupled2 = pow(strongly_coupled, 2);
+    INT  i, j, row_start, row_end;
+    INT *NIA, *NJA;
 
     /*------------------------------------------*/
     /*    Form strongly coupled neighborhood    */
     /*------------------------------------------*/
-    fasp_dcsr_alloc(row, col, nnz, Neigh);
-
-    NIA  = Neigh->IA;
-    NJA  = Neigh->JA;
-    Nval = Neigh->val;
-
-#if 0 // Li Zhao
-#ifdef _OPENMP
-#pragma omp parallel for if (row > OPENMP_HOLDS)
-#endif
-    for (i = row; i >= 0; i--)
-        NIA[i] = AIA[i]; // why ?, here do not require it!, Li Zhao, 05/21/2023
-#endif
+    aggregation_neighbors(A, param, NumLevels, Neigh);
 
-    for (index = i = 0; i < row; ++i) {
-        NIA[i]    = index;
-        row_start = AIA[i];
-        row_end   = AIA[i + 1];
-        for (j = row_start; j < row_end; ++j) {
-            if ((AJA[j] == i) ||
-                (pow(Aval[j], 2) >=
-                 strongly_coupled2 * ABS(diag.val[i] * diag.val[AJA[j]]))) {
-                NJA[index]  = AJA[j];
-                Nval[index] = Aval[j];
-                index++;
-            }
-        }
-    }
-    NIA[row] = index;
-
-    Neigh->nnz = index;
-    Neigh->JA  = (INT*)fasp_mem_realloc(Neigh->JA, (Neigh->IA[row]) * sizeof(INT));
-    Neigh->val = (REAL*)fasp_mem_realloc(Neigh->val, (Neigh->IA[row]) * sizeof(REAL));
-
-    // NIA = Neigh->IA;
-    // NJA = Neigh->JA;
-
-    fasp_dvec_free(&diag);
+    NIA = Neigh->IA;
+    NJA = Neigh->JA;
 
     /*------------------------------------------*/
     /*             Initialization               */
@@ -3,7 +3,7 @@
  *  \brief Utilities for aggregation methods for CSR matrices
  *
  *  \note  This file contains Level-4 (Pre) functions, which are used in:
- *         PreAMGSetupSA.c and PreAMGSetupUA.c
+ *         PreAMGSetupSA.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
@@ -22,27 +22,32 @@
 /*---------------------------------*/
 
 /**
- * \fn static void form_tentative_p (ivector *vertices, dCSRmat *tentp, REAL **basis,
- *                                   INT NumAggregates)
+ * \fn static void form_tentative_p (ivector *vertices, dCSRmat *tentp, REAL *basis,
+ *                                   REAL *cbasis, INT NumAggregates)
  *
  * \brief Form aggregation based on strong coupled neighbors
  *
  * \param vertices           Pointer to the aggregation of vertices
  * \param tentp              Pointer to the prolongation operators
- * \param basis              Pointer to the near kernel
+ * \param basis              Pointer to the near kernel on the current level
+ * \param cbasis             Pointer to the near kernel on the coarse level (OUTPUT);
+ *                           if it is not NULL, columns of tentp will be normalized
  * \param NumAggregates      Number of aggregations
  *
  * \author Xiaozhe Hu
  * \date   09/29/2009
  *
  * Modified by Xiaozhe Hu on 05/25/2014
+ * Modified by agent on 10/18/2026: add OMP support and normalization
  */
 static void form_tentative_p (ivector  *vertices,
                               dCSRmat  *tentp,
-                              REAL    **basis,
+                              REAL     *basis,
+                              REAL     *cbasis,
                               INT       NumAggregates)
 {
-    INT i, j;
+    INT i, j, myid, mybegin, myend;
+    INT nthreads = 1;
 
     /* Form tentative prolongation */
     tentp->row = vertices->row;
@@ -56,30 +61,82 @@ static void form_tentative_p (ivector  *vertices,
     INT  *vval = vertices->val;
     const INT row = tentp->row;
 
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if ( row > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads   = fasp_get_num_threads();
+    }
+#endif
+
+    // number of aggregated vertices before each block of rows
+    INT *count = (INT *)fasp_mem_calloc(nthreads+1, sizeof(INT));
+
     // first run
-    for ( i = 0, j = 0; i < row; i++ ) {
-        IA[i] = j;
-        if (vval[i] > UNPT) j++;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i) if (use_openmp)
+#endif
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        for ( i = mybegin; i < myend; i++ ) {
+            if (vval[i] > UNPT) count[myid+1]++;
+        }
     }
-    IA[row] = j;
+    for ( myid = 0; myid < nthreads; myid++ ) count[myid+1] += count[myid];
+    IA[row] = count[nthreads];
 
     // allocate memory for P
-    tentp->nnz = j;
+    tentp->nnz = IA[row];
     tentp->JA  = (INT *)fasp_mem_calloc(tentp->nnz, sizeof(INT));
     tentp->val = (REAL *)fasp_mem_calloc(tentp->nnz, sizeof(REAL));
 
     INT  *JA = tentp->JA;
     REAL *val = tentp->val;
 
-    // second run
-    for (i = 0, j = 0; i < row; i ++) {
-        IA[i] = j;
-        if (vval[i] > UNPT) {
-            JA[j] = vval[i];
-            val[j] = basis[0][i];
-            j ++;
+    // second run: map vertices to the columns of their aggregates
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j) if (use_openmp)
+#endif
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        for ( j = count[myid], i = mybegin; i < myend; i++ ) {
+            IA[i] = j;
+            if (vval[i] > UNPT) {
+                JA[j] = vval[i];
+                val[j] = basis[i];
+                j ++;
+            }
         }
     }
+
+    fasp_mem_free(count); count = NULL;
+
+    if ( cbasis == NULL ) return;
+
+    // normalize columns: the column norms form the coarse near kernel
+    fasp_darray_set(NumAggregates, cbasis, 0.0);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j) if (use_openmp)
+#endif
+    for ( j = 0; j < tentp->nnz; j++ ) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        cbasis[JA[j]] += val[j] * val[j];
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if (NumAggregates > OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < NumAggregates; i++ ) cbasis[i] = sqrt(cbasis[i]);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j) if (use_openmp)
+#endif
+    for ( j = 0; j < tentp->nnz; j++ ) {
+        if ( cbasis[JA[j]] > SMALLREAL ) val[j] /= cbasis[JA[j]];
+    }
 }
 
 /*---------------------------------*/
@@ -0,0 +1,205 @@
+/*! \file  PreAMGAggregationMIS.inl
+ *
+ *  \brief Distance-2 MIS aggregation for CSR matrices
+ *
+ *  \note  This file contains Level-4 (Pre) functions, which are used in:
+ *         PreAMGSetupSA.c and PreAMGSetupUA.c. It requires aggregation_neighbors
+ *         from PreAMGAggregation.inl and BlaSparseUtil.c.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static SHORT aggregation_mis2 (dCSRmat *A, ivector *vertices, AMG_param *param,
+ *                                    const INT NumLevels, dCSRmat *Neigh,
+ *                                    INT *NumAggregates)
+ *
+ * \brief Form aggregation based on distance-2 maximal independent set
+ *
+ * \param A                 Pointer to the coefficient matrices
+ * \param vertices          Pointer to the aggregation of vertices
+ * \param param             Pointer to AMG parameters
+ * \param NumLevels         Level number
+ * \param Neigh             Pointer to strongly coupled neighbors
+ * \param NumAggregates     Pointer to number of aggregations
+ *
+ * \return                  FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Roots of the aggregates form a maximal independent set of the square of
+ *       the strong coupling graph, found by fasp_sparse_mis2. Each root then
+ *       takes its strong neighbors, and the remaining nodes join the aggregate
+ *       of their strongest aggregated neighbor. Every step only reads results of
+ *       the previous step, so the aggregates do not depend on the number of
+ *       threads. Priorities are seeded by the level number. max_aggregation
+ *       is not used since aggregates are bounded by the graph.
+ */
+static SHORT aggregation_mis2(dCSRmat*   A,
+                              ivector*   vertices,
+                              AMG_param* param,
+                              const INT  NumLevels,
+                              dCSRmat*   Neigh,
+                              INT*       NumAggregates)
+{
+    const INT  row = A->row;
+    const INT* AIA = A->IA;
+
+    // return status
+    SHORT status = FASP_SUCCESS;
+
+    // local variables
+    INT       i, j, k, jj, num_left, num_agg, myid, mybegin, myend;
+    INT       nthreads = 1;
+    INT *     NIA, *NJA;
+    REAL *    Nval, amax;
+
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if (row > OPENMP_HOLDS) {
+        use_openmp = TRUE;
+        nthreads   = fasp_get_num_threads();
+    }
+#endif
+
+    /*------------------------------------------*/
+    /*    Form strongly coupled neighborhood    */
+    /*------------------------------------------*/
+    aggregation_neighbors(A, param, NumLevels, Neigh);
+
+    NIA  = Neigh->IA;
+    NJA  = Neigh->JA;
+    Nval = Neigh->val;
+
+    /*------------------------------------------*/
+    /*             Initialization               */
+    /*------------------------------------------*/
+    fasp_ivec_alloc(row, vertices);
+
+    // state: 1 root, 0 undecided, -1 not root, -2 isolated
+    INT*      state = (INT*)fasp_mem_calloc(row, sizeof(INT));
+    INT*      snew  = (INT*)fasp_mem_calloc(row, sizeof(INT));
+    INT*      count = (INT*)fasp_mem_calloc(nthreads + 1, sizeof(INT));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if (use_openmp)
+#endif
+    for (i = 0; i < row; ++i) state[i] = ((AIA[i + 1] - AIA[i]) == 1) ? -2 : 0;
+
+    /*-------------*/
+    /*   Step 1.   */
+    /*-------------*/
+    // distance-2 maximal independent set with priorities seeded by the level
+    fasp_sparse_mis2(Neigh, NumLevels, state);
+
+    /*-------------*/
+    /*   Step 2.   */
+    /*-------------*/
+    // number the roots in the order of their indices
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i) if (use_openmp)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        for (i = mybegin; i < myend; ++i) {
+            if (state[i] == 1) count[myid + 1]++;
+        }
+    }
+    for (myid = 0; myid < nthreads; ++myid) count[myid + 1] += count[myid];
+    num_agg = count[nthreads];
+
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, k) if (use_openmp)
+#endif
+    for (myid = 0; myid < nthreads; ++myid) {
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        for (k = count[myid], i = mybegin; i < myend; ++i) {
+            if (state[i] == 1)
+                vertices->val[i] = k++;
+            else
+                vertices->val[i] = (state[i] == -2) ? UNPT : -2;
+        }
+    }
+
+    if (num_agg < MIN_CDOF) {
+        status = ERROR_AMG_COARSEING;
+        goto END;
+    }
+
+    // strong neighbors of roots join the aggregates
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j) if (use_openmp)
+#endif
+    for (i = 0; i < row; ++i) {
+        snew[i] = vertices->val[i];
+        if (state[i] != -1) continue;
+        for (j = NIA[i]; j < NIA[i + 1]; ++j) {
+            if (state[NJA[j]] == 1) {
+                snew[i] = vertices->val[NJA[j]];
+                break;
+            }
+        }
+    }
+
+    /*-------------*/
+    /*   Step 3.   */
+    /*-------------*/
+    // leftovers join the aggregate of their strongest aggregated neighbor
+    for (num_left = 1; num_left > 0;) {
+
+        num_left = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, jj, amax) reduction(+ : num_left) if (use_openmp)
+#endif
+        for (i = 0; i < row; ++i) {
+            vertices->val[i] = snew[i];
+            if (snew[i] != -2) continue;
+            for (amax = -1.0, jj = -1, j = NIA[i]; j < NIA[i + 1]; ++j) {
+                if (snew[NJA[j]] >= 0 && ABS(Nval[j]) > amax) {
+                    amax = ABS(Nval[j]);
+                    jj   = NJA[j];
+                }
+            }
+            if (jj >= 0) {
+                vertices->val[i] = snew[jj];
+                num_left++;
+            }
+        }
+
+        fasp_iarray_cp(row, vertices->val, snew);
+    }
+
+    // nodes not reached (only possible for nonsymmetric graphs) are singletons
+    for (i = 0; i < row; ++i) {
+        if (vertices->val[i] == -2) vertices->val[i] = num_agg++;
+    }
+
+END:
+    *NumAggregates = num_agg;
+
+    fasp_mem_free(state);
+    state = NULL;
+    fasp_mem_free(snew);
+    snew = NULL;
+    fasp_mem_free(count);
+    count = NULL;
+
+    return status;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
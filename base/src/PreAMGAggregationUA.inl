@@ -17,6 +17,8 @@
 #include <omp.h>
 #endif
 
+#define PAIR_MATCH_ROUNDS 4 /**< max rounds of parallel handshake matching */
+
 /*---------------------------------*/
 /*--      Private Functions      --*/
 /*---------------------------------*/
@@ -36,6 +38,8 @@
  *
  * \author Zheng Li, Chensong Zhang
  * \date   12/23/2014
+ *
+ * Modified by agent on 10/18/2026: column statistics from A' with OpenMP
  */
 static void pair_aggregate_init (const dCSRmat  *A,
                                  const SHORT     checkdd,
@@ -51,22 +55,52 @@ static void pair_aggregate_init (const dCSRmat  *A,
     REAL *val = A->val;
     REAL strong_hold, aij, aii, rowsum, absrowsum, max;
 
-    REAL *colsum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-    REAL *colmax = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-    REAL *abscolsum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+    REAL *colsum = (REAL*)fasp_mem_calloc(3*row, sizeof(REAL));
+    REAL *colmax = colsum + row;
+    REAL *abscolsum = colmax + row;
+
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if ( row > OPENMP_HOLDS ) use_openmp = TRUE;
+#endif
 
     strong_hold = kaptg/(kaptg - 2.0);
 
-    for (i=0; i<row; ++i) {
-        for (j=ia[i]+1; j<ia[i+1]; ++j) {
-            col = ja[j];
-            aij = val[j];
-            colsum[col] += aij;
-            colmax[col] = MAX(colmax[col], aij);
-            if (checkdd) abscolsum[col] += ABS(aij);
+#ifdef _OPENMP
+    if ( use_openmp ) {
+        // column statistics are row statistics of A': each thread owns its rows
+        dCSRmat AT;
+        fasp_dcsr_trans(A, &AT);
+#pragma omp parallel for private(i,j,col,aij)
+        for (i=0; i<row; ++i) {
+            for (j=AT.IA[i]; j<AT.IA[i+1]; ++j) {
+                col = AT.JA[j];
+                if (ia[col] < ia[col+1] && ja[ia[col]] == i) continue; // diagonal
+                aij = AT.val[j];
+                colsum[i] += aij;
+                colmax[i] = MAX(colmax[i], aij);
+                if (checkdd) abscolsum[i] += ABS(aij);
+            }
+        }
+        fasp_dcsr_free(&AT);
+    }
+    else
+#endif
+    {
+        for (i=0; i<row; ++i) {
+            for (j=ia[i]+1; j<ia[i+1]; ++j) {
+                col = ja[j];
+                aij = val[j];
+                colsum[col] += aij;
+                colmax[col] = MAX(colmax[col], aij);
+                if (checkdd) abscolsum[col] += ABS(aij);
+            }
         }
     }
 
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,aii,aij,rowsum,absrowsum,max) if (use_openmp)
+#endif
     for (i=0; i<row; ++i) {
         rowsum = 0.0; max = 0.0; absrowsum = 0.0;
         aii = val[ia[i]];
@@ -91,9 +125,7 @@ static void pair_aggregate_init (const dCSRmat  *A,
         }
     }
 
-    fasp_mem_free(colsum);    colsum    = NULL;
-    fasp_mem_free(colmax);    colmax    = NULL;
-    fasp_mem_free(abscolsum); abscolsum = NULL;
+    fasp_mem_free(colsum); colsum = NULL;
 }
 
 /**
@@ -110,6 +142,8 @@ static void pair_aggregate_init (const dCSRmat  *A,
  *
  * \author Zheng Li, Chensong Zhang
  * \date   12/23/2014
+ *
+ * Modified by agent on 10/18/2026: column statistics from A' with OpenMP
  */
 static void pair_aggregate_init2 (const dCSRmat  *A,
                                   ivector        *map,
@@ -125,6 +159,9 @@ static void pair_aggregate_init2 (const dCSRmat  *A,
     REAL si;
     const INT NumAggregates = map->row/2;
 
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,k,col,nc,si) if (NumAggregates > OPENMP_HOLDS)
+#endif
     for (i=0; i<NumAggregates; ++i) {
         j = map->val[2*i];
         si = 0;
@@ -149,6 +186,253 @@ static void pair_aggregate_init2 (const dCSRmat  *A,
     }
 }
 
+/**
+ * \fn static REAL pair_mu_symm (const REAL aii, const REAL ajj, const REAL aij,
+ *                               const REAL si, const REAL sj)
+ *
+ * \brief Quality of a pair for symmetric pairwise aggregation
+ *
+ * \param aii       Diagonal entry of node i
+ * \param ajj       Diagonal entry of node j
+ * \param aij       Off-diagonal entry (i,j)
+ * \param si        Off-diagonal row sum of node i
+ * \param sj        Off-diagonal row sum of node j
+ *
+ * \return          Quality measure mu of the pair {i,j}; smaller is better
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static REAL pair_mu_symm (const REAL  aii,
+                          const REAL  ajj,
+                          const REAL  aij,
+                          const REAL  si,
+                          const REAL  sj)
+{
+    REAL temp1, temp2, temp3, temp4;
+
+    temp1 = aii+si+2*aij;
+    temp2 = ajj+sj+2*aij;
+    temp2 = 1.0/temp1+1.0/temp2;
+
+    temp3 = MAX(ABS(aii-si), SMALLREAL); // avoid temp3 to be zero
+    temp4 = MAX(ABS(ajj-sj), SMALLREAL); // avoid temp4 to be zero
+    temp4 = -aij+1./(1.0/temp3+1.0/temp4);
+    // avoid temp4 to be zero
+    if ( ABS(temp4) < SMALLREAL )
+        temp4 = (temp4>0)? SMALLREAL:-SMALLREAL;
+
+    return (-aij+1.0/temp2) / temp4;
+}
+
+/**
+ * \fn static SHORT pair_mu_nsym (const REAL aii, const REAL ajj, const REAL aij,
+ *                                const REAL aji, const REAL si, const REAL sj,
+ *                                REAL *mu)
+ *
+ * \brief Quality of a pair for nonsymmetric pairwise aggregation
+ *
+ * \param aii       Diagonal entry of node i
+ * \param ajj       Diagonal entry of node j
+ * \param aij       Off-diagonal entry (i,j)
+ * \param aji       Off-diagonal entry (j,i)
+ * \param si        Off-diagonal row sum of node i
+ * \param sj        Off-diagonal row sum of node j
+ * \param mu        Quality measure of the pair {i,j} (OUTPUT)
+ *
+ * \return          TRUE if the pair is admissible, FALSE otherwise
+ *
+ * \author Zheng Li, Chensong Zhang
+ * \date   12/23/2014
+ *
+ * Modified by agent on 10/18/2026: move out of nsympair_1stpass
+ */
+static SHORT pair_mu_nsym (const REAL  aii,
+                           const REAL  ajj,
+                           const REAL  aij,
+                           const REAL  aji,
+                           const REAL  si,
+                           const REAL  sj,
+                           REAL       *mu)
+{
+    REAL vals = -0.5*(aij+aji);
+    REAL rsi  = -si + aii, rsj = -sj + ajj;
+    REAL eta1 = 2*aii, eta2 = 2*ajj;
+    REAL sig1 = si-vals, sig2 = sj-vals;
+    REAL del1, del2, del12, epsr, tmp;
+
+    del1 = (sig1 > 0) ? rsi : rsi+2*sig1;
+    del2 = (sig2 > 0) ? rsj : rsj+2*sig2;
+
+    if (vals > 0.0) {
+        epsr = 1.49e-8*vals;
+        if ((ABS(del1) < epsr) && (ABS(del2) < epsr)) {
+            *mu = (eta1*eta2)/(vals*(eta1+eta2));
+        } else if (ABS(del1) < epsr) {
+            if (del2 < -epsr) return FALSE;
+            *mu = (eta1*eta2)/(vals*(eta1+eta2));
+        } else if (ABS(del2) < epsr) {
+            if (del1 < -epsr) return FALSE;
+            *mu = (eta1*eta2)/(vals*(eta1+eta2));
+        } else {
+            del12 = del1 + del2;
+            if (del12 < -epsr) return FALSE;
+            if (del12 == 0.0) return FALSE;
+            tmp = vals + del1*del2/del12;
+            if (tmp <= 0.0) return FALSE;
+            *mu = ((eta1*eta2)/(eta1+eta2))/tmp;
+        }
+    }
+    else {
+        if (del1 <= 0.0 || del2 <= 0.0) return FALSE;
+        tmp = vals + del1*del2/(del1+del2);
+        if (tmp <= 0.0) return FALSE;
+        *mu = ((eta1*eta2)/(eta1+eta2))/tmp;
+    }
+
+    return TRUE;
+}
+
+/**
+ * \fn static INT pair_best (const dCSRmat *A, const REAL *s, const REAL k_tg,
+ *                           const INT *iso, const SHORT symm, const INT *vval,
+ *                           const INT *match, const INT i)
+ *
+ * \brief Find the best partner of a node for pairwise aggregation
+ *
+ * \param A         Pointer to the coefficient matrix
+ * \param s         Pointer to off-diagonal row sum
+ * \param k_tg      Two-grid convergence parameter (quality bound)
+ * \param iso       Nodes which cannot be paired are marked by -1 (NULL: none)
+ * \param symm      TRUE: symmetric quality measure; FALSE: nonsymmetric
+ * \param vval      Aggregation of vertices: only UNPT nodes are free
+ * \param match     Pairs from parallel matching: only -1 nodes are free
+ * \param i         Node to be paired
+ *
+ * \return          Best partner of node i; -1 if there is no admissible one
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT pair_best (const dCSRmat  *A,
+                      const REAL     *s,
+                      const REAL      k_tg,
+                      const INT      *iso,
+                      const SHORT     symm,
+                      const INT      *vval,
+                      const INT      *match,
+                      const INT       i)
+{
+    const INT  *AIA  = A->IA;
+    const INT  *AJA  = A->JA;
+    const REAL *Aval = A->val;
+    const REAL  aii  = Aval[AIA[i]];
+
+    INT   j, k, col, ipair = -1;
+    REAL  mu, aij, aji, ajj, val = BIGREAL;
+
+    for ( j = AIA[i] + 1; j < AIA[i+1]; j++ ) {
+        col = AJA[j];
+        if ( vval[col] != UNPT || match[col] != -1 ) continue;
+        if ( iso != NULL && iso[col] == -1 ) continue;
+
+        aij = Aval[j];
+        ajj = Aval[AIA[col]];
+
+        if ( symm ) {
+            mu = pair_mu_symm(aii, ajj, aij, s[i], s[col]);
+            if ( val > mu ) {
+                val   = mu;
+                ipair = col;
+            }
+        }
+        else {
+            aji = 0.0;
+            for ( k = AIA[col]; k < AIA[col+1]; ++k ) {
+                if ( AJA[k] == i ) {
+                    aji = Aval[k];
+                    break;
+                }
+            }
+
+            if ( !pair_mu_nsym(aii, ajj, aij, aji, s[i], s[col], &mu) ) continue;
+            if ( mu > k_tg ) continue;
+
+            if ( ipair == -1 || (mu-val) < -0.06 ) {
+                ipair = col;
+                val   = mu;
+            }
+        }
+    }
+
+    // symmetric case: the best pair should satisfy the quality bound
+    if ( symm && val > k_tg ) ipair = -1;
+
+    return ipair;
+}
+
+/**
+ * \fn static INT pair_handshake (const dCSRmat *A, const REAL *s, const REAL k_tg,
+ *                                const INT *iso, const SHORT symm,
+ *                                const INT *vval, INT *match, INT *best)
+ *
+ * \brief One round of parallel handshake matching for pairwise aggregation
+ *
+ * \param A         Pointer to the coefficient matrix
+ * \param s         Pointer to off-diagonal row sum
+ * \param k_tg      Two-grid convergence parameter (quality bound)
+ * \param iso       Nodes which cannot be paired are marked by -1 (NULL: none)
+ * \param symm      TRUE: symmetric quality measure; FALSE: nonsymmetric
+ * \param vval      Aggregation of vertices: only UNPT nodes are free
+ * \param match     Partner of each node, -1 if free (MODIFIED)
+ * \param best      Work space: best partner of each free node in this round
+ *
+ * \return          Number of new pairs
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Every free node proposes its best partner, and two nodes are paired if
+ *       they propose each other. Pairs only come from pair_best, so they satisfy
+ *       the quality bound. The result does not depend on the number of threads.
+ */
+static INT pair_handshake (const dCSRmat  *A,
+                           const REAL     *s,
+                           const REAL      k_tg,
+                           const INT      *iso,
+                           const SHORT     symm,
+                           const INT      *vval,
+                           INT            *match,
+                           INT            *best)
+{
+    const INT row = A->row;
+    INT i, j, num = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i)
+#endif
+    for ( i = 0; i < row; i++ ) {
+        if ( vval[i] != UNPT || match[i] != -1 || (iso != NULL && iso[i] == -1) )
+            best[i] = -1;
+        else
+            best[i] = pair_best(A, s, k_tg, iso, symm, vval, match, i);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j) reduction(+:num)
+#endif
+    for ( i = 0; i < row; i++ ) {
+        j = best[i];
+        if ( j >= 0 && best[j] == i ) {
+            match[i] = j;
+            if ( i < j ) num++;
+        }
+    }
+
+    return num;
+}
+
+
 /**
  * \fn static void form_pairwise (const dCSRmat *A, const INT pair,
  *                                const REAL k_tg, ivector *vertices,
@@ -166,6 +450,8 @@ static void pair_aggregate_init2 (const dCSRmat  *A,
  *
  * \note Refer to Artem Napov and Yvan Notay "An algebraic multigrid
  *       method with guaranteed convergence rate" 2011.
+ *
+ * Modified by agent on 10/18/2026: add parallel handshake matching
  */
 static void form_pairwise (const dCSRmat  *A,
                            const INT       pair,
@@ -176,15 +462,17 @@ static void form_pairwise (const dCSRmat  *A,
     const INT row  = A->row;
 
     const INT  *AIA  = A->IA;
-    const INT  *AJA  = A->JA;
     const REAL *Aval = A->val;
 
-    INT   i, j, row_start, row_end;
+    INT   i, j, k, row_start, row_end;
     REAL  sum;
 
-    INT   col, index = 0;
-    REAL  mu, min_mu, aii, ajj, aij;
-    REAL  temp1, temp2, temp3, temp4;
+    INT   index;
+    SHORT use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( row > OPENMP_HOLDS ) use_openmp = TRUE;
+#endif
 
     /*---------------------------------------------------------*/
     /* Step 1. select extremely strong diagonal dominate rows  */
@@ -196,6 +484,9 @@ static void form_pairwise (const dCSRmat  *A,
     fasp_ivec_alloc(row, vertices);
 
     if ( pair == 1 ) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,sum,row_start,row_end) if (use_openmp)
+#endif
         for ( i = 0; i < row; i++ ) {
             sum = 0.0;
             row_start = AIA[i];
@@ -221,6 +512,9 @@ static void form_pairwise (const dCSRmat  *A,
 
     REAL *s = (REAL *)fasp_mem_calloc(row, sizeof(REAL));
 
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,row_start,row_end) if (use_openmp)
+#endif
     for ( i = 0; i < row; i++ ) {
         s[i] = 0.0;
 
@@ -231,113 +525,47 @@ static void form_pairwise (const dCSRmat  *A,
     }
 
     /*---------------------------------------------------------*/
-    /* Step 3. start the pairwise aggregation                  */
+    /* Step 3. match most of the pairs in parallel             */
     /*---------------------------------------------------------*/
 
-    *NumAggregates = 0;
-
-    for ( i = 0; i < row; i++ ) {
-
-        if ( vertices->val[i] != UNPT ) continue;
+    INT *match = (INT *)fasp_mem_calloc(row, sizeof(INT));
 
-        min_mu = BIGREAL;
+    fasp_iarray_set(row, match, -1);
 
-        row_start = AIA[i]; row_end = AIA[i+1];
-
-        aii = Aval[row_start];
-
-        for ( j= row_start + 1; j < row_end; j++ ) {
-            col = AJA[j];
-            if ( vertices->val[col] != UNPT ) continue;
-
-            aij = Aval[j];
-            ajj = Aval[AIA[col]];
+    if ( use_openmp ) {
+        INT *best = (INT *)fasp_mem_calloc(row, sizeof(INT));
+        for ( k = 0; k < PAIR_MATCH_ROUNDS; k++ ) {
+            if ( !pair_handshake(A, s, k_tg, NULL, TRUE, vertices->val, match, best) ) break;
+        }
+        fasp_mem_free(best); best = NULL;
+    }
 
-            temp1 = aii+s[i]+2*aij;
-            temp2 = ajj+s[col]+2*aij;
-            temp2 = 1.0/temp1+1.0/temp2;
+    /*---------------------------------------------------------*/
+    /* Step 4. number the aggregates and pair the rest greedily */
+    /*---------------------------------------------------------*/
 
-            temp3 = MAX(ABS(aii-s[i]), SMALLREAL); // avoid temp3 to be zero
-            temp4 = MAX(ABS(ajj-s[col]), SMALLREAL); // avoid temp4 to be zero
-            temp4 = -aij+1./(1.0/temp3+1.0/temp4);
-            // avoid temp4 to be zero
-            if ( ABS(temp4) < SMALLREAL ) 
-                temp4 = (temp4>0)? SMALLREAL:-SMALLREAL;
+    *NumAggregates = 0;
 
-            mu    = (-aij+1.0/temp2) / temp4;
+    for ( i = 0; i < row; i++ ) {
 
-            if ( min_mu > mu ) {
-                min_mu = mu;
-                index  = col;
-            }
-        }
+        if ( vertices->val[i] != UNPT ) continue;
 
         vertices->val[i] = *NumAggregates;
 
-        if ( min_mu <= k_tg ) vertices->val[index] = *NumAggregates;
+        if ( match[i] >= 0 )
+            index = match[i];
+        else
+            index = pair_best(A, s, k_tg, NULL, TRUE, vertices->val, match, i);
+
+        if ( index >= 0 ) vertices->val[index] = *NumAggregates;
 
         *NumAggregates += 1;
     }
 
+    fasp_mem_free(match); match = NULL;
     fasp_mem_free(s); s = NULL;
 }
 
-/**
- * \fn static void form_boolean_p (const ivector *vertices, dCSRmat *tentp,
- *                                 const INT NumAggregates)
- *
- * \brief Form aggregation based on strong coupled neighbors
- *
- * \param vertices           Pointer to the aggregation of vertices
- * \param tentp              Pointer to the prolongation operators
- * \param NumAggregates      Number of aggregations
- *
- * \author Xiaozhe Hu
- * \date   09/29/2009
- */
-static void form_boolean_p (const ivector  *vertices,
-                            dCSRmat        *tentp,
-                            const INT       NumAggregates)
-{
-    INT i, j;
-
-    /* Form tentative prolongation */
-    tentp->row = vertices->row;
-    tentp->col = NumAggregates;
-    tentp->nnz = vertices->row;
-    tentp->IA  = (INT *)fasp_mem_calloc(tentp->row+1,sizeof(INT));
-
-    // local variables
-    INT       *IA   = tentp->IA;
-    INT       *vval = vertices->val;
-    const INT  row  = tentp->row;
-
-    // first run
-    for ( i = 0, j = 0; i < row; i++ ) {
-        IA[i] = j;
-        if (vval[i] > UNPT) j++;
-    }
-    IA[row] = j;
-
-    // allocate memory for P
-    tentp->nnz = j;
-    tentp->JA  = (INT *)fasp_mem_calloc(tentp->nnz, sizeof(INT));
-    tentp->val = (REAL *)fasp_mem_calloc(tentp->nnz, sizeof(REAL));
-
-    INT  *JA = tentp->JA;
-    REAL *val = tentp->val;
-
-    // second run
-    for (i = 0, j = 0; i < row; i ++) {
-        IA[i] = j;
-        if (vval[i] > UNPT) {
-            JA[j] = vval[i];
-            val[j] = 1.0;
-            j ++;
-        }
-    }
-}
-
 /**
  * \fn static SHORT aggregation_symmpair (dCSRmat *A, AMG_param *param,
  *                                        const INT level, ivector *vertices,
@@ -359,6 +587,7 @@ static void form_boolean_p (const ivector  *vertices,
  *       "An algebraic multigrid method with guaranteed convergence rate", 2012
  *
  * Modified by Chensong Zhang, Zheng Li on 07/29/2014
+ * Modified by agent on 10/18/2026: form coarse matrices from aggregates
  */
 static SHORT aggregation_symmpair (AMG_data   *mgl,
                                    AMG_param  *param,
@@ -373,6 +602,7 @@ static SHORT aggregation_symmpair (AMG_data   *mgl,
     INT        i, j, k, num_agg = 0, aggindex;
     INT        lvl = level;
     REAL       isorate;
+    iCSRmat    aggnodes;
 
     SHORT      dopass = 0, domin = 0;
     SHORT      status = FASP_SUCCESS;
@@ -399,22 +629,15 @@ static SHORT aggregation_symmpair (AMG_data   *mgl,
 
         if ( i < pair_number ) {
 
-            /*-- Form Prolongation --*/
-            form_boolean_p(&vertices[lvl], &mgl[lvl].P, num_agg);
-
             /*-- Perform aggressive coarsening only up to the specified level --*/
-            if ( mgl[lvl].P.col < MIN_CDOF ) break;
-
-            /*-- Form restriction --*/
-            fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+            if ( num_agg < MIN_CDOF ) break;
 
-            /*-- Form coarse level stiffness matrix --*/
-            fasp_blas_dcsr_rap_agg(&mgl[lvl].R, ptrA, &mgl[lvl].P, &mgl[lvl+1].A);
+            /*-- Form coarse level stiffness matrix from the aggregates --*/
+            fasp_aggmap_trans(&vertices[lvl], num_agg, &aggnodes);
+            fasp_blas_dcsr_rap_aggmap(ptrA, &vertices[lvl], &aggnodes, &mgl[lvl+1].A);
+            fasp_icsr_free(&aggnodes);
 
             ptrA = &mgl[lvl+1].A;
-
-            fasp_dcsr_free(&mgl[lvl].P);
-            fasp_dcsr_free(&mgl[lvl].R);
         }
         lvl ++; dopass ++;
     }
@@ -768,6 +991,8 @@ static SHORT aggregation_quality (const dCSRmat  *A,
  *
  * \note  Refer to Yvan Notay "Aggregation-based algebraic multigrid
  *        for convection-diffusion equations" 2011.
+ *
+ * Modified by agent on 10/18/2026: add parallel handshake matching
  */
 static void nsympair_1stpass (const dCSRmat * A,
                               const REAL      k_tg,
@@ -777,17 +1002,10 @@ static void nsympair_1stpass (const dCSRmat * A,
                               INT           * NumAggregates)
 {
     const INT   row  = A->row;
-    const INT  *AIA  = A->IA;
-    const INT  *AJA  = A->JA;
-    const REAL *Aval = A->val;
 
-    INT i, j, row_start, row_end, nc, col, k, ipair, node, checkdd;
-    REAL mu, aii, ajj, aij, aji, tent, vals, val = 0;
-    REAL del1, del2, eta1, eta2, sig1, sig2, rsi, rsj, epsr, del12;
+    INT i, nc, ipair, checkdd;
 
     nc = 0;
-    i = 0;
-    node = 0;
     checkdd = 1;
 
     /*---------------------------------------------------------*/
@@ -799,6 +1017,7 @@ static void nsympair_1stpass (const dCSRmat * A,
     fasp_ivec_alloc(2*row, map);
 
     INT *iperm = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    INT *match = (INT *)fasp_mem_calloc(row, sizeof(INT));
 
     /*---------------------------------------------------------*/
     /* Step 2. compute row sum (off-diagonal) for each vertex  */
@@ -807,115 +1026,45 @@ static void nsympair_1stpass (const dCSRmat * A,
     /* G0:vertices->val[i]=G0PT, Remain: vertices->val[i]=UNPT */
     pair_aggregate_init(A, checkdd, k_tg, iperm, vertices, s);
 
-    /*-----------------------------------------*/
-    /* Step 3. start the pairwise aggregation  */
-    /*-----------------------------------------*/
-    while ( node < row ) {
+    /*---------------------------------------------------------*/
+    /* Step 3. match most of the pairs in parallel             */
+    /*---------------------------------------------------------*/
 
-        // deal with G0 type node
-        if ( vertices->val[i] == G0PT ) {
-            node ++;
-            i ++;
-            continue;
+    fasp_iarray_set(row, match, -1);
+
+#ifdef _OPENMP
+    if ( row > OPENMP_HOLDS ) {
+        INT *best = (INT *)fasp_mem_calloc(row, sizeof(INT));
+        INT  k;
+        for ( k = 0; k < PAIR_MATCH_ROUNDS; k++ ) {
+            if ( !pair_handshake(A, s, k_tg, iperm, FALSE, vertices->val, match, best) ) break;
         }
+        fasp_mem_free(best); best = NULL;
+    }
+#endif
+
+    /*-----------------------------------------*/
+    /* Step 4. start the pairwise aggregation  */
+    /*-----------------------------------------*/
+    for ( i = 0; i < row; i++ ) {
 
-        // skip nodes if they have been determined
-        if ( vertices->val[i] != UNPT ) { i ++ ; continue;}
+        // skip G0 type nodes and nodes which have been determined
+        if ( vertices->val[i] != UNPT ) continue;
 
         vertices->val[i] = nc;
         map->val[2*nc] = i;
-        node ++;
 
         // check whether node has large off-diagonal positive node or not
         if ( iperm[i] == -1 ) {
             map->val[2*nc+1] = -1;
             nc ++;
-            i ++;
             continue;
         }
 
-        ipair = -1;
-
-        row_start = AIA[i]; row_end = AIA[i+1];
-
-        aii = Aval[row_start];
-
-        for ( j = row_start + 1; j < row_end; j++ ) {
-            col = AJA[j];
-            if ( vertices->val[col] != UNPT || iperm[col] == -1 ) continue;
-
-            aij = Aval[j];
-            ajj = Aval[AIA[col]];
-            aji = 0.0;
-
-            for (k = AIA[col]; k < AIA[col+1]; ++k) {
-                if (AJA[k] == i) {
-                    aji = Aval[k];
-                    break;
-                }
-            }
-
-            vals = -0.5*(aij+aji);
-
-            rsi = -s[i] + aii;
-            rsj = -s[col] + ajj;
-
-            eta1 = 2*aii;
-            eta2 = 2*ajj;
-
-            sig1 = s[i]-vals;
-            sig2 = s[col]-vals;
-
-            if (sig1 > 0) {
-                del1 = rsi;
-            } else {
-                del1 = rsi+2*sig1;
-            }
-            if (sig2 > 0) {
-                del2 = rsj;
-            } else {
-                del2 = rsj+2*sig2;
-            }
-            if (vals > 0.0) {
-                epsr = 1.49e-8*vals;
-                if ((ABS(del1) < epsr) && (ABS(del2) < epsr)) {
-                    mu = (eta1*eta2)/(vals*(eta1+eta2));
-                } else if (ABS(del1) < epsr) {
-                    if (del2 < -epsr) continue;
-                    mu = (eta1*eta2)/(vals*(eta1+eta2));
-                } else if (ABS(del2) < epsr) {
-                    if (del1 < -epsr) continue;
-                    mu = (eta1*eta2)/(vals*(eta1+eta2));
-                } else {
-                    del12 = del1 + del2;
-                    if (del12 < -epsr) continue;
-                    if (del12 == 0.0) continue;
-                    mu = vals + del1*del2/del12;
-                    if (mu <= 0.0) continue;
-                    mu = ((eta1*eta2)/(eta1+eta2))/mu;
-                }
-            }
-            else {
-                if (del1 <= 0.0 || del2 <= 0.0) continue;
-                mu = vals + del1*del2/(del1+del2);
-                if (mu <= 0.0) continue;
-                vals = (eta1*eta2)/(eta1+eta2);
-                mu = vals/mu;
-            }
-
-            if (mu > k_tg) continue;
-
-            tent = mu;
-
-            if (ipair == -1) {
-                ipair = col;
-                val = tent;
-            }
-            else if ( (tent-val) < -0.06 ) {
-                ipair = col;
-                val = tent;
-            }
-        }
+        if ( match[i] >= 0 )
+            ipair = match[i];
+        else
+            ipair = pair_best(A, s, k_tg, iperm, FALSE, vertices->val, match, i);
 
         if (ipair == -1) {
             map->val[2*nc+1] = -2;
@@ -923,11 +1072,9 @@ static void nsympair_1stpass (const dCSRmat * A,
         else {
             vertices->val[ipair] = nc;
             map->val[2*nc+1] = ipair;
-            node ++;
         }
 
         nc++;
-        i ++;
     }
 
     map->row = 2*nc;
@@ -937,6 +1084,7 @@ static void nsympair_1stpass (const dCSRmat * A,
     *NumAggregates = nc;
 
     fasp_mem_free(iperm); iperm = NULL;
+    fasp_mem_free(match); match = NULL;
 }
 
 /**
@@ -963,6 +1111,8 @@ static void nsympair_1stpass (const dCSRmat * A,
  *
  * \note  Refer to Yvan Notay "Aggregation-based algebraic multigrid
  *        for convection-diffusion equations" 2011.
+ *
+ * Modified by agent on 10/18/2026: add parallel handshake matching
  */
 static void nsympair_2ndpass (const dCSRmat  *A,
                               dCSRmat        *tmpA,
@@ -984,9 +1134,8 @@ static void nsympair_2ndpass (const dCSRmat  *A,
     REAL *Tval;
     INT *Tnode;
 
-    INT  col,ipair,Tsize, row_start, row_end, Semipd, nc, node;
-    REAL mu, aii, ajj, aij, tmp, aji, vals, val = 0;
-    REAL del1, del2, eta1, eta2, sig1, sig2, rsi, rsj, epsr,del12;
+    INT  col,ipair,Tsize, row_start, row_end, Semipd, nc;
+    REAL mu, aii, ajj, aij, tmp, aji, val = 0;
 
     Tval  = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
     Tnode = (INT*)fasp_mem_calloc(row, sizeof(INT));
@@ -994,33 +1143,65 @@ static void nsympair_2ndpass (const dCSRmat  *A,
     fasp_ivec_alloc(2*row, map);
     fasp_ivec_alloc(row, vertices);
 
-    nc = node = 0;
+    nc = 0;
 
     REAL *s = (REAL *)fasp_mem_calloc(row, sizeof(REAL));
 
+    // nodes isolated in first pass are marked by -1
+    INT *iso   = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    INT *match = (INT *)fasp_mem_calloc(row, sizeof(INT));
+
     pair_aggregate_init2(A, map1, vertices1, s1, s);
 
     fasp_ivec_set(0, vertices, UNPT);
 
-    i = 0;
+    for ( i = 0; i < row; i++ ) iso[i] = ( map1->val[2*i+1] == -1 ) ? -1 : 0;
 
-    while (node < row) {
+    fasp_iarray_set(row, match, -1);
 
-        // check nodes whether are aggregated
-        if ( vertices->val[i] != UNPT ) {
-            i++;
-            continue;
+#ifdef _OPENMP
+    // match most of the pairs in parallel
+    if ( row > OPENMP_HOLDS ) {
+        INT *best = (INT *)fasp_mem_calloc(row, sizeof(INT));
+        for ( k = 0; k < PAIR_MATCH_ROUNDS; k++ ) {
+            if ( !pair_handshake(tmpA, s, k_tg, iso, FALSE, vertices->val, match, best) ) break;
+
+            // new pairs failing the quality check are left to the greedy pass
+#pragma omp parallel for private(i,j)
+            for ( i = 0; i < row; i++ ) {
+                j = best[i];
+                if ( j > i && match[i] == j &&
+                     !aggregation_quality(A, map1, s1, i, j, dopass, k_tg) )
+                    match[i] = match[j] = -2;
+            }
+        }
+        for ( i = 0; i < row; i++ ) {
+            if ( match[i] == -2 ) match[i] = -1;
         }
+        fasp_mem_free(best); best = NULL;
+    }
+#endif
+
+    for ( i = 0; i < row; i++ ) {
+
+        // check nodes whether are aggregated
+        if ( vertices->val[i] != UNPT ) continue;
 
         vertices->val[i] = nc;
         map->val[2*nc] = i;
 
-        node ++;
         // if node isolated in first pass will be isolated in second pass
-        if (map1->val[2*i+1] == -1) {
+        if (iso[i] == -1) {
             map->val[2*nc+1] = -1;
             nc ++;
-            i ++;
+            continue;
+        }
+
+        // pairs found by parallel matching have passed the quality check
+        if (match[i] >= 0) {
+            vertices->val[match[i]] = nc;
+            map->val[2*nc+1] = match[i];
+            nc ++;
             continue;
         }
 
@@ -1034,7 +1215,7 @@ static void nsympair_2ndpass (const dCSRmat  *A,
         for ( j= row_start + 1; j < row_end; j++ ) {
             col = AJA[j];
 
-            if ( vertices->val[col] != UNPT || map1->val[2*col+1] == -1) continue;
+            if ( vertices->val[col] != UNPT || iso[col] == -1 || match[col] != -1 ) continue;
 
             aji = 0.0;
             aij = Aval[j];
@@ -1047,51 +1228,8 @@ static void nsympair_2ndpass (const dCSRmat  *A,
                 }
             }
 
-            vals = -0.5*(aij+aji);
-            rsi = -s[i] + aii;
-            rsj = -s[col] + ajj;
-            eta1 = 2*aii;
-            eta2 = 2*ajj;
+            if (!pair_mu_nsym(aii, ajj, aij, aji, s[i], s[col], &mu)) continue;
 
-            sig1 = s[i]-vals;
-            sig2 = s[col]-vals;
-
-            if (sig1 > 0) {
-                del1 = rsi;
-            } else {
-                del1 = rsi+2*sig1;
-            }
-            if (sig2 > 0) {
-                del2 = rsj;
-            } else {
-                del2 = rsj+2*sig2;
-            }
-            if (vals > 0.0) {
-                epsr=1.49e-8*vals;
-                if ((ABS(del1) < epsr) && (ABS(del2) < epsr)) {
-                    mu = (eta1*eta2)/(vals*(eta1+eta2));
-                } else if (ABS(del1) < epsr) {
-                    if (del2 < -epsr) continue;
-                    mu = (eta1*eta2)/(vals*(eta1+eta2));
-                } else if (ABS(del2) < epsr) {
-                    if (del1 < -epsr) continue;
-                    mu = (eta1*eta2)/(vals*(eta1+eta2));
-                } else {
-                    del12 = del1 + del2;
-                    if (del12 < -epsr) continue;
-                    if (del12 == 0.0) continue;
-                    mu = vals + del1*del2/del12;
-                    if (mu <= 0.0) continue;
-                    mu = ((eta1*eta2)/(eta1+eta2))/mu;
-                }
-            }
-            else {
-                if (del1 <= 0.0 || del2 <= 0.0) continue;
-                mu = vals + del1*del2/(del1+del2);
-                if (mu <= 0.0) continue;
-                aij = (eta1*eta2)/(eta1+eta2);
-                mu = aij/mu;
-            }
             if (mu > k_tg) continue;
 
             tmp = mu;
@@ -1118,7 +1256,6 @@ static void nsympair_2ndpass (const dCSRmat  *A,
         if (ipair == -1) {
             map->val[2*nc+1] = -2;
             nc ++;
-            i ++;
             continue;
         }
 
@@ -1158,10 +1295,8 @@ static void nsympair_2ndpass (const dCSRmat  *A,
         else {
             vertices->val[ipair] = nc;
             map->val[2*nc+1] = ipair;
-            node ++;
         }
 
-        i ++;
         nc ++;
     }
 
@@ -1175,6 +1310,8 @@ static void nsympair_2ndpass (const dCSRmat  *A,
     fasp_mem_free(s);      s     = NULL;
     fasp_mem_free(Tnode);  Tnode = NULL;
     fasp_mem_free(Tval);   Tval  = NULL;
+    fasp_mem_free(iso);    iso   = NULL;
+    fasp_mem_free(match);  match = NULL;
 }
 
 /**
@@ -1198,6 +1335,7 @@ static void nsympair_2ndpass (const dCSRmat  *A,
  *       "An algebraic multigrid method with guaranteed convergence rate", 2012
  *
  * Modified by Chensong Zhang, Zheng Li on 07/29/2014
+ * Modified by agent on 10/18/2026: form coarse matrices from aggregates
  */
 static SHORT aggregation_nsympair (AMG_data   *mgl,
                                    AMG_param  *param,
@@ -1212,6 +1350,7 @@ static SHORT aggregation_nsympair (AMG_data   *mgl,
     INT        i, j, k, num_agg = 0, aggindex;
     INT        lvl = level;
     REAL       isorate;
+    iCSRmat    aggnodes;
 
     SHORT      dopass = 0, domin = 0;
     SHORT      status = FASP_SUCCESS;
@@ -1242,22 +1381,15 @@ static SHORT aggregation_nsympair (AMG_data   *mgl,
         }
 
         if ( i < pair_number ) {
-            /*-- Form Prolongation --*/
-            form_boolean_p(&vertices[lvl], &mgl[lvl].P, num_agg);
-
-			/*-- Perform aggressive coarsening only up to the specified level --*/
-            if ( mgl[lvl].P.col < MIN_CDOF ) break;
-
-			/*-- Form restriction --*/
-            fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+            /*-- Perform aggressive coarsening only up to the specified level --*/
+            if ( num_agg < MIN_CDOF ) break;
 
-			/*-- Form coarse level stiffness matrix --*/
-            fasp_blas_dcsr_rap_agg(&mgl[lvl].R, ptrA, &mgl[lvl].P, &mgl[lvl+1].A);
+            /*-- Form coarse level stiffness matrix from the aggregates --*/
+            fasp_aggmap_trans(&vertices[lvl], num_agg, &aggnodes);
+            fasp_blas_dcsr_rap_aggmap(ptrA, &vertices[lvl], &aggnodes, &mgl[lvl+1].A);
+            fasp_icsr_free(&aggnodes);
 
             ptrA = &mgl[lvl+1].A;
-
-            fasp_dcsr_free(&mgl[lvl].P);
-            fasp_dcsr_free(&mgl[lvl].R);
         }
         lvl ++; dopass ++;
     }
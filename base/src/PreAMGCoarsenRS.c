@@ -40,7 +40,6 @@ static INT compress_S(iCSRmat*);
 
 static void strong_couplings(dCSRmat*, iCSRmat*, AMG_param*);
 static void form_P_pattern_dir(dCSRmat*, iCSRmat*, ivector*, INT, INT);
-static void form_P_pattern_std(dCSRmat*, iCSRmat*, ivector*, INT, INT);
 static void ordering1(iCSRmat*, ivector*);
 
 static void form_P_pattern_rdc(dCSRmat*, dCSRmat*, double*, ivector*, INT, INT);
@@ -57,7 +56,8 @@ static void form_P_pattern_rdc(dCSRmat*, dCSRmat*, double*, ivector*, INT, INT);
  *
  * \param A          Pointer to dCSRmat: Coefficient matrix (index starts from 0)
  * \param vertices   Indicator vector for the C/F splitting of the variables
- * \param P          Interpolation matrix (nonzero pattern only)
+ * \param P          Interpolation matrix (nonzero pattern only, or size only
+ *                   for standard and extended interpolations)
  * \param S          Strong connection matrix
  * \param param      Pointer to AMG_param: AMG parameters
  *
@@ -72,6 +72,7 @@ static void form_P_pattern_rdc(dCSRmat*, dCSRmat*, double*, ivector*, INT, INT);
  * Modified by Xiaozhe Hu on 04/24/2013: modify aggressive coarsening
  * Modified by Chensong Zhang on 04/28/2013: remove linked list
  * Modified by Chensong Zhang on 05/11/2013: restructure the code
+ * Modified by agent on 10/18/2026: defer P pattern for STD and EXT
  */
 SHORT fasp_amg_coarsening_rs(
     dCSRmat* A, ivector* vertices, dCSRmat* P, iCSRmat* S, AMG_param* param)
@@ -151,7 +152,13 @@ SHORT fasp_amg_coarsening_rs(
 
         case INTERP_STD: // Standard interpolation
         case INTERP_EXT: // Extended interpolation
-            form_P_pattern_std(P, S, vertices, row, col);
+            // P is formed row by row in fasp_amg_interp, only set its size here
+            P->row = row;
+            P->col = col;
+            P->nnz = 0;
+            P->IA  = (INT*)fasp_mem_calloc(row + 1, sizeof(INT));
+            P->JA  = NULL;
+            P->val = NULL;
             break;
 
         case INTERP_RDC: // Reduction-based amg interpolation
@@ -1984,132 +1991,6 @@ form_P_pattern_dir(dCSRmat* P, iCSRmat* S, ivector* vertices, INT row, INT col)
     }
 }
 
-/**
- * \fn static void form_P_pattern_std (dCSRmat *P, iCSRmat *S, ivector *vertices,
- *                                     INT row, INT col)
- *
- * \brief Generate sparsity pattern of prolongation for standard interpolation
- *
- * \param P         Pointer to the prolongation matrix
- * \param S         Pointer to the set of all strong couplings matrix
- * \param vertices  Pointer to the type of variables
- * \param row       Number of rows of P
- * \param col       Number of cols of P
- *
- * \author Kai Yang, Xiaozhe Hu
- * \date   05/21/2012
- *
- * Modified by Chunsheng Feng, Zheng Li on 10/13/2012: add OMP support
- * Modified by Chensong Zhang on 05/13/2013: restructure the code
- */
-static void
-form_P_pattern_std(dCSRmat* P, iCSRmat* S, ivector* vertices, INT row, INT col)
-{
-    // local variables
-    INT  i, j, k, l, h, index;
-    INT* vec = vertices->val;
-
-    // number of times a C-point is visited
-    INT* visited = (INT*)fasp_mem_calloc(row, sizeof(INT));
-
-    P->row = row;
-    P->col = col;
-    P->IA  = (INT*)fasp_mem_calloc(row + 1, sizeof(INT));
-
-    fasp_iarray_set(row, visited, -1);
-
-    // Step 1: Find the structure IA of P first: use P as a counter
-    for (i = 0; i < row; ++i) {
-
-        if (vec[i] == FGPT) { // if node i is a F point
-            for (j = S->IA[i]; j < S->IA[i + 1]; j++) {
-
-                k = S->JA[j];
-
-                // if neighbor of i is a C point, good
-                if ((vec[k] == CGPT) && (visited[k] != i)) {
-                    visited[k] = i;
-                    P->IA[i + 1]++;
-                }
-
-                // if k is a F point and k is not i, look for indirect C neighbors
-                else if ((vec[k] == FGPT) && (k != i)) {
-                    for (l = S->IA[k]; l < S->IA[k + 1]; l++) { // neighbors of k
-                        h = S->JA[l];
-                        if ((vec[h] == CGPT) && (visited[h] != i)) {
-                            visited[h] = i;
-                            P->IA[i + 1]++;
-                        }
-                    } // end for(l=S->IA[k];l<S->IA[k+1];l++)
-                }     // end if (vec[k]==CGPT)
-
-            } // end for (j=S->IA[i];j<S->IA[i+1];j++)
-        }
-
-        else if (vec[i] == CGPT) { // if node i is a C point
-            P->IA[i + 1] = 1;
-        }
-
-        else { // treat everything else as isolated points
-            P->IA[i + 1] = 0;
-        } // end if (vec[i]==FGPT)
-
-    } // end for (i=0;i<row;++i)
-
-    // Form P->IA from the counter P
-    for (i = 0; i < P->row; ++i) P->IA[i + 1] += P->IA[i];
-    P->nnz = P->IA[P->row] - P->IA[0];
-
-    // Step 2: Find the structure JA of P
-    P->JA  = (INT*)fasp_mem_calloc(P->nnz, sizeof(INT));
-    P->val = (REAL*)fasp_mem_calloc(P->nnz, sizeof(REAL));
-
-    fasp_iarray_set(row, visited, -1); // re-init visited array
-
-    for (i = 0; i < row; ++i) {
-
-        if (vec[i] == FGPT) { // if node i is a F point
-
-            index = 0;
-
-            for (j = S->IA[i]; j < S->IA[i + 1]; j++) {
-
-                k = S->JA[j];
-
-                // if neighbor k of i is a C point
-                if ((vec[k] == CGPT) && (visited[k] != i)) {
-                    visited[k]              = i;
-                    P->JA[P->IA[i] + index] = k;
-                    index++;
-                }
-
-                // if neighbor k of i is a F point and k is not i
-                else if ((vec[k] == FGPT) && (k != i)) {
-                    for (l = S->IA[k]; l < S->IA[k + 1]; l++) { // neighbors of k
-                        h = S->JA[l];
-                        if ((vec[h] == CGPT) && (visited[h] != i)) {
-                            visited[h]              = i;
-                            P->JA[P->IA[i] + index] = h;
-                            index++;
-                        }
-
-                    } // end for (l=S->IA[k];l<S->IA[k+1];l++)
-
-                } // end if (vec[k]==CGPT)
-
-            } // end for (j=S->IA[i];j<S->IA[i+1];j++)
-        }
-
-        else if (vec[i] == CGPT) {
-            P->JA[P->IA[i]] = i;
-        }
-    }
-
-    // clean up
-    fasp_mem_free(visited);
-    visited = NULL;
-}
-
 /**
  * \fn static INT cfsplitting_mis (iCSRmat *S, ivector *vertices, ivector *order)
  *
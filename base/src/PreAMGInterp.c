@@ -1,6 +1,6 @@
 /*! \file  PreAMGInterp.c
  *
- *  \brief Direct and standard interpolations for classical AMG
+ *  \brief Direct, standard, and extended+i interpolations for classical AMG
  *
  *  \note  This file contains Level-4 (Pre) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxThreads.c,
@@ -12,6 +12,10 @@
  *         Academic Press Inc., San Diego, CA, 2001
  *         With contributions by A. Brandt, P. Oswald and K. Stuben.
  *
+ *         H. De Sterck, R.D. Falgout, J.W. Nolting, and U.M. Yang
+ *         Distance-two interpolation for parallel algebraic multigrid
+ *         Numer. Linear Algebra Appl., 15 (2008), pp. 115-139
+ *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
  *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
@@ -36,7 +40,11 @@ static void interp_DIR(dCSRmat*, ivector*, dCSRmat*, AMG_param*);
 static void interp_RDC(dCSRmat*, ivector*, dCSRmat*, AMG_param*);
 static void interp_STD(dCSRmat*, ivector*, dCSRmat*, iCSRmat*, AMG_param*);
 static void interp_EXT(dCSRmat*, ivector*, dCSRmat*, iCSRmat*, AMG_param*);
+static void interp_dist2(dCSRmat*, ivector*, dCSRmat*, iCSRmat*, AMG_param*, const SHORT);
 static void amg_interp_trunc(dCSRmat*, AMG_param*);
+static INT  interp_trunc_row(const INT, INT*, REAL*, const REAL, const INT);
+static void interp_sort_row(const INT, INT*, REAL*, const SHORT);
+static inline INT interp_hash_find(const INT, const INT*, const INT);
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -123,108 +131,186 @@ void fasp_amg_interp(
  * Originally by Xuehai Huang, Chensong Zhang on 01/31/2009
  * Modified by Chunsheng Feng, Xiaoqiang Yue on 05/23/2012: add OMP support
  * Modified by Chensong Zhang on 05/14/2013: rewritten
+ * Modified by agent on 10/18/2026: truncate rows in parallel
  */
 static void amg_interp_trunc(dCSRmat* P, AMG_param* param)
 {
-    const INT  row    = P->row;
-    const INT  nnzold = P->nnz;
-    const INT  prtlvl = param->print_level;
-    const REAL eps_tr = param->truncation_threshold;
+    const INT  row     = P->row;
+    const INT  nnzold  = P->nnz;
+    const INT  prtlvl  = param->print_level;
+    const REAL eps_tr  = param->truncation_threshold;
+    const INT  max_nnz = param->truncation_max_nnz;
 
     // local variables
-    INT  num_nonzero = 0;   // number of non zeros after truncation
-    REAL Min_neg, Max_pos;  // min negative and max positive entries
-    REAL Fac_neg, Fac_pos;  // factors for negative and positive entries
-    REAL Sum_neg, TSum_neg; // sum and truncated sum of negative entries
-    REAL Sum_pos, TSum_pos; // sum and truncated sum of positive entries
+    INT   num_nonzero = 0; // number of non zeros after truncation
+    INT * IA, *JA;
+    REAL* val;
+    INT   i, begin;
 
-    INT index1 = 0, index2 = 0, begin, end;
-    INT i, j;
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if (row > OPENMP_HOLDS) use_openmp = TRUE;
+#endif
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
 #endif
 
-    for (i = 0; i < row; ++i) {
-
-        begin = P->IA[i];
-        end   = P->IA[i + 1];
-
-        P->IA[i] = num_nonzero;
-        Min_neg = Max_pos = 0;
-        Sum_neg = Sum_pos = 0;
-        TSum_neg = TSum_pos = 0;
+    IA = (INT*)fasp_mem_calloc(row + 1, sizeof(INT));
 
-        // 1. Summations of positive and negative entries
-        for (j = begin; j < end; ++j) {
-
-            if (P->val[j] > 0) {
-                Sum_pos += P->val[j];
-                Max_pos = MAX(Max_pos, P->val[j]);
-            }
+    // 1. Truncate each row in its own segment, rows are independent
+#ifdef _OPENMP
+#pragma omp parallel for private(i, begin) if (use_openmp)
+#endif
+    for (i = 0; i < row; ++i) {
+        begin     = P->IA[i];
+        IA[i + 1] = interp_trunc_row(P->IA[i + 1] - begin, P->JA + begin,
+                                     P->val + begin, eps_tr, max_nnz);
+    }
 
-            else {
-                Sum_neg += P->val[j];
-                Min_neg = MIN(Min_neg, P->val[j]);
-            }
-        }
+    // 2. Form row pointers of truncated P
+    for (i = 0; i < row; ++i) IA[i + 1] += IA[i];
+    num_nonzero = IA[row];
 
-        // Truncate according to max and min values!!!
-        Max_pos *= eps_tr;
-        Min_neg *= eps_tr;
+    // 3. Move the remaining entries to the new arrays
+    JA  = (INT*)fasp_mem_calloc(MAX(num_nonzero, 1), sizeof(INT));
+    val = (REAL*)fasp_mem_calloc(MAX(num_nonzero, 1), sizeof(REAL));
 
-        // 2. Set JA of truncated P
-        for (j = begin; j < end; ++j) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i, begin) if (use_openmp)
+#endif
+    for (i = 0; i < row; ++i) {
+        begin = P->IA[i];
+        memcpy(JA + IA[i], P->JA + begin, (IA[i + 1] - IA[i]) * sizeof(INT));
+        memcpy(val + IA[i], P->val + begin, (IA[i + 1] - IA[i]) * sizeof(REAL));
+    }
 
-            if (P->val[j] >= Max_pos) {
-                num_nonzero++;
-                P->JA[index1++] = P->JA[j];
-                TSum_pos += P->val[j];
-            }
+    // resize the truncated prolongation P
+    fasp_mem_free(P->IA);
+    fasp_mem_free(P->JA);
+    fasp_mem_free(P->val);
+    P->IA  = IA;
+    P->JA  = JA;
+    P->val = val;
+    P->nnz = num_nonzero;
 
-            else if (P->val[j] <= Min_neg) {
-                num_nonzero++;
-                P->JA[index1++] = P->JA[j];
-                TSum_neg += P->val[j];
-            }
-        }
+    if (prtlvl >= PRINT_MOST) {
+        printf("NNZ in prolongator: before truncation = %10d, after = %10d\n", nnzold,
+               num_nonzero);
+    }
 
-        // 3. Compute factors and set values of truncated P
-        if (TSum_pos > SMALLREAL) {
-            Fac_pos = Sum_pos / TSum_pos; // factor for positive entries
-        } else {
-            Fac_pos = 1.0;
-        }
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+}
 
-        if (TSum_neg < -SMALLREAL) {
-            Fac_neg = Sum_neg / TSum_neg; // factor for negative entries
+/**
+ * \fn static INT interp_trunc_row (const INT n, INT *cols, REAL *vals,
+ *                                  const REAL eps_tr, const INT max_nnz)
+ *
+ * \brief Truncate one row of the prolongation in place
+ *
+ * \param n          Number of entries in the row
+ * \param cols       Column indices of the row (in/out)
+ * \param vals       Values of the row (in/out)
+ * \param eps_tr     Truncation threshold relative to the max pos/min neg entries
+ * \param max_nnz    Max number of entries kept in the row (0: no limit)
+ *
+ * \return           Number of entries after truncation
+ *
+ * \note Positive and negative entries are rescaled separately so that the row
+ *       sums of each sign are preserved. The order of the entries is kept unless
+ *       max_nnz is hit; in that case the row is returned with ascending columns.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static INT interp_trunc_row(const INT n, INT* cols, REAL* vals, const REAL eps_tr,
+                            const INT max_nnz)
+{
+    REAL Min_neg = 0.0, Max_pos = 0.0;   // min negative and max positive entries
+    REAL Fac_neg, Fac_pos;               // factors for negative and positive entries
+    REAL Sum_neg = 0.0, TSum_neg = 0.0;  // sum and truncated sum of negative entries
+    REAL Sum_pos = 0.0, TSum_pos = 0.0;  // sum and truncated sum of positive entries
+    INT  j, k, num = 0;
+
+    // 1. Summations of positive and negative entries
+    for (j = 0; j < n; ++j) {
+        if (vals[j] > 0) {
+            Sum_pos += vals[j];
+            Max_pos = MAX(Max_pos, vals[j]);
         } else {
-            Fac_neg = 1.0;
+            Sum_neg += vals[j];
+            Min_neg = MIN(Min_neg, vals[j]);
         }
+    }
 
-        for (j = begin; j < end; ++j) {
-
-            if (P->val[j] >= Max_pos)
-                P->val[index2++] = P->val[j] * Fac_pos;
+    // Truncate according to max and min values!!!
+    Max_pos *= eps_tr;
+    Min_neg *= eps_tr;
 
-            else if (P->val[j] <= Min_neg)
-                P->val[index2++] = P->val[j] * Fac_neg;
+    // 2. Keep large entries only
+    for (j = 0; j < n; ++j) {
+        if (vals[j] >= Max_pos || vals[j] <= Min_neg) {
+            cols[num] = cols[j];
+            vals[num] = vals[j];
+            num++;
         }
     }
 
-    // resize the truncated prolongation P
-    P->nnz = P->IA[row] = num_nonzero;
-    P->JA               = (INT*)fasp_mem_realloc(P->JA, num_nonzero * sizeof(INT));
-    P->val              = (REAL*)fasp_mem_realloc(P->val, num_nonzero * sizeof(REAL));
+    // 3. Keep at most max_nnz entries with largest magnitude
+    if (max_nnz > 0 && num > max_nnz) {
+        interp_sort_row(num, cols, vals, TRUE);
+        num = max_nnz;
+        interp_sort_row(num, cols, vals, FALSE);
+    }
 
-    if (prtlvl >= PRINT_MOST) {
-        printf("NNZ in prolongator: before truncation = %10d, after = %10d\n", nnzold,
-               num_nonzero);
+    // 4. Compute factors and set values of truncated row
+    for (j = 0; j < num; ++j) {
+        if (vals[j] > 0)
+            TSum_pos += vals[j];
+        else
+            TSum_neg += vals[j];
     }
 
-#if DEBUG_MODE > 0
-    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
-#endif
+    Fac_pos = (TSum_pos > SMALLREAL) ? Sum_pos / TSum_pos : 1.0;
+    Fac_neg = (TSum_neg < -SMALLREAL) ? Sum_neg / TSum_neg : 1.0;
+
+    for (k = 0; k < num; ++k) vals[k] *= (vals[k] > 0) ? Fac_pos : Fac_neg;
+
+    return num;
+}
+
+/**
+ * \fn static void interp_sort_row (const INT n, INT *cols, REAL *vals,
+ *                                  const SHORT by_value)
+ *
+ * \brief Insertion sort of a short row of the prolongation
+ *
+ * \param n          Number of entries in the row
+ * \param cols       Column indices of the row (in/out)
+ * \param vals       Values of the row (in/out)
+ * \param by_value   TRUE: descending magnitude; FALSE: ascending column index
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void interp_sort_row(const INT n, INT* cols, REAL* vals, const SHORT by_value)
+{
+    INT  j, k, c;
+    REAL v;
+
+    for (j = 1; j < n; ++j) {
+        c = cols[j];
+        v = vals[j];
+        for (k = j - 1; k >= 0; --k) {
+            if (by_value ? (ABS(vals[k]) >= ABS(v)) : (cols[k] <= c)) break;
+            cols[k + 1] = cols[k];
+            vals[k + 1] = vals[k];
+        }
+        cols[k + 1] = c;
+        vals[k + 1] = v;
+    }
 }
 
 /**
@@ -533,7 +619,7 @@ static void interp_DIR(dCSRmat* A, ivector* vertices, dCSRmat* P, AMG_param* par
  *
  * \param A          Pointer to dCSRmat: the coefficient matrix (index starts from 0)
  * \param vertices   Indicator vector for the C/F splitting of the variables
- * \param P          Interpolation matrix (input: nnz pattern, output: prolongation)
+ * \param P          Interpolation matrix (output: prolongation)
  * \param S          Strong connection matrix
  * \param param      Pointer to AMG_param: AMG parameters
  *
@@ -543,413 +629,442 @@ static void interp_DIR(dCSRmat* A, ivector* vertices, dCSRmat* P, AMG_param* par
  * Modified by Chunsheng Feng, Zheng Li on 10/17/2012: add OMP support
  * Modified by Chensong Zhang on 05/15/2013: reconstruct the code
  * Modified by Chunsheng Feng, Xiaoqiang Yue on 12/25/2013: check C1 Criterion
+ * Modified by agent on 10/18/2026: build P row by row in parallel
  */
 static void interp_STD(dCSRmat* A, ivector* vertices, dCSRmat* P, iCSRmat* S, AMG_param* param)
 {
-    const INT row = A->row;
-    INT*      vec = vertices->val;
-
-    // local variables
-    INT  i, j, k, l, m, index;
-    REAL alpha = 1.0, factor, alN, alP;
-    REAL akk, akl, aik, aki;
-
-    // indices for coarse neighbor node for every node
-    INT* cindex = (INT*)fasp_mem_calloc(row, sizeof(INT));
+    interp_dist2(A, vertices, P, S, param, INTERP_STD);
+}
 
-    // indices from column number to index in nonzeros in i-th row
-    INT* rindi = (INT*)fasp_mem_calloc(2 * row, sizeof(INT));
+/**
+ * \fn static void interp_EXT (dCSRmat *A, ivector *vertices, dCSRmat *P,
+ *                             iCSRmat *S, AMG_param *param)
+ *
+ * \brief Extended+i interpolation
+ *
+ * \param A          Pointer to dCSRmat: the coefficient matrix (index starts from 0)
+ * \param vertices   Indicator vector for the C/F splitting of the variables
+ * \param P          Interpolation matrix (output: prolongation)
+ * \param S          Strong connection matrix
+ * \param param      Pointer to AMG_param: AMG parameters
+ *
+ * \author Zheng Li, Chensong Zhang
+ * \date   11/21/2014
+ *
+ * Modified by agent on 10/18/2026: use extended+i formula in parallel
+ *
+ * \note Ref. H. De Sterck, R.D. Falgout, J.W. Nolting, and U.M. Yang. Distance-two
+ *       interpolation for parallel algebraic multigrid. Numer. Linear Algebra
+ *       Appl., 15 (2008), pp. 115-139.
+ */
+static void interp_EXT(dCSRmat* A, ivector* vertices, dCSRmat* P, iCSRmat* S, AMG_param* param)
+{
+    interp_dist2(A, vertices, P, S, param, INTERP_EXT);
+}
 
-    // indices from column number to index in nonzeros in k-th row
-    INT* rindk = (INT*)fasp_mem_calloc(2 * row, sizeof(INT));
+/**
+ * \fn static void interp_dist2 (dCSRmat *A, ivector *vertices, dCSRmat *P,
+ *                               iCSRmat *S, AMG_param *param,
+ *                               const SHORT interp_type)
+ *
+ * \brief Distance-two interpolations (standard or extended+i)
+ *
+ * \param A            Pointer to dCSRmat: the coefficient matrix
+ * \param vertices     Indicator vector for the C/F splitting of the variables
+ * \param P            Interpolation matrix (output: prolongation)
+ * \param S            Strong connection matrix
+ * \param param        Pointer to AMG_param: AMG parameters
+ * \param interp_type  INTERP_STD or INTERP_EXT
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each thread builds a contiguous block of rows of P. The interpolatory
+ *       set of a F-point i, i.e. the strong C-neighbors of i and of its strong
+ *       F-neighbors, is collected in a thread-local hash table. The row is then
+ *       truncated, renumbered to the coarse space, and sorted right away, so P
+ *       is assembled only once in the sorted CSR format.
+ */
+static void interp_dist2(dCSRmat* A, ivector* vertices, dCSRmat* P, iCSRmat* S,
+                         AMG_param* param, const SHORT interp_type)
+{
+    const INT   row     = A->row;
+    const INT*  vec     = vertices->val;
+    const INT * ia = A->IA, *ja = A->JA, *is = S->IA, *js = S->JA;
+    const REAL* aj      = A->val;
+    const REAL  eps_tr  = param->truncation_threshold;
+    const INT   max_nnz = param->truncation_max_nnz;
+    const INT   prtlvl  = param->print_level;
 
-    // sums of strongly connected C neighbors
-    REAL* csum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+    // local variables
+    INT   i, j, k, index, myid, mybegin, myend;
+    INT   nthreads = 1;
+    REAL* csum = NULL; // sums of strongly connected C neighbors
+    REAL* nsum = NULL; // sums of all (or all except ISPT) neighbors
+    REAL* sval = NULL; // values of A on the strong couplings
 
-#if RS_C1
-    // sums of all neighbors except ISPT
-    REAL* psum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+    if (row > OPENMP_HOLDS) {
+        use_openmp = TRUE;
+        nthreads   = fasp_get_num_threads();
+    }
 #endif
 
-    // sums of all neighbors
-    REAL* nsum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+    // indices of C-nodes in the coarse space
+    INT* cindex = (INT*)fasp_mem_calloc(row, sizeof(INT));
 
     // diagonal entries
     REAL* diag = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
 
-    // coefficients hat a_ij for relevant CGPT of the i-th node
-    REAL* Ahat = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+    // rows of P computed by each thread
+    INT*   tnnz = (INT*)fasp_mem_calloc(nthreads + 1, sizeof(INT));
+    INT**  tJA  = (INT**)fasp_mem_calloc(nthreads, sizeof(INT*));
+    REAL** tval = (REAL**)fasp_mem_calloc(nthreads, sizeof(REAL*));
 
-    // Step 0. Prepare diagonal, Cs-sum, and N-sum
-    fasp_iarray_set(row, cindex, -1);
-    fasp_darray_set(row, csum, 0.0);
-    fasp_darray_set(row, nsum, 0.0);
+    // Step 0. Prepare coarse indices, diagonal, Cs-sum, and N-sum
+    for (index = i = 0; i < row; ++i) cindex[i] = (vec[i] == CGPT) ? index++ : -1;
 
-    for (i = 0; i < row; i++) {
-
-        // set flags for strong-connected C nodes
-        for (j = S->IA[i]; j < S->IA[i + 1]; j++) {
-            k = S->JA[j];
-            if (vec[k] == CGPT) cindex[k] = i;
-        }
-
-        for (j = A->IA[i]; j < A->IA[i + 1]; j++) {
-            k = A->JA[j];
-
-            if (cindex[k] == i) csum[i] += A->val[j]; // strong C-couplings
-
-            if (k == i) diag[i] = A->val[j];
-#if RS_C1
-            else {
-                nsum[i] += A->val[j];
-                if (vec[k] != ISPT) {
-                    psum[i] += A->val[j];
-                }
-            }
-#else
-            else
-                nsum[i] += A->val[j];
-#endif
-        }
+    if (interp_type == INTERP_STD) {
+        csum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+        nsum = (REAL*)fasp_mem_calloc(2 * row, sizeof(REAL));
+        sval = (REAL*)fasp_mem_calloc(MAX(is[row], 1), sizeof(REAL));
     }
 
-    // Step 1. Fill in values for interpolation operator P
-    for (i = 0; i < row; i++) {
-
-        if (vec[i] == FGPT) {
-#if RS_C1
-            alN = psum[i];
-#else
-            alN = nsum[i];
-#endif
-            alP = csum[i];
-
-            // form the reverse indices for i-th row
-            for (j = A->IA[i]; j < A->IA[i + 1]; j++) rindi[A->JA[j]] = j;
-
-            // clean up Ahat for relevant nodes only
-            for (j = P->IA[i]; j < P->IA[i + 1]; j++) Ahat[P->JA[j]] = 0.0;
-
-            // set values of Ahat
-            Ahat[i] = diag[i];
-
-            for (j = S->IA[i]; j < S->IA[i + 1]; j++) {
-
-                k   = S->JA[j];
-                aik = A->val[rindi[k]];
-
-                if (vec[k] == CGPT)
-                    Ahat[k] += aik;
-
-                else if (vec[k] == FGPT) {
-
-                    akk = diag[k];
-
-                    // form the reverse indices for k-th row
-                    for (m = A->IA[k]; m < A->IA[k + 1]; m++) rindk[A->JA[m]] = m;
-
-                    factor = aik / akk;
-
-                    // visit the strong-connected C neighbors of k, compute
-                    // Ahat in the i-th row, set aki if found
-                    aki = 0.0;
-#if 0 // modified by Xiaoqiang Yue 12/25/2013
-                    for ( m = S->IA[k]; m < S->IA[k+1]; m++ ) {
-                        l   = S->JA[m];
-                        akl = A->val[rindk[l]];
-                        if ( vec[l] == CGPT ) Ahat[l] -= factor * akl;
-                        else if ( l == i ) {
-                            aki = akl; Ahat[l] -= factor * aki;
-                        }
-                    } // end for m
-#else
-                    for (m = A->IA[k]; m < A->IA[k + 1]; m++) {
-                        if (A->JA[m] == i) {
-                            aki = A->val[m];
-                            Ahat[i] -= factor * aki;
-                        }
-                    } // end for m
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k) if (use_openmp)
 #endif
-                    for (m = S->IA[k]; m < S->IA[k + 1]; m++) {
-                        l   = S->JA[m];
-                        akl = A->val[rindk[l]];
-                        if (vec[l] == CGPT) Ahat[l] -= factor * akl;
-                    } // end for m
-
-                    // compute Cs-sum and N-sum for Ahat
-                    alN -= factor * (nsum[k] - aki + akk);
-                    alP -= factor * csum[k];
-
-                } // end if vec[k]
+    for (i = 0; i < row; ++i) {
+        INT p = ia[i];
 
-            } // end for j
+        for (j = ia[i]; j < ia[i + 1]; ++j) {
+            if (ja[j] == i) diag[i] = aj[j];
+        }
 
-            // Originally: alpha = alN/alP, do this only if P is not empty!
-            if (P->IA[i] < P->IA[i + 1]) alpha = alN / alP;
+        if (interp_type != INTERP_STD) continue;
 
-            // How about positive entries? --Chensong
-            for (j = P->IA[i]; j < P->IA[i + 1]; j++) {
-                k         = P->JA[j];
-                P->val[j] = -alpha * Ahat[k] / Ahat[i];
+        // values of strong couplings: S is a sub-pattern of A
+        for (j = is[i]; j < is[i + 1]; ++j) {
+            if (js[j] < 0) continue;
+            for (k = 0; k < ia[i + 1] - ia[i]; ++k) {
+                if (ja[p] == js[j]) break;
+                if (++p == ia[i + 1]) p = ia[i];
             }
-
+            sval[j] = aj[p];
+            if (vec[js[j]] == CGPT) csum[i] += aj[p]; // strong C-couplings
         }
 
-        else if (vec[i] == CGPT) {
-            P->val[P->IA[i]] = 1.0;
+        for (j = ia[i]; j < ia[i + 1]; ++j) {
+            k = ja[j];
+            if (k == i) continue;
+            nsum[i] += aj[j];                           // all neighbors
+            if (vec[k] != ISPT) nsum[row + i] += aj[j]; // all neighbors except ISPT
         }
-
-    } // end for i
-
-    // Step 2. Generate coarse level indices and set values of P.JA
-    for (index = i = 0; i < row; ++i) {
-        if (vec[i] == CGPT) cindex[i] = index++;
     }
-    P->col = index;
 
+    // Step 1. Compute rows of P block by block
 #ifdef _OPENMP
-#pragma omp parallel for private(i, j) if (P->IA[P->row] > OPENMP_HOLDS)
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k) if (use_openmp)
 #endif
-    for (i = 0; i < P->IA[P->row]; ++i) {
-        j        = P->JA[i];
-        P->JA[i] = cindex[j];
-    }
+    for (myid = 0; myid < nthreads; ++myid) {
 
-    // clean up
-    fasp_mem_free(cindex);
-    cindex = NULL;
-    fasp_mem_free(rindi);
-    rindi = NULL;
-    fasp_mem_free(rindk);
-    rindk = NULL;
-    fasp_mem_free(nsum);
-    nsum = NULL;
-    fasp_mem_free(csum);
-    csum = NULL;
-    fasp_mem_free(diag);
-    diag = NULL;
-    fasp_mem_free(Ahat);
-    Ahat = NULL;
+        // thread-local hash table: column -> position in row (or F-neighbor mark)
+        INT  hsize = 64, hmask = hsize - 1;
+        INT* hkey  = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
+        INT* hval  = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
+        INT* hused = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
 
-#if RS_C1
-    fasp_mem_free(psum);
-    psum = NULL;
-#endif
+        // thread-local work space for one row
+        INT*  cols  = (INT*)fasp_mem_calloc(hsize, sizeof(INT));
+        REAL* vals  = (REAL*)fasp_mem_calloc(hsize, sizeof(REAL));
 
-    // Step 3. Truncate the prolongation operator to reduce cost
-    amg_interp_trunc(P, param);
-}
+        // thread-local part of P
+        INT   cap = 0, cnt = 0;
+        INT*  bJA = NULL;
+        REAL* bval = NULL;
 
-/**
- * \fn static void interp_EXT (dCSRmat *A, ivector *vertices, dCSRmat *P,
- *                             iCSRmat *S, AMG_param *param)
- *
- * \brief Extended interpolation
- *
- * \param A          Pointer to dCSRmat: the coefficient matrix (index starts from 0)
- * \param vertices   Indicator vector for the C/F splitting of the variables
- * \param P          Interpolation matrix (input: nnz pattern, output: prolongation)
- * \param S          Strong connection matrix
- * \param param      Pointer to AMG_param: AMG parameters
- *
- * \author Zheng Li, Chensong Zhang
- * \date   11/21/2014
- *
- * \todo  Need to be fixed!  --zcs
- */
-static void interp_EXT(dCSRmat* A, ivector* vertices, dCSRmat* P, iCSRmat* S, AMG_param* param)
-{
-    const INT row = A->row;
-    INT*      vec = vertices->val;
+        INT  n, nused, bound, s, l, m;
+        REAL factor, alpha;
 
-    // local variables
-    INT  i, j, k, l, m, index;
-    REAL alpha = 1.0, factor, alN, alP;
-    REAL akk, akl, aik, aki;
-
-    // indices for coarse neighbor node for every node
-    INT* cindex = (INT*)fasp_mem_calloc(row, sizeof(INT));
-
-    // indices from column number to index in nonzeros in i-th row
-    INT* rindi = (INT*)fasp_mem_calloc(2 * row, sizeof(INT));
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        fasp_iarray_set(hsize, hkey, -1);
 
-    // indices from column number to index in nonzeros in k-th row
-    INT* rindk = (INT*)fasp_mem_calloc(2 * row, sizeof(INT));
+        cap  = 4 * (myend - mybegin) + 64;
+        bJA  = (INT*)fasp_mem_calloc(cap, sizeof(INT));
+        bval = (REAL*)fasp_mem_calloc(cap, sizeof(REAL));
 
-    // sums of strongly connected C neighbors
-    REAL* csum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+        for (i = mybegin; i < myend; ++i) {
 
-#if RS_C1
-    // sums of all neighbors except ISPT
-    REAL* psum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-#endif
-    // sums of all neighbors
-    REAL* nsum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+            n = 0;
 
-    // diagonal entries
-    REAL* diag = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-
-    // coefficients hat a_ij for relevant CGPT of the i-th node
-    REAL* Ahat = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-
-    // Step 0. Prepare diagonal, Cs-sum, and N-sum
-    fasp_iarray_set(row, cindex, -1);
-    fasp_darray_set(row, csum, 0.0);
-    fasp_darray_set(row, nsum, 0.0);
-
-    for (i = 0; i < row; i++) {
-
-        // set flags for strong-connected C nodes
-        for (j = S->IA[i]; j < S->IA[i + 1]; j++) {
-            k = S->JA[j];
-            if (vec[k] == CGPT) cindex[k] = i;
-        }
+            if (vec[i] == CGPT) { // identity for coarse points
+                cols[0] = cindex[i];
+                vals[0] = 1.0;
+                n       = 1;
+            }
 
-        for (j = A->IA[i]; j < A->IA[i + 1]; j++) {
-            k = A->JA[j];
+            else if (vec[i] == FGPT) { // interpolation for fine points
 
-            if (cindex[k] == i) csum[i] += A->val[j]; // strong C-couplings
+                // upper bound of the size of the interpolatory set
+                for (bound = 0, j = is[i]; j < is[i + 1]; ++j) {
+                    k = js[j];
+                    bound++;
+                    if (k >= 0 && vec[k] == FGPT) bound += is[k + 1] - is[k];
+                }
 
-            if (k == i) diag[i] = A->val[j];
-#if RS_C1
-            else {
-                nsum[i] += A->val[j];
-                if (vec[k] != ISPT) {
-                    psum[i] += A->val[j];
+                if (2 * bound > hsize) {
+                    while (2 * bound > hsize) hsize *= 2;
+                    hmask = hsize - 1;
+                    hkey  = (INT*)fasp_mem_realloc(hkey, hsize * sizeof(INT));
+                    hval  = (INT*)fasp_mem_realloc(hval, hsize * sizeof(INT));
+                    hused = (INT*)fasp_mem_realloc(hused, hsize * sizeof(INT));
+                    cols  = (INT*)fasp_mem_realloc(cols, hsize * sizeof(INT));
+                    vals  = (REAL*)fasp_mem_realloc(vals, hsize * sizeof(REAL));
+                    fasp_iarray_set(hsize, hkey, -1);
                 }
-            }
-#else
-            else
-                nsum[i] += A->val[j];
-#endif
-        }
-    }
 
-    // Step 1. Fill in values for interpolation operator P
-    for (i = 0; i < row; i++) {
+                // form the interpolatory set: hval = position in row, or -2 for
+                // a strong F-neighbor
+                n = nused = 0;
+                for (j = is[i]; j < is[i + 1]; ++j) {
+                    k = js[j];
+                    if (k < 0 || k == i) continue;
+                    if (vec[k] == CGPT) {
+                        s = interp_hash_find(k, hkey, hmask);
+                        if (hkey[s] < 0) {
+                            hkey[s]        = k;
+                            hval[s]        = n;
+                            hused[nused++] = s;
+                            cols[n]   = k;
+                            vals[n++] = 0.0;
+                        }
+                    } else if (vec[k] == FGPT) {
+                        s = interp_hash_find(k, hkey, hmask);
+                        if (hkey[s] < 0) {
+                            hkey[s]        = k;
+                            hval[s]        = -2;
+                            hused[nused++] = s;
+                        }
+                        for (l = is[k]; l < is[k + 1]; ++l) {
+                            m = js[l];
+                            if (m < 0 || vec[m] != CGPT) continue;
+                            s = interp_hash_find(m, hkey, hmask);
+                            if (hkey[s] < 0) {
+                                hkey[s]        = m;
+                                hval[s]        = n;
+                                hused[nused++] = s;
+                                cols[n]   = m;
+                                vals[n++] = 0.0;
+                            }
+                        }
+                    }
+                }
 
-        if (vec[i] == FGPT) {
+                if (interp_type == INTERP_STD) {
 #if RS_C1
-            alN = psum[i];
+                    REAL alN = nsum[row + i];
 #else
-            alN = nsum[i];
+                    REAL alN = nsum[i];
 #endif
-            alP = csum[i];
+                    REAL alP = csum[i], ahii = diag[i], aik, akk, aki;
 
-            // form the reverse indices for i-th row
-            for (j = A->IA[i]; j < A->IA[i + 1]; j++) rindi[A->JA[j]] = j;
+                    for (j = is[i]; j < is[i + 1]; ++j) {
+                        k = js[j];
+                        if (k < 0) continue;
+                        aik = sval[j];
 
-            // clean up Ahat for relevant nodes only
-            for (j = P->IA[i]; j < P->IA[i + 1]; j++) Ahat[P->JA[j]] = 0.0;
+                        if (vec[k] == CGPT) {
+                            vals[hval[interp_hash_find(k, hkey, hmask)]] += aik;
+                        }
 
-            // set values of Ahat
-            Ahat[i] = diag[i];
+                        else if (vec[k] == FGPT) {
+                            akk    = diag[k];
+                            factor = aik / akk;
 
-            for (j = S->IA[i]; j < S->IA[i + 1]; j++) {
+                            aki = 0.0;
+                            for (m = ia[k]; m < ia[k + 1]; m++) {
+                                if (ja[m] == i) {
+                                    aki = aj[m];
+                                    ahii -= factor * aki;
+                                }
+                            }
 
-                k   = S->JA[j];
-                aik = A->val[rindi[k]];
+                            for (m = is[k]; m < is[k + 1]; m++) {
+                                l = js[m];
+                                if (l >= 0 && vec[l] == CGPT) {
+                                    s = interp_hash_find(l, hkey, hmask);
+                                    vals[hval[s]] -= factor * sval[m];
+                                }
+                            }
 
-                if (vec[k] == CGPT)
-                    Ahat[k] += aik;
+                            // compute Cs-sum and N-sum for Ahat
+                            alN -= factor * (nsum[k] - aki + akk);
+                            alP -= factor * csum[k];
+                        }
+                    }
 
-                else if (vec[k] == FGPT) {
+                    alpha = (n > 0) ? alN / alP : 1.0;
+                    for (j = 0; j < n; ++j) vals[j] = -alpha * vals[j] / ahii;
+                }
 
-                    akk = diag[k];
+                else { // extended+i interpolation
+                    REAL ahii = 0.0, akk, akl, sum;
+                    INT  t;
 
-                    // form the reverse indices for k-th row
-                    for (m = A->IA[k]; m < A->IA[k + 1]; m++) rindk[A->JA[m]] = m;
+                    for (j = ia[i]; j < ia[i + 1]; ++j) {
+                        k = ja[j];
+                        if (k == i) {
+                            ahii += aj[j];
+                            continue;
+                        }
 
-                    factor = aik / akk;
+                        s = interp_hash_find(k, hkey, hmask);
 
-                    // visit the strong-connected C neighbors of k, compute
-                    // Ahat in the i-th row, set aki if found
-                    aki = 0.0;
-#if 0 // modified by Xiaoqiang Yue 12/25/2013
-                    for ( m = S->IA[k]; m < S->IA[k+1]; m++ ) {
-                        l   = S->JA[m];
-                        akl = A->val[rindk[l]];
-                        if ( vec[l] == CGPT ) Ahat[l] -= factor * akl;
-                        else if ( l == i ) {
-                            aki = akl; Ahat[l] -= factor * aki;
+                        if (hkey[s] < 0) { // weak neighbors go to the diagonal
+                            ahii += aj[j];
                         }
-                    } // end for m
-#else
-                    for (m = A->IA[k]; m < A->IA[k + 1]; m++) {
-                        if (A->JA[m] == i) {
-                            aki = A->val[m];
-                            Ahat[i] -= factor * aki;
+
+                        else if (hval[s] >= 0) { // interpolatory C-points
+                            vals[hval[s]] += aj[j];
                         }
-                    } // end for m
-#endif
-                    for (m = S->IA[k]; m < S->IA[k + 1]; m++) {
-                        l   = S->JA[m];
-                        akl = A->val[rindk[l]];
-                        if (vec[l] == CGPT) Ahat[l] -= factor * akl;
-                    } // end for m
 
-                    // compute Cs-sum and N-sum for Ahat
-                    alN -= factor * (nsum[k] - aki + akk);
-                    alP -= factor * csum[k];
+                        else { // strong F-neighbors: distribute to C_i and i
+                            akk = diag[k];
+                            sum = 0.0;
+                            for (m = ia[k]; m < ia[k + 1]; ++m) {
+                                l   = ja[m];
+                                akl = aj[m];
+                                if (akl * akk >= 0.0) continue; // opposite sign only
+                                if (l == i) {
+                                    sum += akl;
+                                    continue;
+                                }
+                                t = interp_hash_find(l, hkey, hmask);
+                                if (hkey[t] >= 0 && hval[t] >= 0) sum += akl;
+                            }
 
-                } // end if vec[k]
+                            if (ABS(sum) < SMALLREAL) {
+                                ahii += aj[j];
+                                continue;
+                            }
 
-            } // end for j
+                            factor = aj[j] / sum;
+                            for (m = ia[k]; m < ia[k + 1]; ++m) {
+                                l   = ja[m];
+                                akl = aj[m];
+                                if (akl * akk >= 0.0) continue;
+                                if (l == i) {
+                                    ahii += factor * akl;
+                                    continue;
+                                }
+                                t = interp_hash_find(l, hkey, hmask);
+                                if (hkey[t] >= 0 && hval[t] >= 0)
+                                    vals[hval[t]] += factor * akl;
+                            }
+                        }
+                    }
 
-            // Originally: alpha = alN/alP, do this only if P is not empty!
-            if (P->IA[i] < P->IA[i + 1]) alpha = alN / alP;
+                    if (ABS(ahii) < SMALLREAL) ahii = diag[i];
+                    for (j = 0; j < n; ++j) vals[j] = -vals[j] / ahii;
+                }
 
-            // How about positive entries? --Chensong
-            for (j = P->IA[i]; j < P->IA[i + 1]; j++) {
-                k         = P->JA[j];
-                P->val[j] = -alpha * Ahat[k] / Ahat[i];
-            }
+                // clean up the hash table for the next row
+                for (j = 0; j < nused; ++j) hkey[hused[j]] = -1;
 
-        }
+                // truncate, renumber to the coarse space, and sort
+                n = interp_trunc_row(n, cols, vals, eps_tr, max_nnz);
+                for (j = 0; j < n; ++j) cols[j] = cindex[cols[j]];
+                interp_sort_row(n, cols, vals, FALSE);
+
+            } // end if vec
 
-        else if (vec[i] == CGPT) {
-            P->val[P->IA[i]] = 1.0;
+            // append the row to the thread-local part of P
+            if (cnt + n > cap) {
+                cap  = MAX(2 * cap, cnt + n);
+                bJA  = (INT*)fasp_mem_realloc(bJA, cap * sizeof(INT));
+                bval = (REAL*)fasp_mem_realloc(bval, cap * sizeof(REAL));
+            }
+            memcpy(bJA + cnt, cols, n * sizeof(INT));
+            memcpy(bval + cnt, vals, n * sizeof(REAL));
+            cnt += n;
+            P->IA[i] = n; // temporarily store the row length
         }
 
-    } // end for i
+        tnnz[myid + 1] = cnt;
+        tJA[myid]      = bJA;
+        tval[myid]     = bval;
 
-    // Step 2. Generate coarse level indices and set values of P.JA
-    for (index = i = 0; i < row; ++i) {
-        if (vec[i] == CGPT) cindex[i] = index++;
+        fasp_mem_free(hkey);
+        fasp_mem_free(hval);
+        fasp_mem_free(hused);
+        fasp_mem_free(cols);
+        fasp_mem_free(vals);
     }
+
+    // Step 2. Assemble P from the thread-local parts
+    for (myid = 0; myid < nthreads; ++myid) tnnz[myid + 1] += tnnz[myid];
+
+    P->row = row;
     P->col = index;
+    P->nnz = tnnz[nthreads];
+    P->JA  = (INT*)fasp_mem_calloc(MAX(P->nnz, 1), sizeof(INT));
+    P->val = (REAL*)fasp_mem_calloc(MAX(P->nnz, 1), sizeof(REAL));
 
 #ifdef _OPENMP
-#pragma omp parallel for private(i, j) if (P->IA[P->row] > OPENMP_HOLDS)
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k) if (use_openmp)
 #endif
-    for (i = 0; i < P->IA[P->row]; ++i) {
-        j        = P->JA[i];
-        P->JA[i] = cindex[j];
+    for (myid = 0; myid < nthreads; ++myid) {
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        for (k = tnnz[myid], i = mybegin; i < myend; ++i) {
+            j        = P->IA[i];
+            P->IA[i] = k;
+            k += j;
+        }
+        memcpy(P->JA + tnnz[myid], tJA[myid], (tnnz[myid + 1] - tnnz[myid]) * sizeof(INT));
+        memcpy(P->val + tnnz[myid], tval[myid],
+               (tnnz[myid + 1] - tnnz[myid]) * sizeof(REAL));
+        fasp_mem_free(tJA[myid]);
+        fasp_mem_free(tval[myid]);
+    }
+    P->IA[row] = P->nnz;
+
+    if (prtlvl >= PRINT_MOST) {
+        printf("NNZ in prolongator: after truncation = %10d\n", P->nnz);
     }
 
     // clean up
     fasp_mem_free(cindex);
-    cindex = NULL;
-    fasp_mem_free(rindi);
-    rindi = NULL;
-    fasp_mem_free(rindk);
-    rindk = NULL;
-    fasp_mem_free(nsum);
-    nsum = NULL;
-    fasp_mem_free(csum);
-    csum = NULL;
     fasp_mem_free(diag);
-    diag = NULL;
-    fasp_mem_free(Ahat);
-    Ahat = NULL;
+    fasp_mem_free(csum);
+    fasp_mem_free(nsum);
+    fasp_mem_free(sval);
+    fasp_mem_free(tnnz);
+    fasp_mem_free(tJA);
+    fasp_mem_free(tval);
+}
 
-#if RS_C1
-    fasp_mem_free(psum);
-    psum = NULL;
-#endif
+/**
+ * \fn static inline INT interp_hash_find (const INT key, const INT *hkey,
+ *                                         const INT hmask)
+ *
+ * \brief Find the slot of a key in an open-addressing hash table
+ *
+ * \param key     Key to look for (nonnegative)
+ * \param hkey    Keys of the hash table (-1 for empty slots)
+ * \param hmask   Size of the hash table minus one (size is a power of 2)
+ *
+ * \return        Slot holding the key, or the empty slot where it should go
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline INT interp_hash_find(const INT key, const INT* hkey, const INT hmask)
+{
+    INT s = (INT)(((unsigned)key * 2654435761u) & (unsigned)hmask);
 
-    // Step 3. Truncate the prolongation operator to reduce cost
-    amg_interp_trunc(P, param);
+    while (hkey[s] >= 0 && hkey[s] != key) s = (s + 1) & hmask;
+
+    return s;
 }
 
 /*---------------------------------*/
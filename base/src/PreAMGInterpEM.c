@@ -507,6 +507,7 @@ static SHORT orderone (INT   **mat,
  *  itmat[0] record the column number, and itmat[1] record the row number.
  *
  * Modified by Chunsheng Feng, Zheng Li on 10/17/2012
+ * Modified by agent on 10/18/2026: create T by fasp_dcsr_create
  */
 static SHORT genintval (dCSRmat  *A,
                         INT     **itmat,
@@ -615,23 +616,17 @@ static SHORT genintval (dCSRmat  *A,
 #endif
     for (i=0;i<tniz;++i) izt[mat[0][i]]++;
     
-    T.IA=(INT*)fasp_mem_calloc((nf+1),sizeof(INT));
+    // create T with all fields set, so fasp_dcsr_free is safe at the end
+    T=fasp_dcsr_create(nf,nf,tniz);
     
-    T.row=nf;
-    T.col=nf;
-    T.nnz=tniz;
     T.IA[0]=0;
     for (i=1;i<nf+1;++i) T.IA[i]=T.IA[i-1]+izt[i-1];
     
-    T.JA=(INT*)fasp_mem_calloc(tniz,sizeof(INT));
-    
 #ifdef _OPENMP
 #pragma omp parallel for if(tniz>OPENMP_HOLDS) private(j)
 #endif
     for (j=0;j<tniz;++j) T.JA[j]=mat[1][j];
     
-    T.val=(REAL*)fasp_mem_calloc(tniz,sizeof(REAL));
-    
 #ifdef _OPENMP
 #pragma omp parallel for if(tniz>OPENMP_HOLDS) private(j)
 #endif
@@ -48,6 +48,9 @@
  * Modified by Xiaozhe Hu on 04/24/2013: aggressive coarsening.
  * Modified by Chensong Zhang on 09/23/2014: check coarse spaces.
  * Modified by Chensong Zhang on 08/28/2022: min_cdof from SHORT to INT.
+ * Modified by agent on 10/18/2026: dense coarse LU, implicit restriction,
+ *                                  sparsification, complexity budget, threads and
+ *                                  smoother data on each level
  */
 SHORT fasp_amg_setup_rs (AMG_data   *mgl,
                          AMG_param  *param)
@@ -55,10 +58,11 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
     const SHORT prtlvl     = param->print_level;
     const SHORT cycle_type = param->cycle_type;
     const SHORT csolver    = param->coarse_solver;
-    const INT   min_cdof   = MAX(param->coarse_dof,MIN_CDOF);
+    const INT   min_cdof   = MAX(fasp_amg_coarse_dof(&mgl[0].A,param),MIN_CDOF);
     const INT   m          = mgl[0].A.row;
 
     // local variables
+    const AMG_param param0 = *param; // parameters before budget adjustments
     SHORT      status = FASP_SUCCESS;
     INT        lvl = 0, max_lvls = param->max_levels;
     REAL       setup_start, setup_end;
@@ -104,6 +108,10 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         iluparam.ILU_droptol = param->ILU_droptol;
         iluparam.ILU_relax   = param->ILU_relax;
         iluparam.ILU_type    = param->ILU_type;
+        iluparam.ILU_jacobi_sweeps = 0; // exact solves in ILU smoothers
+        iluparam.ILU_fp_sweeps     = 0; // sequential ILUk factorization
+        iluparam.ILU_reorder       = ILU_ORDER_NONE; // natural ordering
+        iluparam.ILU_split         = 0; // MSR factors only
     }
 
     // Initialize Schwarz parameters
@@ -158,6 +166,20 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         status = fasp_amg_coarsening_rs(&mgl[lvl].A, &vertices, &mgl[lvl].P,
 		                                &Scouple, param);
 
+        // Aggressive coarsening switched on by the budget but too aggressive
+        if ( status >= 0 && param->coarsening_type == COARSE_AC &&
+             param0.coarsening_type != COARSE_AC &&
+             mgl[lvl].P.row > mgl[lvl].P.col * 10.0 ) {
+            if ( prtlvl > PRINT_NONE )
+                printf("Budget level %2d: aggressive coarsening discarded\n", lvl);
+            fasp_mem_free(Scouple.IA); Scouple.IA = NULL;
+            fasp_mem_free(Scouple.JA); Scouple.JA = NULL;
+            fasp_dcsr_free(&mgl[lvl].P);
+            param->coarsening_type = COARSE_RS;
+            status = fasp_amg_coarsening_rs(&mgl[lvl].A, &vertices, &mgl[lvl].P,
+                                            &Scouple, param);
+        }
+
         // Check 1: Did coarsening step succeeded?
         if ( status < 0 ) {
             /*-- Clean up Scouple generated in coarsening --*/
@@ -209,9 +231,19 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         fasp_amg_interp(&mgl[lvl].A, &vertices, &mgl[lvl].P, &Scouple, param);
 
         /*-- Form coarse level matrix: two RAP routines available! --*/
-        fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+        if ( param->implicit_restriction == ON ) {
+            // R = P' is never formed; only its pattern is kept for the solve phase
+            fasp_dcsr_trans_map(&mgl[lvl].P, &mgl[lvl].Rmap);
+            fasp_blas_dcsr_ptap_map(&mgl[lvl].Rmap, &mgl[lvl].A, &mgl[lvl].P,
+                                    &mgl[lvl+1].A);
+        }
+        else {
+            fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+            fasp_blas_dcsr_rap(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl+1].A);
+        }
 
-        fasp_blas_dcsr_rap(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl+1].A);
+        // Drop small entries of the coarse matrix if required
+        fasp_amg_coarse_sparsify(&mgl[lvl+1].A, lvl+1, param);
 
         // ##DEBUG: check value of interpolation matrix with rdc-amg
         // fasp_dcsr_print(&mgl[lvl+1].A);
@@ -267,9 +299,14 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
 
             break;
         }
-        
+
+        // Check 5: Is the complexity budget used up?
+        if ( fasp_amg_budget_check(mgl, lvl, param) ) break;
+
     } // end of the main while loop
 
+    fasp_amg_budget_reset(param, &param0);
+
     // Setup coarse level systems for direct solvers
     switch (csolver) {
 
@@ -306,6 +343,12 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
          }
 #endif
 
+        case SOLVER_DEFAULT: {
+            // Factorize the coarsest matrix with the built-in dense solver
+            fasp_amg_coarse_dense_setup(&mgl[lvl], prtlvl);
+            break;
+        }
+
         default:
             // Do nothing!
             break;
@@ -349,6 +392,7 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
 #else
         dCSRmat_Multicoloring_Theta(&mgl[lvl].A, mgl[lvl].GS_Theta, &rowmax, &Colors);
 #endif
+
         if ( prtlvl > 1 )	
             printf("mgl[%3d].A.row = %12d, rowmax = %5d, rowavg = %7.2lf, colors = %5d, Theta = %le.\n",
             lvl, mgl[lvl].A.row, rowmax, (double)mgl[lvl].A.nnz/mgl[lvl].A.row,
@@ -356,6 +400,18 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
     }
 #endif
 
+    // number of OpenMP threads on each level
+    fasp_amg_level_threads(mgl, param);
+
+    // eigenvalue bounds for Chebyshev smoother
+    fasp_amg_cheby_setup(mgl, param);
+
+    // diagonal block ILU factors for block-Jacobi ILU smoother
+    fasp_amg_bjilu_setup(mgl, param);
+
+    // AMLI polynomial on each level from spectral estimates
+    fasp_amg_amli_coef_setup(mgl, param);
+
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity(mgl, prtlvl);
@@ -34,11 +34,14 @@
 /*---------------------------------*/
 
 #include "PreAMGAggregation.inl"
+#include "PreAMGAggregationMIS.inl"
 #include "PreAMGAggregationCSR.inl"
 
 static SHORT amg_setup_smoothP_smoothR (AMG_data *, AMG_param *);
 static SHORT amg_setup_smoothP_unsmoothR (AMG_data *, AMG_param *);
 static void smooth_agg (dCSRmat *, dCSRmat *, dCSRmat *, AMG_param *, dCSRmat *);
+static void smooth_agg_jacobi (const dCSRmat *, const REAL *, const REAL,
+                               const dCSRmat *, dCSRmat *);
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -111,6 +114,7 @@ SHORT fasp_amg_setup_sa (AMG_data   *mgl,
  *
  * Modified by Chensong on 04/29/2014: Fix a sign problem
  * Modified by Chensong on 09/21/2017: Remove some OMP pragma
+ * Modified by agent on 10/18/2026: fuse smoother and product
  */
 static void smooth_agg (dCSRmat    *A,
                         dCSRmat    *tentp,
@@ -119,57 +123,19 @@ static void smooth_agg (dCSRmat    *A,
                         dCSRmat    *N)
 {
     const SHORT filter = param->smooth_filter;
-    const INT   row = A->row, col= A->col;
+    const INT   row = A->row;
     const REAL  smooth_factor = param->tentative_smooth;
 
-    dCSRmat S;
-    dvector diag;  // diagonal entries
+    dCSRmat *B = A; // matrix used in the damped Jacobi smoother
+    dvector diag;   // diagonal entries
 
     REAL row_sum_A, row_sum_N;
     INT i,j;
 
     /* Step 1. Form smoother */
 
-    /* Without filter: Using A for damped Jacobian smoother */
-    if ( filter != ON ) {
-
-        // copy structure from A
-        S = fasp_dcsr_create(row, col, A->IA[row]);
-
-#ifdef _OPENMP
-#pragma omp parallel for if(row>OPENMP_HOLDS)
-#endif
-        for ( i=0; i<=row; ++i ) S.IA[i] = A->IA[i];
-        for ( i=0; i<S.IA[S.row]; ++i ) S.JA[i] = A->JA[i];
-
-        fasp_dcsr_getdiag(0, A, &diag);  // get the diagonal entries of A
-
-        // check the diagonal entries.
-        // if it is too small, use Richardson smoother for the corresponding row
-#ifdef _OPENMP
-#pragma omp parallel for if(row>OPENMP_HOLDS)
-#endif
-        for (i=0; i<row; ++i) {
-            if (ABS(diag.val[i]) < 1e-6) diag.val[i] = 1.0;
-        }
-
-#ifdef _OPENMP
-#pragma omp parallel for if(row>OPENMP_HOLDS) private(j)
-#endif
-        for (i=0; i<row; ++i) {
-            for (j=S.IA[i]; j<S.IA[i+1]; ++j) {
-                if (S.JA[j] == i) {
-                    S.val[j] = 1 - smooth_factor * A->val[j] / diag.val[i];
-                }
-                else {
-                    S.val[j] = - smooth_factor * A->val[j] / diag.val[i];
-                }
-            }
-        }
-    }
-
     /* Using filtered A for damped Jacobian smoother */
-    else {
+    if ( filter == ON ) {
         /* Form filtered A and store in N */
 #ifdef _OPENMP
 #pragma omp parallel for private(j, row_sum_A, row_sum_N) if (row>OPENMP_HOLDS)
@@ -191,49 +157,144 @@ static void smooth_agg (dCSRmat    *A,
             }
         }
 
-        // copy structure from N (filtered A)
-        S = fasp_dcsr_create(row, col, N->IA[row]);
+        B = N;
+    }
+
+    fasp_dcsr_getdiag(0, B, &diag);  // get the diagonal entries of A or filtered A
 
+    // check the diagonal entries.
+    // if it is too small, use Richardson smoother for the corresponding row
 #ifdef _OPENMP
 #pragma omp parallel for if(row>OPENMP_HOLDS)
 #endif
-        for (i=0; i<=row; ++i) S.IA[i] = N->IA[i];
+    for (i=0; i<row; ++i) {
+        if (ABS(diag.val[i]) < 1e-6) diag.val[i] = 1.0;
+    }
 
-        for (i=0; i<S.IA[S.row]; ++i) S.JA[i] = N->JA[i];
+    /* Step 2. Smooth the tentative prolongation P = (I - w*D^{-1}*B)*tentp */
+    smooth_agg_jacobi(B, diag.val, smooth_factor, tentp, P);
 
-        fasp_dcsr_getdiag(0, N, &diag);  // get the diagonal entries of N (filtered A)
+    fasp_dvec_free(&diag);
+}
+
+/**
+ * \fn static void smooth_agg_jacobi (const dCSRmat *A, const REAL *diag,
+ *                                    const REAL omega, const dCSRmat *tentp,
+ *                                    dCSRmat *P)
+ *
+ * \brief Damped Jacobi smoothing of the tentative prolongation
+ *
+ * \param A         Pointer to the (filtered) coefficient matrix
+ * \param diag      Pointer to the diagonal used by the Jacobi smoother
+ * \param omega     Damping factor
+ * \param tentp     Pointer to the tentative prolongation
+ * \param P         Pointer to the smoothed prolongation: (I - omega*D^{-1}*A)*tentp
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The smoother is never formed: the product is computed row by row, and
+ *       rows of P are split among threads with a marker array for each thread.
+ */
+static void smooth_agg_jacobi (const dCSRmat  *A,
+                               const REAL     *diag,
+                               const REAL      omega,
+                               const dCSRmat  *tentp,
+                               dCSRmat        *P)
+{
+    const INT   row = A->row, col = tentp->col;
+    const INT  *ia = A->IA, *ja = A->JA, *tia = tentp->IA, *tja = tentp->JA;
+    const REAL *aj = A->val, *tval = tentp->val;
+
+    INT  i, j, k, l, c, cnt, start, myid, mybegin, myend;
+    INT  nthreads = 1;
+    REAL factor;
 
-        // check the diagonal entries.
-        // if it is too small, use Richardson smoother for the corresponding row
 #ifdef _OPENMP
-#pragma omp parallel for if(row>OPENMP_HOLDS)
+    SHORT use_openmp = FALSE;
+    if ( row > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads   = fasp_get_num_threads();
+    }
 #endif
-        for (i=0;i<row;++i) {
-            if (ABS(diag.val[i]) < 1e-6) diag.val[i] = 1.0;
+
+    INT *marker = (INT *)fasp_mem_calloc(nthreads*col, sizeof(INT));
+
+    P->row = row;
+    P->col = col;
+    P->IA  = (INT *)fasp_mem_calloc(row+1, sizeof(INT));
+
+    // Step 1. Count nonzeros in each row of P
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k, l, c, cnt) if (use_openmp)
+#endif
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        INT *mark = marker + myid*col;
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        fasp_iarray_set(col, mark, -1);
+        for ( i = mybegin; i < myend; i++ ) {
+            cnt = 0;
+            for ( l = tia[i]; l < tia[i+1]; l++ ) {
+                c = tja[l];
+                if ( mark[c] != i ) { mark[c] = i; cnt++; }
+            }
+            for ( j = ia[i]; j < ia[i+1]; j++ ) {
+                k = ja[j];
+                for ( l = tia[k]; l < tia[k+1]; l++ ) {
+                    c = tja[l];
+                    if ( mark[c] != i ) { mark[c] = i; cnt++; }
+                }
+            }
+            P->IA[i+1] = cnt;
         }
+    }
+
+    for ( i = 0; i < row; i++ ) P->IA[i+1] += P->IA[i];
 
+    P->nnz = P->IA[row];
+    P->JA  = (INT *)fasp_mem_calloc(P->nnz, sizeof(INT));
+    P->val = (REAL *)fasp_mem_calloc(P->nnz, sizeof(REAL));
+
+    // Step 2. Compute P = tentp - omega*D^{-1}*A*tentp
 #ifdef _OPENMP
-#pragma omp parallel for if(row>OPENMP_HOLDS) private(i,j)
+#pragma omp parallel for private(myid, mybegin, myend, i, j, k, l, c, cnt, start, factor) if (use_openmp)
 #endif
-        for (i=0;i<row;++i) {
-            for (j=S.IA[i]; j<S.IA[i+1]; ++j) {
-                if (S.JA[j] == i) {
-                    S.val[j] = 1 - smooth_factor * N->val[j] / diag.val[i];
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        INT *mark = marker + myid*col;
+        fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+        fasp_iarray_set(col, mark, -1);
+        for ( i = mybegin; i < myend; i++ ) {
+            start = cnt = P->IA[i];
+            for ( l = tia[i]; l < tia[i+1]; l++ ) {
+                c = tja[l];
+                if ( mark[c] < start ) {
+                    mark[c] = cnt;
+                    P->JA[cnt] = c;
+                    P->val[cnt++] = tval[l];
                 }
                 else {
-                    S.val[j] = - smooth_factor * N->val[j] / diag.val[i];
+                    P->val[mark[c]] += tval[l];
+                }
+            }
+            factor = omega / diag[i];
+            for ( j = ia[i]; j < ia[i+1]; j++ ) {
+                k = ja[j];
+                for ( l = tia[k]; l < tia[k+1]; l++ ) {
+                    c = tja[l];
+                    if ( mark[c] < start ) {
+                        mark[c] = cnt;
+                        P->JA[cnt] = c;
+                        P->val[cnt++] = -factor * aj[j] * tval[l];
+                    }
+                    else {
+                        P->val[mark[c]] -= factor * aj[j] * tval[l];
+                    }
                 }
             }
         }
-
     }
 
-    fasp_dvec_free(&diag);
-
-    /* Step 2. Smooth the tentative prolongation P = S*tenp */
-    fasp_blas_dcsr_mxm(&S, tentp, P); // Note: think twice about this.
-    P->nnz = P->IA[P->row];
-    fasp_dcsr_free(&S);
+    fasp_mem_free(marker); marker = NULL;
 }
 
 /**
@@ -250,6 +311,10 @@ static void smooth_agg (dCSRmat    *A,
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
  * Modified by Chensong Zhang on 07/26/2014: handle coarsening errors.
  * Modified by Chensong Zhang on 09/23/2014: check coarse spaces.
+ * Modified by agent on 10/18/2026: parallel tentative P, MIS-2 aggregation,
+ *                                  dense coarse LU, implicit restriction,
+ *                                  sparsification, complexity budget, threads
+ *                                  and smoother data on each level
  */
 static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
                                         AMG_param  *param)
@@ -257,10 +322,11 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
     const SHORT prtlvl     = param->print_level;
     const SHORT cycle_type = param->cycle_type;
     const SHORT csolver    = param->coarse_solver;
-    const SHORT min_cdof   = MAX(param->coarse_dof,50);
+    const INT   min_cdof   = MAX(fasp_amg_coarse_dof(&mgl[0].A,param),50);
     const INT   m          = mgl[0].A.row;
 
     // local variables
+    const AMG_param param0 = *param; // parameters before budget adjustments
     SHORT       max_levels = param->max_levels, lvl = 0, status = FASP_SUCCESS;
     INT         i, j;
     REAL        setup_start, setup_end;
@@ -296,6 +362,9 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         for ( j = 0; j < m; ++j ) mgl[0].near_kernel_basis[i][j] = 1.0;
     }
 
+    // near kernel on the current and the next coarse levels
+    REAL *basis = mgl[0].near_kernel_basis[0], *cbasis = NULL;
+
     // Initialize ILU parameters
     mgl->ILU_levels = param->ILU_levels;
     if ( param->ILU_levels > 0 ) {
@@ -304,6 +373,10 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         iluparam.ILU_droptol = param->ILU_droptol;
         iluparam.ILU_relax   = param->ILU_relax;
         iluparam.ILU_type    = param->ILU_type;
+        iluparam.ILU_jacobi_sweeps = 0; // exact solves in ILU smoothers
+        iluparam.ILU_fp_sweeps     = 0; // sequential ILUk factorization
+        iluparam.ILU_reorder       = ILU_ORDER_NONE; // natural ordering
+        iluparam.ILU_split         = 0; // MSR factors only
     }
 
     // Initialize Schwarz parameters
@@ -368,8 +441,12 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         }
 
         /*-- Aggregation --*/
-        status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
-                                 &Neighbor[lvl], &num_aggs[lvl]);
+        if ( param->aggregation_type == MIS2 )
+            status = aggregation_mis2(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                      &Neighbor[lvl], &num_aggs[lvl]);
+        else
+            status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                     &Neighbor[lvl], &num_aggs[lvl]);
 
         // Check 1: Did coarsening step succeed?
         if ( status < 0 ) {
@@ -384,8 +461,8 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         }
 
         /* -- Form Tentative prolongation --*/
-        form_tentative_p(&vertices[lvl], &tentp[lvl], mgl[0].near_kernel_basis,
-                         num_aggs[lvl]);
+        cbasis = (REAL *)fasp_mem_calloc(num_aggs[lvl], sizeof(REAL));
+        form_tentative_p(&vertices[lvl], &tentp[lvl], basis, cbasis, num_aggs[lvl]);
 
         /* -- Form smoothed prolongation -- */
         smooth_agg(&mgl[lvl].A, &tentp[lvl], &mgl[lvl].P, param, &Neighbor[lvl]);
@@ -411,16 +488,28 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
             break;
         }
 
-        /*-- Form restriction --*/
-        fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+        /*-- Form restriction and coarse level stiffness matrix --*/
+        if ( param->implicit_restriction == ON ) {
+            // R = P' is never formed; only its pattern is kept for the solve phase
+            fasp_dcsr_trans_map(&mgl[lvl].P, &mgl[lvl].Rmap);
+            fasp_blas_dcsr_ptap_map(&mgl[lvl].Rmap, &mgl[lvl].A, &mgl[lvl].P,
+                                    &mgl[lvl+1].A);
+        }
+        else {
+            fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+            fasp_blas_dcsr_rap(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl+1].A);
+        }
 
-        /*-- Form coarse level stiffness matrix --*/
-        fasp_blas_dcsr_rap(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl+1].A);
+        // Drop small entries of the coarse matrix if required
+        fasp_amg_coarse_sparsify(&mgl[lvl+1].A, lvl+1, param);
 
         fasp_dcsr_free(&Neighbor[lvl]);
         fasp_dcsr_free(&tentp[lvl]);
         fasp_ivec_free(&vertices[lvl]);
 
+        if ( basis != mgl[0].near_kernel_basis[0] ) fasp_mem_free(basis);
+        basis = cbasis; cbasis = NULL;
+
         ++lvl;
 
 #if DIAGONAL_PREF
@@ -439,8 +528,16 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
             break;
         }
 
+        // Check 5: Is the complexity budget used up?
+        if ( fasp_amg_budget_check(mgl, lvl, param) ) break;
+
     } // end of the main while loop
 
+    fasp_amg_budget_reset(param, &param0);
+
+    if ( basis != mgl[0].near_kernel_basis[0] ) fasp_mem_free(basis);
+    fasp_mem_free(cbasis); basis = cbasis = NULL;
+
     // Setup coarse level systems for direct solvers
     switch (csolver) {
 
@@ -477,6 +574,12 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
          }
 #endif
 
+        case SOLVER_DEFAULT: {
+            // Factorize the coarsest matrix with the built-in dense solver
+            fasp_amg_coarse_dense_setup(&mgl[lvl], prtlvl);
+            break;
+        }
+
         default:
             // Do nothing!
             break;
@@ -516,6 +619,7 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
 #else
         dCSRmat_Multicoloring_Theta(&mgl[lvl].A, mgl[lvl].GS_Theta, &rowmax, &Colors);
 #endif
+
         if ( prtlvl > 1 )	
             printf("mgl[%3d].A.row = %12d, rowmax = %5d, rowavg = %7.2lf, colors = %5d, Theta = %le.\n",
             lvl, mgl[lvl].A.row, rowmax, (double)mgl[lvl].A.nnz/mgl[lvl].A.row,
@@ -523,6 +627,18 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
     }
 #endif
 
+    // number of OpenMP threads on each level
+    fasp_amg_level_threads(mgl, param);
+
+    // eigenvalue bounds for Chebyshev smoother
+    fasp_amg_cheby_setup(mgl, param);
+
+    // diagonal block ILU factors for block-Jacobi ILU smoother
+    fasp_amg_bjilu_setup(mgl, param);
+
+    // AMLI polynomial on each level from spectral estimates
+    fasp_amg_amli_coef_setup(mgl, param);
+
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity(mgl,prtlvl);
@@ -555,6 +671,9 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
  * Modified by Chensong Zhang on 07/26/2014: handle coarsening errors.
  * Modified by Chensong Zhang on 09/23/2014: check coarse spaces.
+ * Modified by agent on 10/18/2026: MIS-2 aggregation, dense coarse LU, implicit
+ *                                  restriction, sparsification, complexity
+ *                                  budget, threads and smoother data on each level
  */
 static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
                                           AMG_param  *param)
@@ -562,10 +681,11 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
     const SHORT prtlvl     = param->print_level;
     const SHORT cycle_type = param->cycle_type;
     const SHORT csolver    = param->coarse_solver;
-    const SHORT min_cdof   = MAX(param->coarse_dof,50);
+    const INT   min_cdof   = MAX(fasp_amg_coarse_dof(&mgl[0].A,param),50);
     const INT   m          = mgl[0].A.row;
 
     // local variables
+    const AMG_param param0 = *param; // parameters before budget adjustments
     SHORT       max_levels = param->max_levels, lvl = 0, status = FASP_SUCCESS;
     INT         i, j;
     REAL        setup_start, setup_end;
@@ -609,6 +729,10 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         iluparam.ILU_droptol = param->ILU_droptol;
         iluparam.ILU_relax   = param->ILU_relax;
         iluparam.ILU_type    = param->ILU_type;
+        iluparam.ILU_jacobi_sweeps = 0; // exact solves in ILU smoothers
+        iluparam.ILU_fp_sweeps     = 0; // sequential ILUk factorization
+        iluparam.ILU_reorder       = ILU_ORDER_NONE; // natural ordering
+        iluparam.ILU_split         = 0; // MSR factors only
     }
 
     // Initialize Schwarz parameters
@@ -658,8 +782,12 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         }
 
         /*-- Aggregation --*/
-        status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
-                                 &Neighbor[lvl], &num_aggs[lvl]);
+        if ( param->aggregation_type == MIS2 )
+            status = aggregation_mis2(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                      &Neighbor[lvl], &num_aggs[lvl]);
+        else
+            status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                     &Neighbor[lvl], &num_aggs[lvl]);
 
         // Check 1: Did coarsening step succeeded?
         if ( status < 0 ) {
@@ -671,8 +799,8 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         }
 
         /* -- Form Tentative prolongation --*/
-        form_tentative_p(&vertices[lvl], &tentp[lvl], mgl[0].near_kernel_basis,
-                         num_aggs[lvl]);
+        form_tentative_p(&vertices[lvl], &tentp[lvl], mgl[0].near_kernel_basis[0],
+                         NULL, num_aggs[lvl]);
 
         /* -- Form smoothed prolongation -- */
         smooth_agg(&mgl[lvl].A, &tentp[lvl], &mgl[lvl].P, param, &Neighbor[lvl]);
@@ -700,20 +828,31 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
             break;
         }
 
-        /*-- Form restriction --*/
-        fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+        /*-- Form restriction (unless R = P' is applied on the fly) --*/
+        if ( param->implicit_restriction != ON )
+            fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+        else
+            fasp_dcsr_trans_map(&mgl[lvl].P, &mgl[lvl].Rmap);
         fasp_dcsr_trans(&tentp[lvl], &tentr[lvl]);
 
         /*-- Form coarse level stiffness matrix --*/
         fasp_blas_dcsr_rap_agg(&tentr[lvl], &mgl[lvl].A, &tentp[lvl], &mgl[lvl+1].A);
 
+        // Drop small entries of the coarse matrix if required
+        fasp_amg_coarse_sparsify(&mgl[lvl+1].A, lvl+1, param);
+
         fasp_dcsr_free(&Neighbor[lvl]);
         fasp_dcsr_free(&tentp[lvl]);
         fasp_ivec_free(&vertices[lvl]);
 
         ++lvl;
+
+        // Check 5: Is the complexity budget used up?
+        if ( fasp_amg_budget_check(mgl, lvl, param) ) break;
     }
 
+    fasp_amg_budget_reset(param, &param0);
+
     // Setup coarse level systems for direct solvers
     switch (csolver) {
 
@@ -750,6 +889,12 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
          }
 #endif
 
+        case SOLVER_DEFAULT: {
+            // Factorize the coarsest matrix with the built-in dense solver
+            fasp_amg_coarse_dense_setup(&mgl[lvl], prtlvl);
+            break;
+        }
+
         default:
             // Do nothing!
             break;
@@ -789,6 +934,7 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
 #else
         dCSRmat_Multicoloring_Theta(&mgl[lvl].A, mgl[lvl].GS_Theta, &rowmax, &Colors);
 #endif
+
         if ( prtlvl > 1 )	
             printf("mgl[%3d].A.row = %12d, rowmax = %5d, rowavg = %7.2lf, colors = %5d, Theta = %le.\n",
             lvl, mgl[lvl].A.row, rowmax, (double)mgl[lvl].A.nnz/mgl[lvl].A.row,
@@ -796,6 +942,18 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
     }
 #endif
 
+    // number of OpenMP threads on each level
+    fasp_amg_level_threads(mgl, param);
+
+    // eigenvalue bounds for Chebyshev smoother
+    fasp_amg_cheby_setup(mgl, param);
+
+    // diagonal block ILU factors for block-Jacobi ILU smoother
+    fasp_amg_bjilu_setup(mgl, param);
+
+    // AMLI polynomial on each level from spectral estimates
+    fasp_amg_amli_coef_setup(mgl, param);
+
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity(mgl,prtlvl);
@@ -173,6 +173,7 @@ static void smooth_agg_bsr (const dBSRmat    *A,
  * \author Xiaozhe Hu
  * \date   05/26/2014
  *
+ * Modified by agent on 10/18/2026: setup Chebyshev smoother
  */
 static SHORT amg_setup_smoothP_smoothR_bsr (AMG_data_bsr *mgl,
                                             AMG_param *param)
@@ -242,6 +243,10 @@ static SHORT amg_setup_smoothP_smoothR_bsr (AMG_data_bsr *mgl,
         iluparam.ILU_droptol = param->ILU_droptol;
         iluparam.ILU_relax   = param->ILU_relax;
         iluparam.ILU_type    = param->ILU_type;
+        iluparam.ILU_jacobi_sweeps = 0; // exact solves in ILU smoothers
+        iluparam.ILU_fp_sweeps     = 0; // sequential ILUk factorization
+        iluparam.ILU_reorder       = ILU_ORDER_NONE; // natural ordering
+        iluparam.ILU_split         = 0; // MSR factors only
     }
 
     /*----------------------------*/
@@ -438,6 +443,9 @@ static SHORT amg_setup_smoothP_smoothR_bsr (AMG_data_bsr *mgl,
 
     }
 
+    // eigenvalue bounds for Chebyshev smoother
+    fasp_amg_cheby_setup_bsr(mgl, param);
+
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity_bsr(mgl,prtlvl);
@@ -30,7 +30,7 @@
 /*---------------------------------*/
 
 #include "PreAMGAggregation.inl"
-#include "PreAMGAggregationCSR.inl"
+#include "PreAMGAggregationMIS.inl"
 #include "PreAMGAggregationUA.inl"
 
 static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data*, AMG_param*);
@@ -97,13 +97,16 @@ SHORT fasp_amg_setup_ua(AMG_data* mgl, AMG_param* param)
  * Modified by Zheng Li on 03/22/2015: adjust coarsening ratio.
  * Modified by Chunsheng Feng on 10/17/2020: if NPAIR fail auto switch aggregation type
  * to VBM.
+ * Modified by agent on 10/18/2026: MIS-2 aggregation, dense coarse LU, implicit
+ *                                  restriction, aggregate maps, threads and
+ *                                  smoother data on each level
  */
 static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
 {
     const SHORT prtlvl     = param->print_level;
     const SHORT cycle_type = param->cycle_type;
     const SHORT csolver    = param->coarse_solver;
-    const SHORT min_cdof   = MAX(param->coarse_dof, 50);
+    const INT   min_cdof   = MAX(fasp_amg_coarse_dof(&mgl[0].A, param), 50);
     const INT   m          = mgl[0].A.row;
 
     // empiric value
@@ -156,6 +159,10 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
         iluparam.ILU_droptol = param->ILU_droptol;
         iluparam.ILU_relax   = param->ILU_relax;
         iluparam.ILU_type    = param->ILU_type;
+        iluparam.ILU_jacobi_sweeps = 0; // exact solves in ILU smoothers
+        iluparam.ILU_fp_sweeps     = 0; // sequential ILUk factorization
+        iluparam.ILU_reorder       = ILU_ORDER_NONE; // natural ordering
+        iluparam.ILU_split         = 0; // MSR factors only
     }
 
     // Initialize Schwarz parameters
@@ -239,6 +246,13 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
 
                 break;
 
+            case MIS2: // distance-2 MIS aggregation
+
+                status = aggregation_mis2(&mgl[lvl].A, &vertices[lvl], param, lvl + 1,
+                                          &Neighbor[lvl], &num_aggs[lvl]);
+
+                break;
+
             case NPAIR: // non-symmetric pairwise matching aggregation
                 status =
                     aggregation_nsympair(mgl, param, lvl, vertices, &num_aggs[lvl]);
@@ -276,37 +290,36 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
             break;
         }
 
-        /*-- Form Prolongation --*/
-        form_tentative_p(&vertices[lvl], &mgl[lvl].P, mgl[0].near_kernel_basis,
-                         num_aggs[lvl]);
-
         // Check 2: Is coarse sparse too small?
-        if (mgl[lvl].P.col < MIN_CDOF) {
+        if (num_aggs[lvl] < MIN_CDOF) {
             fasp_ivec_free(&vertices[lvl]);
             fasp_dcsr_free(&Neighbor[lvl]);
             break;
         }
 
         // Check 3: Does this coarsening step too aggressive?
-        if (mgl[lvl].P.row > mgl[lvl].P.col * MAX_CRATE) {
+        if (mgl[lvl].A.row > num_aggs[lvl] * MAX_CRATE) {
             if (prtlvl > PRINT_MIN) {
                 printf("### WARNING: Coarsening might be too aggressive!\n");
                 printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
-                       mgl[lvl].P.row, mgl[lvl].P.col);
+                       mgl[lvl].A.row, num_aggs[lvl]);
             }
             fasp_ivec_free(&vertices[lvl]);
             fasp_dcsr_free(&Neighbor[lvl]);
             break;
         }
 
-        /*-- Form restriction --*/
-        fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
+        /*-- Keep the aggregates and their nodes as P and R: no need to form them --*/
+        mgl[lvl].aggmap     = vertices[lvl];
+        vertices[lvl].row   = 0;
+        vertices[lvl].val   = NULL;
+        fasp_aggmap_trans(&mgl[lvl].aggmap, num_aggs[lvl], &mgl[lvl].Rmap);
 
         /*-- Form coarse level stiffness matrix --*/
-        fasp_blas_dcsr_rap_agg(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl + 1].A);
+        fasp_blas_dcsr_rap_aggmap(&mgl[lvl].A, &mgl[lvl].aggmap, &mgl[lvl].Rmap,
+                                  &mgl[lvl + 1].A);
 
         fasp_dcsr_free(&Neighbor[lvl]);
-        fasp_ivec_free(&vertices[lvl]);
 
         ++lvl;
 
@@ -316,7 +329,7 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
 #endif
 
         // Check 4: Is this coarsening ratio too small?
-        if ((REAL)mgl[lvl].P.col > mgl[lvl].P.row * MIN_CRATE) {
+        if ((REAL)num_aggs[lvl - 1] > mgl[lvl - 1].A.row * MIN_CRATE) {
             param->quality_bound *= 2.0;
         }
 
@@ -363,6 +376,13 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
             }
 #endif
 
+        case SOLVER_DEFAULT:
+            {
+                // Factorize the coarsest matrix with the built-in dense solver
+                fasp_amg_coarse_dense_setup(&mgl[lvl], prtlvl);
+                break;
+            }
+
         default: // Do nothing!
             break;
     }
@@ -416,6 +436,7 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
 #else
         dCSRmat_Multicoloring_Theta(&mgl[lvl].A, mgl[lvl].GS_Theta, &rowmax, &Colors);
 #endif
+
         if (prtlvl > 1)
             printf("mgl[%3d].A.row = %12d, rowmax = %5d, rowavg = %7.2lf, colors = "
                    "%5d, Theta = %le.\n",
@@ -424,6 +445,18 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data* mgl, AMG_param* param)
     }
 #endif
 
+    // number of OpenMP threads on each level
+    fasp_amg_level_threads(mgl, param);
+
+    // eigenvalue bounds for Chebyshev smoother
+    fasp_amg_cheby_setup(mgl, param);
+
+    // diagonal block ILU factors for block-Jacobi ILU smoother
+    fasp_amg_bjilu_setup(mgl, param);
+
+    // AMLI polynomial on each level from spectral estimates
+    fasp_amg_amli_coef_setup(mgl, param);
+
     if (prtlvl > PRINT_NONE) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity(mgl, prtlvl);
@@ -87,6 +87,7 @@ SHORT fasp_amg_setup_ua_bsr(AMG_data_bsr* mgl, AMG_param* param)
  * \date   03/16/2012
  *
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
+ * Modified by agent on 10/18/2026: setup Chebyshev smoother
  */
 static SHORT amg_setup_unsmoothP_unsmoothR_bsr(AMG_data_bsr* mgl, AMG_param* param)
 {
@@ -155,6 +156,10 @@ static SHORT amg_setup_unsmoothP_unsmoothR_bsr(AMG_data_bsr* mgl, AMG_param* par
         iluparam.ILU_droptol = param->ILU_droptol;
         iluparam.ILU_relax   = param->ILU_relax;
         iluparam.ILU_type    = param->ILU_type;
+        iluparam.ILU_jacobi_sweeps = 0; // exact solves in ILU smoothers
+        iluparam.ILU_fp_sweeps     = 0; // sequential ILUk factorization
+        iluparam.ILU_reorder       = ILU_ORDER_NONE; // natural ordering
+        iluparam.ILU_split         = 0; // MSR factors only
     }
 
     /*----------------------------*/
@@ -362,6 +367,9 @@ static SHORT amg_setup_unsmoothP_unsmoothR_bsr(AMG_data_bsr* mgl, AMG_param* par
         }
     }
 
+    // eigenvalue bounds for Chebyshev smoother
+    fasp_amg_cheby_setup_bsr(mgl, param);
+
     if (prtlvl > PRINT_NONE) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity_bsr(mgl, prtlvl);
@@ -26,6 +26,8 @@
 
 #include "PreMGUtil.inl"
 
+static void precond_dbsr_ilu_jacobi(const ILU_data*, const REAL*, REAL*);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -343,6 +345,8 @@ void fasp_precond_dbsr_diag_nc7(REAL* r, REAL* z, void* data)
  * \date   11/09/2010
  *
  * \note Works for general nb (Xiaozhe)
+ *
+ * Modified by agent on 10/18/2026: Jacobi sweeps for triangular solves
  */
 void fasp_precond_dbsr_ilu(REAL* r, REAL* z, void* data)
 {
@@ -363,6 +367,11 @@ void fasp_precond_dbsr_ilu(REAL* r, REAL* z, void* data)
         fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
     }
 
+    if (iludata->jacobi_sweeps > 0) {
+        precond_dbsr_ilu_jacobi(iludata, r, z);
+        return;
+    }
+
     zz   = iludata->work;
     zr   = zz + size;
     mult = zr + size;
@@ -1328,6 +1337,94 @@ void fasp_precond_dbsr_namli(REAL* r, REAL* z, void* data)
     fasp_darray_cp(m, mgl->x.val, z);
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void precond_dbsr_ilu_jacobi (const ILU_data *iludata,
+ *                                          const REAL *r, REAL *z)
+ *
+ * \brief ILU preconditioner with Jacobi sweeps for the triangular solves
+ *
+ * \param iludata  Pointer to ILU_data of a dBSRmat matrix
+ * \param r        Pointer to the vector needs preconditioning
+ * \param z        Pointer to preconditioned vector
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note L*zz = r and U*z = zz are solved approximately by iludata->jacobi_sweeps
+ *       block Jacobi sweeps each, starting from the block diagonal solves. The
+ *       rows of a sweep are independent. Uses iludata->work[0:4*m*nb-1].
+ */
+static void precond_dbsr_ilu_jacobi(const ILU_data* iludata, const REAL* r, REAL* z)
+{
+    const INT   m = iludata->row, nb = iludata->nb, nb2 = nb * nb, size = m * nb;
+    const INT   nsweeps = iludata->jacobi_sweeps;
+    const INT*  ijlu    = iludata->ijlu;
+    const REAL* lu      = iludata->luval;
+
+    REAL* zz   = iludata->work;
+    REAL* zold = zz + size;
+    REAL* res  = zold + size;
+
+    INT i, j, jj, k;
+
+    if (iludata->nwork < 3 * size) {
+        printf("### ERROR: Need %d memory, only %d available!\n", 3 * size,
+               iludata->nwork);
+        fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
+    }
+
+    // L has unit diagonal blocks: start from zz = r
+    fasp_darray_cp(size, r, zz);
+
+    for (k = 0; k < nsweeps; ++k) {
+        fasp_darray_cp(size, zz, zold);
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS) private(i, j, jj)
+#endif
+        for (i = 0; i < m; ++i) {
+            fasp_darray_cp(nb, &(r[i * nb]), &(zz[i * nb]));
+            for (j = ijlu[i]; j < ijlu[i + 1]; ++j) {
+                jj = ijlu[j];
+                if (jj < i)
+                    fasp_blas_smat_ymAx(&(lu[j * nb2]), &(zold[jj * nb]),
+                                        &(zz[i * nb]), nb);
+                else
+                    break;
+            }
+        }
+    }
+
+    // diagonal blocks of U are stored inverted: start from z = D^{-1} zz
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS)
+#endif
+    for (i = 0; i < m; ++i)
+        fasp_blas_smat_mxv(&(lu[i * nb2]), &(zz[i * nb]), &(z[i * nb]), nb);
+
+    for (k = 0; k < nsweeps; ++k) {
+        fasp_darray_cp(size, z, zold);
+#ifdef _OPENMP
+#pragma omp parallel for if (m > OPENMP_HOLDS) private(i, j, jj)
+#endif
+        for (i = 0; i < m; ++i) {
+            fasp_darray_cp(nb, &(zz[i * nb]), &(res[i * nb]));
+            for (j = ijlu[i + 1] - 1; j >= ijlu[i]; --j) {
+                jj = ijlu[j];
+                if (jj > i)
+                    fasp_blas_smat_ymAx(&(lu[j * nb2]), &(zold[jj * nb]),
+                                        &(res[i * nb]), nb);
+                else
+                    break;
+            }
+            fasp_blas_smat_mxv(&(lu[i * nb2]), &(res[i * nb]), &(z[i * nb]), nb);
+        }
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -42,6 +42,8 @@
  *
  * \author Feiteng Huang
  * \date   05/18/2009
+ *
+ * Modified by agent on 10/18/2026: block-Jacobi ILU preconditioner
  */
 precond *fasp_precond_setup (const SHORT   precond_type,
                              AMG_param    *amgparam,
@@ -52,6 +54,7 @@ precond *fasp_precond_setup (const SHORT   precond_type,
     AMG_data         *mgl = NULL;
     precond_data  *pcdata = NULL;
     ILU_data         *ILU = NULL;
+    BJILU_data      *BJLU = NULL;
     dvector         *diag = NULL;
 
     INT           max_levels, nnz, m, n;
@@ -137,6 +140,16 @@ precond *fasp_precond_setup (const SHORT   precond_type,
             
         break;
             
+    case PREC_BJILU: // Block-Jacobi ILU preconditioner
+            
+        pc = (precond *)fasp_mem_calloc(1, sizeof(precond));
+        BJLU = (BJILU_data *)fasp_mem_calloc(1, sizeof(BJILU_data));
+        fasp_ilu_dcsr_setup_bj(A, BJLU, iluparam, 0);
+        pc->data = BJLU;
+        pc->fct = fasp_precond_bjilu;
+            
+        break;
+            
     case PREC_DIAG: // Diagonal preconditioner
             
         pc = (precond *)fasp_mem_calloc(1, sizeof(precond));
@@ -194,50 +207,39 @@ void fasp_precond_diag (REAL *r,
  *
  * \author Shiquan Zhang
  * \date   04/06/2010
+ *
+ * Modified by agent on 10/18/2026: level-scheduled solves of reordered ILU factors
  */
 void fasp_precond_ilu (REAL *r, 
                        REAL *z, 
                        void *data)
 {
     ILU_data *iludata=(ILU_data *)data;
-    const INT m=iludata->row, mm1=m-1, memneed=2*m;
-    REAL *zz, *zr;
+    const INT m=iludata->row, memneed=(iludata->perm==NULL)?2*m:3*m;
+    const INT *perm=iludata->perm;
+    REAL *zz, *zr, *zp;
+    INT i;
     
     if (iludata->nwork<memneed) goto MEMERR; // check this outside this subroutine!!
     
     zz = iludata->work; 
     zr = iludata->work+m;
-    fasp_darray_cp(m, r, zr);     
-    
-    {
-        INT i, j, jj, begin_row, end_row, mm2=m-2;
-        INT *ijlu=iludata->ijlu;
-        REAL *lu=iludata->luval;
     
+    if (perm==NULL) {
+        fasp_darray_cp(m, r, zr);
+        
         // forward sweep: solve unit lower matrix equation L*zz=zr
-        zz[0]=zr[0];
-
-        for (i=1;i<=mm1;++i) {
-            begin_row=ijlu[i]; end_row=ijlu[i+1]-1;
-            for (j=begin_row;j<=end_row;++j) {
-                jj=ijlu[j];
-                if (jj<i) zr[i]-=lu[j]*zz[jj];
-                else break;
-            }
-            zz[i]=zr[i]; 
-        }
-    
+        fasp_ilu_dcsr_lsolve(iludata, zr, zz);
+        
         // backward sweep: solve upper matrix equation U*z=zz
-        z[mm1]=zz[mm1]*lu[mm1];
-        for (i=mm2;i>=0;i--) {
-            begin_row=ijlu[i]; end_row=ijlu[i+1]-1;
-            for (j=end_row;j>=begin_row;j--) {
-                jj=ijlu[j];
-                if (jj>i) zz[i]-=lu[j]*z[jj];
-                else break;
-            } 
-            z[i]=zz[i]*lu[i];
-        }
+        fasp_ilu_dcsr_usolve(iludata, zz, z);
+    }
+    else { // LU = PAP': z = P'*inv(U)*inv(L)*P*r
+        zp = iludata->work+2*m;
+        for (i=0;i<m;++i) zr[i] = r[perm[i]];
+        fasp_ilu_dcsr_lsolve(iludata, zr, zz);
+        fasp_ilu_dcsr_usolve(iludata, zz, zp);
+        for (i=0;i<m;++i) z[perm[i]] = zp[i];
     }
     
     return;
@@ -259,40 +261,31 @@ MEMERR:
  *
  * \author Xiaozhe Hu, Shiquang Zhang
  * \date   04/06/2010
+ *
+ * Modified by agent on 10/18/2026: level-scheduled solves of reordered ILU factors
  */
 void fasp_precond_ilu_forward (REAL *r, 
                                REAL *z, 
                                void *data)
 {
     ILU_data *iludata=(ILU_data *)data;
-    const INT m=iludata->row, mm1=m-1, memneed=2*m;
+    const INT m=iludata->row, memneed=2*m;
+    const INT *perm=iludata->perm;
     REAL *zz, *zr;
+    INT i;
     
     if (iludata->nwork<memneed) goto MEMERR; 
     
     zz = iludata->work; 
     zr = iludata->work+m;
-    fasp_darray_cp(m, r, zr);     
-    
-    {
-        INT i, j, jj, begin_row, end_row;
-        INT *ijlu=iludata->ijlu;
-        REAL *lu=iludata->luval;
-    
-        // forward sweep: solve unit lower matrix equation L*z=r
-        zz[0]=zr[0];
-        for (i=1;i<=mm1;++i) {
-            begin_row=ijlu[i]; end_row=ijlu[i+1]-1;
-            for (j=begin_row;j<=end_row;++j) {
-                jj=ijlu[j];
-                if (jj<i) zr[i]-=lu[j]*zz[jj];
-                else break;
-            }
-            zz[i]=zr[i];
-        }
-    }
+    if (perm==NULL) fasp_darray_cp(m, r, zr);
+    else for (i=0;i<m;++i) zr[i] = r[perm[i]];
     
-    fasp_darray_cp(m, zz, z); 
+    // forward sweep: solve unit lower matrix equation L*z=r
+    fasp_ilu_dcsr_lsolve(iludata, zr, zz);
+    
+    if (perm==NULL) fasp_darray_cp(m, zz, z);
+    else for (i=0;i<m;++i) z[perm[i]] = zz[i];
     
     return;
     
@@ -313,37 +306,33 @@ MEMERR:
  *
  * \author Xiaozhe Hu, Shiquan  Zhang
  * \date   04/06/2010
+ *
+ * Modified by agent on 10/18/2026: level-scheduled solves with OpenMP
  */
 void fasp_precond_ilu_backward (REAL *r, 
                                 REAL *z, 
                                 void *data)
 {
     ILU_data *iludata=(ILU_data *)data;
-    const INT m=iludata->row, mm1=m-1, memneed=2*m;
-    REAL *zz;
+    const INT m=iludata->row, memneed=2*m;
+    const INT *perm=iludata->perm;
+    REAL *zz, *zp;
+    INT i;
     
     if (iludata->nwork<memneed) goto MEMERR; 
     
     zz = iludata->work; 
-    fasp_darray_cp(m, r, zz);     
-    
-    {
-        INT i, j, jj, begin_row, end_row, mm2=m-2;
-        INT *ijlu=iludata->ijlu;
-        REAL *lu=iludata->luval;
-    
+    if (perm==NULL) {
+        fasp_darray_cp(m, r, zz);
+        
         // backward sweep: solve upper matrix equation U*z=zz
-        z[mm1]=zz[mm1]*lu[mm1];
-        for (i=mm2;i>=0;i--) {
-            begin_row=ijlu[i]; end_row=ijlu[i+1]-1;
-            for (j=end_row;j>=begin_row;j--) {
-                jj=ijlu[j];
-                if (jj>i) zz[i]-=lu[j]*z[jj];
-                else break;
-            } 
-            z[i]=zz[i]*lu[i];
-        }
-    
+        fasp_ilu_dcsr_usolve(iludata, zz, z);
+    }
+    else { // LU = PAP': z = P'*inv(U)*P*r
+        zp = iludata->work+m;
+        for (i=0;i<m;++i) zz[i] = r[perm[i]];
+        fasp_ilu_dcsr_usolve(iludata, zz, zp);
+        for (i=0;i<m;++i) z[perm[i]] = zp[i];
     }
     
     return;
@@ -354,6 +343,38 @@ MEMERR:
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
 
+/**
+ * \fn void fasp_precond_bjilu (REAL *r, REAL *z, void *data)
+ *
+ * \brief Block-Jacobi ILU preconditioner
+ *
+ * \param r     Pointer to the vector needs preconditioning
+ * \param z     Pointer to preconditioned vector
+ * \param data  Pointer to precondition data
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note All diagonal blocks are solved concurrently, one per thread. Each block
+ *       works on its own rows of r and z and its own ILU work space.
+ */
+void fasp_precond_bjilu (REAL *r,
+                         REAL *z,
+                         void *data)
+{
+    BJILU_data *bjdata = (BJILU_data *)data;
+    const INT   nblk   = bjdata->nblk;
+    const INT  *start  = bjdata->start;
+    INT         k;
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) if (nblk > 1)
+#endif
+    for (k = 0; k < nblk; ++k) {
+        fasp_precond_ilu(r + start[k], z + start[k], &bjdata->LU[k]);
+    }
+}
+
 /**
  * \fn void fasp_precond_swz (REAL *r, REAL *z, void *data)
  *
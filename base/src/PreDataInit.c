@@ -3,7 +3,8 @@
  *  \brief Initialize important data structures
  *
  *  \note  This file contains Level-4 (Pre) functions. It requires:
- *         AuxMemory.c, AuxVector.c, BlaSparseBSR.c, and BlaSparseCSR.c
+ *         AuxMemory.c, AuxVector.c, BlaSmallMatLU.c, BlaSparseBSR.c, and
+ *         BlaSparseCSR.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
@@ -13,6 +14,8 @@
  *  \warning Every structures should be initialized before usage.
  */
 
+#include <math.h>
+
 #include "fasp.h"
 #include "fasp_functs.h"
 
@@ -97,6 +100,8 @@ AMG_data* fasp_amg_data_create(SHORT max_levels)
  * Modified by Hongxuan Zhang on 12/15/2015: Free memory for Intel MKL PARDISO
  * Modified by Chunsheng Feng on 02/12/2017: Permute A back to its origin for ILUtp
  * Modified by Chunsheng Feng on 08/11/2017: Check for max_levels == 1
+ * Modified by agent on 10/18/2026: Free dense coarse solver, aggregate maps,
+ *                                  color-permuted matrices and smoother data
  */
 void fasp_amg_data_free(AMG_data* mgl, AMG_param* param)
 {
@@ -147,12 +152,27 @@ void fasp_amg_data_free(AMG_data* mgl, AMG_param* param)
         if (max_levels > 1) {
             fasp_dcsr_free(&mgl[i].P);
             fasp_dcsr_free(&mgl[i].R);
+            fasp_icsr_free(&mgl[i].Rmap);
         }
         fasp_dvec_free(&mgl[i].b);
         fasp_dvec_free(&mgl[i].x);
         fasp_dvec_free(&mgl[i].w);
+        fasp_dvec_free(&mgl[i].diaginv);
+        fasp_mem_free(mgl[i].amli_coef);
+        mgl[i].amli_coef = NULL;
+#if MULTI_COLOR_ORDER
+        fasp_dcsr_free(&mgl[i].Amc);
+        fasp_dvec_free(&mgl[i].mc_dinv);
+        fasp_dvec_free(&mgl[i].mc_work);
+#endif
         fasp_ivec_free(&mgl[i].cfmark);
+        fasp_ivec_free(&mgl[i].aggmap);
         fasp_swz_data_free(&mgl[i].Schwarz);
+        fasp_bjilu_data_free(&mgl[i].BJILU);
+        fasp_mem_free(mgl[i].dense_LU);
+        mgl[i].dense_LU = NULL;
+        fasp_mem_free(mgl[i].dense_piv);
+        mgl[i].dense_piv = NULL;
     }
 
     for (i = 0; i < mgl->near_kernel_dim; ++i) {
@@ -188,6 +208,8 @@ void fasp_amg_data_free(AMG_data* mgl, AMG_param* param)
  * Modified by Hongxuan Zhang on 12/15/2015: Free memory for Intel MKL PARDISO
  * Modified by Chunsheng Feng on 02/12/2017: Permute A back to its origin for ILUtp
  * Modified by Chunsheng Feng on 08/11/2017: Check for max_levels == 1
+ * Modified by agent on 10/18/2026: Free dense coarse solver, aggregate maps,
+ *                                  color-permuted matrices and smoother data
  *
  * The difference with "fasp_amg_data_free1" is that matrix mgl[i].A does not belong to
  * itself and cannot be destroyed here. Li Zhao, 05/20/2023
@@ -242,12 +264,27 @@ void fasp_amg_data_free1(AMG_data* mgl, AMG_param* param)
         if (max_levels > 1) {
             fasp_dcsr_free(&mgl[i].P);
             fasp_dcsr_free(&mgl[i].R);
+            fasp_icsr_free(&mgl[i].Rmap);
         }
         fasp_dvec_free(&mgl[i].b);
         fasp_dvec_free(&mgl[i].x);
         fasp_dvec_free(&mgl[i].w);
+        fasp_dvec_free(&mgl[i].diaginv);
+        fasp_mem_free(mgl[i].amli_coef);
+        mgl[i].amli_coef = NULL;
+#if MULTI_COLOR_ORDER
+        fasp_dcsr_free(&mgl[i].Amc);
+        fasp_dvec_free(&mgl[i].mc_dinv);
+        fasp_dvec_free(&mgl[i].mc_work);
+#endif
         fasp_ivec_free(&mgl[i].cfmark);
+        fasp_ivec_free(&mgl[i].aggmap);
         fasp_swz_data_free(&mgl[i].Schwarz);
+        fasp_bjilu_data_free(&mgl[i].BJILU);
+        fasp_mem_free(mgl[i].dense_LU);
+        mgl[i].dense_LU = NULL;
+        fasp_mem_free(mgl[i].dense_piv);
+        mgl[i].dense_piv = NULL;
     }
 
     for (i = 0; i < mgl->near_kernel_dim; ++i) {
@@ -268,6 +305,475 @@ void fasp_amg_data_free1(AMG_data* mgl, AMG_param* param)
     }
 }
 
+/**
+ * \fn INT fasp_amg_coarse_dof (const dCSRmat *A, const AMG_param *param)
+ *
+ * \brief Max number of DOF on the coarsest level for the AMG setup
+ *
+ * \param A      Pointer to the coefficient matrix on the finest level
+ * \param param  Pointer to AMG parameters
+ *
+ * \return       Coarsening stops once the number of DOF is not larger than this
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note With the built-in dense coarse solver (coarse_solver = SOLVER_DEFAULT), a
+ *       coarsest level of size n costs 2n^2 flops per visit and 2n^3/3 flops to
+ *       factorize. We allow n^2 up to nnz(A), i.e., one fine-level SpMV per visit,
+ *       and n^3 up to 30 nnz(A), i.e., about one fine-level V-cycle for the
+ *       factorization. Coarse levels below this size cost more than they save.
+ */
+INT fasp_amg_coarse_dof(const dCSRmat* A, const AMG_param* param)
+{
+    INT cdof = param->coarse_dof;
+
+    if (param->coarse_solver == SOLVER_DEFAULT) {
+        const REAL nnz   = (REAL)A->nnz;
+        const REAL dense = MIN(sqrt(nnz), pow(30.0 * nnz, 1.0 / 3.0));
+        cdof             = MAX(cdof, (INT)MIN(dense, MAX_CDOF_DENSE));
+    }
+
+    return cdof;
+}
+
+/**
+ * \fn SHORT fasp_amg_coarse_dense_setup (AMG_data *mgc, const SHORT prtlvl)
+ *
+ * \brief Factorize the coarsest matrix with the built-in dense LU solver
+ *
+ * \param mgc     Pointer to the AMG_data of the coarsest level
+ * \param prtlvl  Level of output
+ *
+ * \return        FASP_SUCCESS if the dense LU factors are ready, otherwise the
+ *                iterative coarse solver will be used
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The factors are kept in mgc->dense_LU and mgc->dense_piv, which are used
+ *       by the coarse level solver in each cycle.
+ */
+SHORT fasp_amg_coarse_dense_setup(AMG_data* mgc, const SHORT prtlvl)
+{
+    const dCSRmat* A = &mgc->A;
+    const INT      n = A->row;
+
+    INT   i, k;
+    SHORT status;
+
+    fasp_mem_free(mgc->dense_LU);
+    mgc->dense_LU = NULL;
+    fasp_mem_free(mgc->dense_piv);
+    mgc->dense_piv = NULL;
+
+    if (n <= 0 || n > MAX_CDOF_DENSE || n != A->col) return ERROR_SOLVER_EXIT;
+
+    REAL* LU  = (REAL*)fasp_mem_calloc(n * n, sizeof(REAL));
+    INT*  piv = (INT*)fasp_mem_calloc(n, sizeof(INT));
+
+    for (i = 0; i < n; ++i) {
+        for (k = A->IA[i]; k < A->IA[i + 1]; ++k) LU[i * n + A->JA[k]] += A->val[k];
+    }
+
+    status = fasp_smat_lu_decomp_blk(LU, piv, n);
+
+    if (status < 0) {
+        if (prtlvl >= PRINT_MORE) {
+            printf("### WARNING: Coarsest matrix is singular, use iterative solver!\n");
+        }
+        fasp_mem_free(LU);
+        LU = NULL;
+        fasp_mem_free(piv);
+        piv = NULL;
+        return status;
+    }
+
+    mgc->dense_LU  = LU;
+    mgc->dense_piv = piv;
+
+    return FASP_SUCCESS;
+}
+
+/**
+ * \fn void fasp_amg_coarse_sparsify (dCSRmat *Ac, const INT lvl,
+ *                                    const AMG_param *param)
+ *
+ * \brief Non-Galerkin sparsification of a coarse matrix after RAP
+ *
+ * \param Ac     Pointer to the coarse matrix on level lvl
+ * \param lvl    Index of the coarse level
+ * \param param  Pointer to AMG parameters
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Off-diagonal entries with |aij| < sparsify_tol*sqrt(|aii*ajj|) are lumped
+ *       to the diagonal on levels lvl >= sparsify_level. This bounds the stencil
+ *       growth of RAP on coarse levels at the price of a slightly weaker coarse
+ *       correction; sparsify_tol = 0 keeps the Galerkin operator.
+ */
+void fasp_amg_coarse_sparsify(dCSRmat* Ac, const INT lvl, const AMG_param* param)
+{
+    const INT nnz = Ac->nnz;
+
+    if (param->sparsify_tol <= 0.0 || lvl < param->sparsify_level) return;
+
+    if (fasp_dcsr_sparsify(Ac, param->sparsify_tol) < 0) {
+        printf("### WARNING: Sparsification on level-%d failed!\n", lvl);
+        return;
+    }
+
+    if (param->print_level > PRINT_SOME) {
+        printf("Sparsify level %2d: nnz %d -> %d\n", lvl, nnz, Ac->nnz);
+    }
+}
+
+/**
+ * \fn SHORT fasp_amg_budget_check (AMG_data *mgl, const INT lvl,
+ *                                  AMG_param *param)
+ *
+ * \brief Check the complexity budget once coarse level lvl has been formed and
+ *        adjust the coarsening parameters for the next level
+ *
+ * \param mgl    Pointer to the AMG data on levels 0 to lvl
+ * \param lvl    Index of the new coarse level
+ * \param param  Pointer to AMG parameters (may be changed)
+ *
+ * \return       TRUE if coarsening should stop at level lvl, FALSE otherwise
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The rest of the hierarchy is predicted from the coarsening and density
+ *       ratios of the last level, as a geometric series. Three actions are taken,
+ *       in this order, and each of them is reported when print_level > 0:
+ *       (1) if the new level breaks the operator complexity budget, its matrix is
+ *           sparsified with a growing tolerance;
+ *       (2) if the memory budget is broken, coarsening stops at this level; the
+ *           complexity budgets are soft, since stopping early leaves a large
+ *           coarsest level;
+ *       (3) if the predicted grid complexity is over budget, classical AMG
+ *           switches from classical to aggressive coarsening for the remaining
+ *           levels (once; fasp_amg_setup_rs falls back to classical coarsening
+ *           if a level coarsens too fast), or else uses a smaller strong
+ *           threshold, and SA uses larger aggregates;
+ *           if the predicted operator complexity or memory is over budget, the
+ *           interpolation truncation (classical AMG) and the sparsification of
+ *           the coarser matrices are tightened.
+ *       Use fasp_amg_budget_reset to undo the changes to param after the setup.
+ */
+SHORT fasp_amg_budget_check(AMG_data* mgl, const INT lvl, AMG_param* param)
+{
+    const REAL  maxgc  = param->max_grid_complexity;
+    const REAL  maxoc  = param->max_operator_complexity;
+    const REAL  maxmem = param->max_memory * 1048576.0;
+    const SHORT prtlvl = param->print_level;
+    const REAL  n0 = mgl[0].A.row, z0 = mgl[0].A.nnz;
+
+    dCSRmat* Ac = &mgl[lvl].A;
+    REAL     gsum = 0.0, zsum = 0.0, mem = 0.0, tol, rg, rz;
+    INT      l, nnz;
+    SHORT    over;
+
+    if (lvl < 1 || (maxgc <= 0.0 && maxoc <= 0.0 && maxmem <= 0.0)) return FALSE;
+
+    // complexities and memory of levels 0 to lvl
+    for (l = 0; l <= lvl; ++l) {
+        gsum += mgl[l].A.row;
+        zsum += mgl[l].A.nnz;
+        mem += (REAL)mgl[l].A.nnz * (sizeof(INT) + sizeof(REAL)) +
+               (REAL)mgl[l].A.row * sizeof(INT);
+        if (l == lvl) continue;
+        mem += (REAL)mgl[l].P.nnz * (sizeof(INT) + sizeof(REAL)) +
+               (REAL)mgl[l].P.row * sizeof(INT);
+        mem += (REAL)mgl[l].R.nnz * (sizeof(INT) + sizeof(REAL)) +
+               (REAL)mgl[l].R.row * sizeof(INT);
+    }
+
+    // (1) lump small entries of the new coarse matrix if it breaks the budget
+    for (tol = MAX(param->sparsify_tol, 0.05) * 2.0;
+         maxoc > 0.0 && zsum > maxoc * z0 && tol <= 0.4; tol *= 2.0) {
+        nnz = Ac->nnz;
+        if (fasp_dcsr_sparsify(Ac, tol) < 0) break;
+        zsum -= nnz - Ac->nnz;
+        mem -= (REAL)(nnz - Ac->nnz) * (sizeof(INT) + sizeof(REAL));
+        if (prtlvl > PRINT_NONE)
+            printf("Budget level %2d: sparsify with tol %.2f, nnz %d -> %d\n", lvl,
+                   tol, nnz, Ac->nnz);
+    }
+
+    // (2) the memory budget is a hard limit: stop coarsening
+    if (maxmem > 0.0 && mem > maxmem) {
+        if (prtlvl > PRINT_NONE)
+            printf("Budget level %2d: stop coarsening, %.1f MB\n", lvl,
+                   mem / 1048576.0);
+        return TRUE;
+    }
+
+    over = (maxgc > 0.0 && gsum > maxgc * n0) || (maxoc > 0.0 && zsum > maxoc * z0);
+    if (over && prtlvl > PRINT_NONE)
+        printf("Budget level %2d: over budget, gc %.3f, oc %.3f\n", lvl, gsum / n0,
+               zsum / z0);
+
+    // (3) predict the complexities of the coarser levels and adjust parameters
+    rg = (REAL)Ac->row / mgl[lvl - 1].A.row;
+    rz = (REAL)Ac->nnz / mgl[lvl - 1].A.nnz;
+
+    if (maxgc > 0.0 &&
+        (over || rg >= 1.0 || gsum + Ac->row * rg / (1.0 - rg) > maxgc * n0)) {
+        if (param->AMG_type == CLASSIC_AMG && param->coarsening_type == COARSE_RS &&
+            param->aggressive_level < param->max_levels) {
+            // aggressive coarsening up to the last level (only switched on once)
+            param->coarsening_type  = COARSE_AC;
+            param->aggressive_level = MAX(param->aggressive_level, param->max_levels);
+            if (prtlvl > PRINT_NONE)
+                printf("Budget level %2d: aggressive coarsening\n", lvl);
+        } else if (param->AMG_type == CLASSIC_AMG) {
+            // more strong connections give fewer C-points
+            param->strong_threshold = MAX(param->strong_threshold * 0.5, 0.05);
+            if (prtlvl > PRINT_NONE)
+                printf("Budget level %2d: strong threshold %.4f\n", lvl,
+                       param->strong_threshold);
+        } else {
+            param->strong_coupled  = MAX(param->strong_coupled * 0.5, 0.01);
+            param->max_aggregation = MIN(param->max_aggregation * 2, 64);
+            if (prtlvl > PRINT_NONE)
+                printf("Budget level %2d: strong coupled %.4f, max aggregate %d\n",
+                       lvl, param->strong_coupled, param->max_aggregation);
+        }
+    }
+
+    if ((maxoc > 0.0 &&
+         (over || rz >= 1.0 || zsum + Ac->nnz * rz / (1.0 - rz) > maxoc * z0)) ||
+        (maxmem > 0.0 && (rz >= 1.0 || mem / (1.0 - rz) > maxmem))) {
+        if (param->AMG_type == CLASSIC_AMG) {
+            param->truncation_threshold = MIN(param->truncation_threshold * 2.0, 0.5);
+        }
+        tol                   = over ? 0.4 : MAX(param->sparsify_tol * 2.0, 0.1);
+        param->sparsify_tol   = MIN(tol, 0.4);
+        param->sparsify_level = MIN(param->sparsify_level, lvl + 1);
+        if (prtlvl > PRINT_NONE)
+            printf("Budget level %2d: truncation %.3f, sparsify tol %.2f\n", lvl,
+                   param->truncation_threshold, param->sparsify_tol);
+    }
+
+    return FALSE;
+}
+
+/**
+ * \fn void fasp_amg_budget_reset (AMG_param *param, const AMG_param *param0)
+ *
+ * \brief Undo the changes made by fasp_amg_budget_check
+ *
+ * \param param   Pointer to AMG parameters after the setup
+ * \param param0  Pointer to a copy of the AMG parameters before the setup
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_amg_budget_reset(AMG_param* param, const AMG_param* param0)
+{
+    if (param0->max_grid_complexity <= 0.0 && param0->max_operator_complexity <= 0.0 &&
+        param0->max_memory <= 0.0)
+        return;
+
+    param->truncation_threshold = param0->truncation_threshold;
+    param->strong_coupled       = param0->strong_coupled;
+    param->max_aggregation      = param0->max_aggregation;
+    param->sparsify_tol         = param0->sparsify_tol;
+    param->sparsify_level       = param0->sparsify_level;
+    param->strong_threshold     = param0->strong_threshold;
+    param->coarsening_type      = param0->coarsening_type;
+    param->aggressive_level     = param0->aggressive_level;
+}
+
+/**
+ * \fn void fasp_amg_level_threads (AMG_data *mgl, const AMG_param *param)
+ *
+ * \brief Set the number of OpenMP threads used on each level of the AMG cycle
+ *
+ * \param mgl    Pointer to the AMG data after the setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note With THREAD_SIZE each thread gets at least OPENMP_HOLDS rows; with
+ *       THREAD_AUTO the level SpMV is timed with 1, 2, 4, ... threads and the
+ *       fastest count is kept, unless more threads gain less than 10%. Levels
+ *       with at most OPENMP_HOLDS rows always run on one thread. The counts in
+ *       mgl[l].threads may also be set by the user after the setup.
+ */
+void fasp_amg_level_threads(AMG_data* mgl, const AMG_param* param)
+{
+    const SHORT nl = mgl[0].num_levels;
+    INT         l;
+
+    for (l = 0; l < nl; ++l) mgl[l].threads = 0;
+
+#ifdef _OPENMP
+    const SHORT prtlvl   = param->print_level;
+    const INT   nthreads = fasp_get_num_threads();
+
+    REAL *x = NULL, *y = NULL, start, end, best;
+    INT   t, r, reps;
+
+    if (param->thread_policy == THREAD_ALL || nthreads == 1) return;
+
+    if (param->thread_policy == THREAD_AUTO) {
+        x = (REAL*)fasp_mem_calloc(mgl[0].A.col, sizeof(REAL));
+        y = (REAL*)fasp_mem_calloc(mgl[0].A.row, sizeof(REAL));
+        fasp_darray_set(mgl[0].A.col, x, 1.0);
+    }
+
+    for (l = 0; l < nl; ++l) {
+        dCSRmat* A = &mgl[l].A;
+
+        if (A->row <= OPENMP_HOLDS) {
+            mgl[l].threads = 1;
+        } else if (param->thread_policy == THREAD_SIZE) {
+            mgl[l].threads = MIN(nthreads, A->row / OPENMP_HOLDS);
+        } else {
+            reps = MIN(100, MAX(4, 4000000 / MAX(A->nnz, 1)));
+            best = BIGREAL;
+            for (t = 1;; t = MIN(2 * t, nthreads)) {
+                fasp_set_level_threads(t);
+                fasp_blas_dcsr_mxv(A, x, y); // warm up
+                fasp_gettime(&start);
+                for (r = 0; r < reps; ++r) fasp_blas_dcsr_mxv(A, x, y);
+                fasp_gettime(&end);
+                if (end - start < 0.9 * best) {
+                    best           = end - start;
+                    mgl[l].threads = t;
+                }
+                if (t == nthreads) break;
+            }
+            fasp_set_level_threads(0);
+        }
+
+        if (mgl[l].threads == nthreads) mgl[l].threads = 0;
+
+        if (prtlvl > PRINT_SOME)
+            printf("Threads level %2d: %d rows, %d threads\n", l, A->row,
+                   mgl[l].threads > 0 ? mgl[l].threads : nthreads);
+    }
+
+    fasp_mem_free(x);
+    x = NULL;
+    fasp_mem_free(y);
+    y = NULL;
+#endif
+}
+
+/**
+ * \fn void fasp_amg_cheby_setup (AMG_data *mgl, const AMG_param *param)
+ *
+ * \brief Setup the Chebyshev smoother on each level of the AMG hierarchy
+ *
+ * \param mgl    Pointer to the AMG data after the setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Does nothing unless param->smoother is SMOOTHER_CHEBY. On each level but
+ *       the coarsest, the inverse diagonal of A is stored and the largest
+ *       eigenvalue of D^{-1}A is estimated once by a few Lanczos steps; the
+ *       smoother then damps the interval [cheby_ratio*lmax, lmax].
+ */
+void fasp_amg_cheby_setup(AMG_data* mgl, const AMG_param* param)
+{
+    const SHORT nl = mgl[0].num_levels;
+    REAL*       dinv;
+    REAL        lmin, lmax;
+    INT         i, l;
+
+    if (param->smoother != SMOOTHER_CHEBY) return;
+
+    for (l = 0; l < nl - 1; ++l) {
+        dCSRmat* A = &mgl[l].A;
+
+        fasp_dvec_free(&mgl[l].diaginv);
+        fasp_dcsr_getdiag(0, A, &mgl[l].diaginv);
+        dinv = mgl[l].diaginv.val;
+        for (i = 0; i < mgl[l].diaginv.row; ++i)
+            dinv[i] = ABS(dinv[i]) > SMALLREAL ? 1.0 / dinv[i] : 0.0;
+
+        // 10% safety margin since the Ritz value underestimates lmax
+        fasp_dcsr_eig_lanczos(A, dinv, 10, &lmin, &lmax);
+        mgl[l].cheby_lmax = 1.1 * lmax;
+        mgl[l].cheby_lmin = param->cheby_ratio * mgl[l].cheby_lmax;
+
+        if (param->print_level > PRINT_SOME)
+            printf("Chebyshev level %2d: lmax = %.4e\n", l, mgl[l].cheby_lmax);
+    }
+}
+
+/**
+ * \fn void fasp_amg_bjilu_setup (AMG_data *mgl, const AMG_param *param)
+ *
+ * \brief Setup the block-Jacobi ILU smoother on each level of the AMG hierarchy
+ *
+ * \param mgl    Pointer to the AMG data after the setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Does nothing unless param->smoother is SMOOTHER_BJILU. On each level but
+ *       the coarsest, the rows are split into one block per thread and each
+ *       diagonal block is factorized with the ILU parameters of the AMG. If the
+ *       setup fails on a level, the smoother falls back to Gauss-Seidel there.
+ */
+void fasp_amg_bjilu_setup(AMG_data* mgl, const AMG_param* param)
+{
+    const SHORT nl = mgl[0].num_levels;
+    ILU_param   iluparam;
+    INT         l;
+
+    if (param->smoother != SMOOTHER_BJILU) return;
+
+    fasp_param_ilu_init(&iluparam);
+    iluparam.print_level = param->print_level;
+    iluparam.ILU_lfil    = param->ILU_lfil;
+    iluparam.ILU_droptol = param->ILU_droptol;
+    iluparam.ILU_relax   = param->ILU_relax;
+    iluparam.ILU_type    = param->ILU_type;
+
+    for (l = 0; l < nl - 1; ++l) {
+        fasp_bjilu_data_free(&mgl[l].BJILU);
+        if (fasp_ilu_dcsr_setup_bj(&mgl[l].A, &mgl[l].BJILU, &iluparam, 0) < 0 &&
+            param->print_level > PRINT_MIN)
+            printf("### WARNING: Use GS instead of block-Jacobi ILU on level %d!\n", l);
+    }
+}
+
+/**
+ * \fn void fasp_amg_multicolor_setup (AMG_data *mgl)
+ *
+ * \brief Form the color-permuted copy of A on one level for multicolor GS
+ *
+ * \param mgl    Pointer to the AMG data of the level (colored by the setup)
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note The copy is formed on first use by the cycles that call
+ *       fasp_smoother_dcsr_gs_multicolor_perm. Runs which only go through the
+ *       single parallel region cycle (mgcycle_spmd) smooth with A itself and
+ *       never store the copy.
+ */
+void fasp_amg_multicolor_setup(AMG_data* mgl)
+{
+#if MULTI_COLOR_ORDER
+    if (mgl->Amc.IA != NULL) return;
+
+    fasp_dcsr_multicolor_perm(&mgl->A, &mgl->Amc, &mgl->mc_dinv);
+    mgl->mc_work = fasp_dvec_create(2 * mgl->A.row);
+#endif
+}
+
 /**
  * \fn AMG_data_bsr * fasp_amg_data_bsr_create (SHORT max_levels)
  *
@@ -394,6 +900,41 @@ void fasp_amg_data_bsr_free(AMG_data_bsr* mgl, AMG_param* param)
     mgl = NULL;
 }
 
+/**
+ * \fn void fasp_amg_cheby_setup_bsr (AMG_data_bsr *mgl, const AMG_param *param)
+ *
+ * \brief Setup the Chebyshev smoother on each level of the AMG hierarchy (BSR)
+ *
+ * \param mgl    Pointer to the AMG data after the setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Same as fasp_amg_cheby_setup, using the block diagonal inverses already
+ *       stored in mgl[l].diaginv.
+ */
+void fasp_amg_cheby_setup_bsr(AMG_data_bsr* mgl, const AMG_param* param)
+{
+    const SHORT nl = mgl[0].num_levels;
+    REAL        lmin, lmax;
+    INT         l;
+
+    if (param->smoother != SMOOTHER_CHEBY) return;
+
+    for (l = 0; l < nl - 1; ++l) {
+        if (mgl[l].diaginv.val == NULL) continue;
+
+        // 10% safety margin since the Ritz value underestimates lmax
+        fasp_dbsr_eig_lanczos(&mgl[l].A, mgl[l].diaginv.val, 10, &lmin, &lmax);
+        mgl[l].cheby_lmax = 1.1 * lmax;
+        mgl[l].cheby_lmin = param->cheby_ratio * mgl[l].cheby_lmax;
+
+        if (param->print_level > PRINT_SOME)
+            printf("Chebyshev level %2d: lmax = %.4e\n", l, mgl[l].cheby_lmax);
+    }
+}
+
 /**
  * \fn void fasp_ilu_data_create (const INT iwk, const INT nwork, ILU_data *iludata)
  *
@@ -441,6 +982,7 @@ void fasp_ilu_data_create(const INT iwk, const INT nwork, ILU_data* iludata)
  * \date   2010/04/03
  *
  * Modified by Chunsheng Feng on 02/12/2017: add iperm array for ILUtp
+ * Modified by agent on 10/18/2026: free the split L/U storage and the reordering
  */
 void fasp_ilu_data_free(ILU_data* iludata)
 {
@@ -461,6 +1003,16 @@ void fasp_ilu_data_free(ILU_data* iludata)
     fasp_mem_free(iludata->jlevU);
     iludata->jlevU = NULL;
 
+    if (iludata->diaginv != NULL) {
+        fasp_dcsr_free(&iludata->L);
+        fasp_dcsr_free(&iludata->U);
+        fasp_mem_free(iludata->diaginv);
+        iludata->diaginv = NULL;
+    }
+
+    fasp_mem_free(iludata->perm);
+    iludata->perm = NULL;
+
     if (iludata->type == ILUtp) {
 
         if (iludata->A != NULL) {
@@ -482,6 +1034,39 @@ void fasp_ilu_data_free(ILU_data* iludata)
         iludata->nlevL = iludata->nlevU = 0;
 }
 
+/**
+ * \fn void fasp_bjilu_data_free (BJILU_data *bjdata)
+ *
+ * \brief Free BJILU_data sturcture
+ *
+ * \param bjdata   Pointer to BJILU_data
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+void fasp_bjilu_data_free(BJILU_data* bjdata)
+{
+    INT k;
+
+    if (bjdata == NULL) return; // There is nothing to do!
+
+    for (k = 0; k < bjdata->nblk; ++k) {
+        if (bjdata->LU != NULL) fasp_ilu_data_free(&bjdata->LU[k]);
+        if (bjdata->Ablk != NULL) fasp_dcsr_free(&bjdata->Ablk[k]);
+    }
+
+    fasp_mem_free(bjdata->LU);
+    bjdata->LU = NULL;
+    fasp_mem_free(bjdata->Ablk);
+    bjdata->Ablk = NULL;
+    fasp_mem_free(bjdata->start);
+    bjdata->start = NULL;
+    fasp_mem_free(bjdata->work);
+    bjdata->work = NULL;
+
+    bjdata->row = bjdata->nblk = 0;
+}
+
 /**
  * \fn void fasp_swz_data_free (SWZ_data *swzdata)
  * \brief Free SWZ_data data memeory space
@@ -490,6 +1075,8 @@ void fasp_ilu_data_free(ILU_data* iludata)
  *
  * \author Xiaozhe Hu
  * \date   2010/04/06
+ *
+ * Modified by agent on 10/18/2026: free the coloring of blocks
  */
 void fasp_swz_data_free(SWZ_data* swzdata)
 {
@@ -516,6 +1103,11 @@ void fasp_swz_data_free(SWZ_data* swzdata)
     swzdata->mask = NULL;
     fasp_mem_free(swzdata->maxa);
     swzdata->maxa = NULL;
+    fasp_mem_free(swzdata->icolor);
+    swzdata->icolor = NULL;
+    fasp_mem_free(swzdata->jcolor);
+    swzdata->jcolor = NULL;
+    swzdata->ncolors = 0;
 
 #if WITH_MUMPS
     if (swzdata->mumps == NULL) return;
@@ -17,6 +17,10 @@
 #include <math.h>
 #include <time.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "fasp.h"
 #include "fasp_functs.h"
 
@@ -27,6 +31,11 @@
 #include "PreMGSmoother.inl"
 #include "PreMGUtil.inl"
 
+#ifdef _OPENMP
+static SHORT mgcycle_spmd_check(const AMG_data*, const AMG_param*);
+static void  mgcycle_spmd(AMG_data*, const AMG_param*, const INT*);
+#endif
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -44,6 +53,8 @@
  *
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Chensong Zhang on 12/30/2014: update Schwarz smoothers.
+ * Modified by agent on 10/18/2026: threads on each level, single parallel region
+ *                                  and Chebyshev smoother
  */
 void fasp_solver_mgcycle(AMG_data* mgl, AMG_param* param)
 {
@@ -92,11 +103,21 @@ void fasp_solver_mgcycle(AMG_data* mgl, AMG_param* param)
     printf("### DEBUG: AMG_level = %d, ILU_level = %d\n", nl, mgl->ILU_levels);
 #endif
 
+#ifdef _OPENMP
+    // run the whole cycle in one parallel region if the setting allows it
+    if (mgcycle_spmd_check(mgl, param)) {
+        mgcycle_spmd(mgl, param, ncycles);
+        return;
+    }
+#endif
+
 ForwardSweep:
     while (l < nl - 1) {
 
         num_lvl[l]++;
 
+        fasp_set_level_threads(mgl[l].threads);
+
         // pre-smoothing with ILU method
         if (l < mgl->ILU_levels) {
             fasp_smoother_dcsr_ilu(&mgl[l].A, &mgl[l].b, &mgl[l].x, &mgl[l].LU);
@@ -118,13 +139,36 @@ ForwardSweep:
             }
         }
 
+        // or pre-smoothing with Chebyshev smoother
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(&mgl[l].x, &mgl[l].A, &mgl[l].b, mgl[l].diaginv.val,
+                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                     param->presmooth_iter);
+        }
+
+        // or pre-smoothing with block-Jacobi ILU smoother
+        else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(&mgl[l].x, &mgl[l].A, &mgl[l].b, &mgl[l].BJILU,
+                                     param->presmooth_iter);
+        }
+
+        // or pre-smoothing with hybrid l1-GS smoothers
+        else if (smoother == SMOOTHER_L1GS || smoother == SMOOTHER_L1SGS) {
+            fasp_dcsr_presmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                   param->presmooth_iter, 0, mgl[l].A.row - 1, 1, relax,
+                                   ndeg, smooth_order, mgl[l].cfmark.val);
+        }
+
         // or pre-smoothing with standard smoother
         else {
 #if MULTI_COLOR_ORDER
             // printf("fasp_smoother_dcsr_gs_multicolor, %s, %d\n",  __FUNCTION__,
             // __LINE__);
-            fasp_smoother_dcsr_gs_multicolor(&mgl[l].x, &mgl[l].A, &mgl[l].b,
-                                             param->presmooth_iter, 1);
+            fasp_amg_multicolor_setup(&mgl[l]);
+            fasp_smoother_dcsr_gs_multicolor_perm(&mgl[l].x, &mgl[l].Amc,
+                                                  mgl[l].mc_dinv.val, &mgl[l].b,
+                                                  param->presmooth_iter, 1,
+                                                  mgl[l].mc_work.val);
 #else
             fasp_dcsr_presmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
                                    param->presmooth_iter, 0, mgl[l].A.row - 1, 1, relax,
@@ -137,20 +181,15 @@ ForwardSweep:
         fasp_blas_dcsr_aAxpy(-1.0, &mgl[l].A, mgl[l].x.val, mgl[l].w.val);
 
         // restriction r1 = R*r0
-        switch (amg_type) {
-            case UA_AMG:
-                fasp_blas_dcsr_mxv_agg(&mgl[l].R, mgl[l].w.val, mgl[l + 1].b.val);
-                break;
-            default:
-                fasp_blas_dcsr_mxv(&mgl[l].R, mgl[l].w.val, mgl[l + 1].b.val);
-                break;
-        }
+        fasp_mg_restrict(&mgl[l], amg_type, mgl[l].w.val, &mgl[l + 1].b);
 
         // prepare for the next level
         ++l;
         fasp_dvec_set(mgl[l].A.row, &mgl[l].x, 0.0);
     }
 
+    fasp_set_level_threads(mgl[nl - 1].threads);
+
     // If AMG only has one level or we have arrived at the coarsest level,
     // call the coarse space solver:
     switch (coarse_solver) {
@@ -196,9 +235,8 @@ ForwardSweep:
 #endif
 
         default:
-            // use iterative solver on the coarsest level
-            fasp_coarse_itsolver(&mgl[nl - 1].A, &mgl[nl - 1].b, &mgl[nl - 1].x, tol,
-                                 prtlvl);
+            // use built-in dense or iterative solver on the coarsest level
+            fasp_coarse_solver(&mgl[nl - 1], tol, prtlvl);
     }
 
     // BackwardSweep:
@@ -206,6 +244,8 @@ ForwardSweep:
 
         --l;
 
+        fasp_set_level_threads(mgl[l].threads);
+
         // find the optimal scaling factor alpha
         if (param->coarse_scaling == ON) {
             alpha =
@@ -216,15 +256,7 @@ ForwardSweep:
         }
 
         // prolongation u = u + alpha*P*e1
-        switch (amg_type) {
-            case UA_AMG:
-                fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, mgl[l + 1].x.val,
-                                         mgl[l].x.val);
-                break;
-            default:
-                fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l + 1].x.val, mgl[l].x.val);
-                break;
-        }
+        fasp_mg_prolong(&mgl[l], amg_type, alpha, mgl[l + 1].x.val, mgl[l].x.val);
 
         // post-smoothing with ILU method
         if (l < mgl->ILU_levels) {
@@ -247,11 +279,34 @@ ForwardSweep:
             }
         }
 
+        // or post-smoothing with Chebyshev smoother
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(&mgl[l].x, &mgl[l].A, &mgl[l].b, mgl[l].diaginv.val,
+                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                     param->postsmooth_iter);
+        }
+
+        // or post-smoothing with block-Jacobi ILU smoother
+        else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(&mgl[l].x, &mgl[l].A, &mgl[l].b, &mgl[l].BJILU,
+                                     param->postsmooth_iter);
+        }
+
+        // or post-smoothing with hybrid l1-GS smoothers
+        else if (smoother == SMOOTHER_L1GS || smoother == SMOOTHER_L1SGS) {
+            fasp_dcsr_postsmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                    param->postsmooth_iter, 0, mgl[l].A.row - 1, -1,
+                                    relax, ndeg, smooth_order, mgl[l].cfmark.val);
+        }
+
         // post-smoothing with standard methods
         else {
 #if MULTI_COLOR_ORDER
-            fasp_smoother_dcsr_gs_multicolor(&mgl[l].x, &mgl[l].A, &mgl[l].b,
-                                             param->postsmooth_iter, -1);
+            fasp_amg_multicolor_setup(&mgl[l]);
+            fasp_smoother_dcsr_gs_multicolor_perm(&mgl[l].x, &mgl[l].Amc,
+                                                  mgl[l].mc_dinv.val, &mgl[l].b,
+                                                  param->postsmooth_iter, -1,
+                                                  mgl[l].mc_work.val);
 #else
             fasp_dcsr_postsmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
                                     param->postsmooth_iter, 0, mgl[l].A.row - 1, -1,
@@ -268,6 +323,8 @@ ForwardSweep:
 
     if (l > 0) goto ForwardSweep;
 
+    fasp_set_level_threads(0); // back to all threads
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
@@ -283,6 +340,8 @@ ForwardSweep:
  *
  * \author Xiaozhe Hu
  * \date   08/07/2011
+ *
+ * Modified by agent on 10/18/2026: add Chebyshev smoother
  */
 void fasp_solver_mgcycle_bsr(AMG_data_bsr* mgl, AMG_param* param)
 {
@@ -359,6 +418,26 @@ ForwardSweep:
                         fasp_smoother_dbsr_sor_descend(&mgl[l].A, &mgl[l].b, &mgl[l].x,
                                                        mgl[l].diaginv.val, relax);
                         break;
+                    case SMOOTHER_L1GS:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_l1gs(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                    mgl[l].diaginv.val, ASCEND);
+                        break;
+                    case SMOOTHER_L1SGS:
+                        for (i = 0; i < steps; i++) {
+                            fasp_smoother_dbsr_l1gs(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                    mgl[l].diaginv.val, ASCEND);
+                            fasp_smoother_dbsr_l1gs(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                    mgl[l].diaginv.val, DESCEND);
+                        }
+                        break;
+                    case SMOOTHER_CHEBY:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_cheby(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                     mgl[l].diaginv.val, mgl[l].cheby_lmin,
+                                                     mgl[l].cheby_lmax,
+                                                     param->polynomial_degree);
+                        break;
                     default:
                         printf("### ERROR: Unknown smoother type %d!\n", smoother);
                         fasp_chkerr(ERROR_SOLVER_TYPE, __FUNCTION__);
@@ -545,6 +624,26 @@ ForwardSweep:
                         fasp_smoother_dbsr_sor_descend(&mgl[l].A, &mgl[l].b, &mgl[l].x,
                                                        mgl[l].diaginv.val, relax);
                         break;
+                    case SMOOTHER_L1GS:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_l1gs(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                    mgl[l].diaginv.val, DESCEND);
+                        break;
+                    case SMOOTHER_L1SGS:
+                        for (i = 0; i < steps; i++) {
+                            fasp_smoother_dbsr_l1gs(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                    mgl[l].diaginv.val, ASCEND);
+                            fasp_smoother_dbsr_l1gs(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                    mgl[l].diaginv.val, DESCEND);
+                        }
+                        break;
+                    case SMOOTHER_CHEBY:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_cheby(&mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                                     mgl[l].diaginv.val, mgl[l].cheby_lmin,
+                                                     mgl[l].cheby_lmax,
+                                                     param->polynomial_degree);
+                        break;
                     default:
                         printf("### ERROR: Unknown smoother type %d!\n", smoother);
                         fasp_chkerr(ERROR_SOLVER_TYPE, __FUNCTION__);
@@ -565,6 +664,403 @@ ForwardSweep:
 #endif
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+#ifdef _OPENMP
+
+/**
+ * \fn static SHORT mgcycle_spmd_check (const AMG_data *mgl,
+ *                                      const AMG_param *param)
+ *
+ * \brief Check whether the cycle can run in a single parallel region
+ *
+ * \param mgl    Pointer to AMG data: AMG_data
+ * \param param  Pointer to AMG parameters: AMG_param
+ *
+ * \return       TRUE if mgcycle_spmd can be used, FALSE otherwise
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Only the Jacobi, GS and SGS smoothers (or the multicolor GS smoother if
+ *       MULTI_COLOR_ORDER is on), with R stored in the setup and without coarse
+ *       grid scaling, ILU or Schwarz smoothers are supported. The Chebyshev,
+ *       hybrid l1-GS and block-Jacobi ILU smoothers are thread-parallel already
+ *       and run in the standard cycle.
+ */
+static SHORT mgcycle_spmd_check(const AMG_data* mgl, const AMG_param* param)
+{
+    const SHORT nl = mgl[0].num_levels;
+    INT         l;
+
+    if (omp_in_parallel() || fasp_get_num_threads() < 2) return FALSE;
+
+    if (mgl[0].A.row <= OPENMP_HOLDS || mgl->ILU_levels > 0 || mgl->SWZ_levels > 0 ||
+        param->coarse_scaling == ON || param->smoother == SMOOTHER_CHEBY ||
+        param->smoother == SMOOTHER_L1GS || param->smoother == SMOOTHER_L1SGS ||
+        param->smoother == SMOOTHER_BJILU)
+        return FALSE;
+
+#if !MULTI_COLOR_ORDER
+    switch (param->smoother) {
+        case SMOOTHER_JACOBI:
+        case SMOOTHER_GS:
+        case SMOOTHER_SGS:
+            break;
+        default:
+            return FALSE;
+    }
+#endif
+
+    for (l = 0; l < nl - 1; ++l) {
+        if (mgl[l].R.IA == NULL || mgl[l].aggmap.val != NULL) return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * \fn static inline void spmd_range (const INT myid, const INT nt, const INT n,
+ *                                    INT *begin, INT *end)
+ *
+ * \brief Rows [begin, end) of thread myid when n rows are split among nt threads
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void spmd_range(const INT myid, const INT nt, const INT n, INT* begin,
+                              INT* end)
+{
+    if (myid < nt)
+        fasp_get_start_end(myid, nt, n, begin, end);
+    else
+        *begin = *end = 0;
+}
+
+/**
+ * \fn static inline void spmd_gs (const dCSRmat *A, const REAL *b, REAL *x,
+ *                                 const INT begin, const INT end, const INT s,
+ *                                 const INT *mark, const INT pick)
+ *
+ * \brief One GS sweep on rows [begin, end), forward if s > 0 and backward
+ *        otherwise; if mark is given, only C-points (pick = 1) or F-points
+ *        (pick = 0) are relaxed
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void spmd_gs(const dCSRmat* A, const REAL* b, REAL* x, const INT begin,
+                           const INT end, const INT s, const INT* mark,
+                           const INT pick)
+{
+    const INT * ia = A->IA, *ja = A->JA;
+    const REAL* aj = A->val;
+
+    INT  i, k, n;
+    REAL t, d = 0.0;
+
+    for (n = begin; n < end; ++n) {
+        i = (s > 0) ? n : begin + end - 1 - n;
+        if (mark != NULL && (mark[i] == 1) != pick) continue;
+        t = b[i];
+        for (k = ia[i]; k < ia[i + 1]; ++k) {
+            if (ja[k] != i)
+                t -= aj[k] * x[ja[k]];
+            else
+                d = aj[k];
+        }
+        if (ABS(d) > SMALLREAL) x[i] = t / d;
+    }
+}
+
+/**
+ * \fn static void spmd_smooth (const dCSRmat *A, const REAL *b, REAL *x,
+ *                              REAL *w, const INT *mark, const SHORT smoother,
+ *                              const INT nsweeps, const REAL relax,
+ *                              const INT order, const INT myid, const INT nt)
+ *
+ * \brief Smoothing sweeps of the calling thread inside mgcycle_spmd
+ *
+ * \param A         Pointer to the coefficient matrix of the level
+ * \param b         Right-hand side of the level
+ * \param x         Solution of the level
+ * \param w         Work array of the level (Jacobi only)
+ * \param mark      C/F marker for C/F ordered GS, or NULL
+ * \param smoother  Smoother type
+ * \param nsweeps   Number of sweeps
+ * \param relax     Relaxation parameter of Jacobi
+ * \param order     1 for pre-smoothing, -1 for post-smoothing
+ * \param myid      Index of the calling thread
+ * \param nt        Number of threads working on this level
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each thread relaxes the same rows as in the stand-alone smoothers. The
+ *       barriers are reached by all threads of the team, or by none if nt = 1.
+ */
+static void spmd_smooth(const dCSRmat* A, const REAL* b, REAL* x, REAL* w,
+                        const INT* mark, const SHORT smoother, const INT nsweeps,
+                        const REAL relax, const INT order, const INT myid,
+                        const INT nt)
+{
+    const INT n = A->row;
+
+    INT  begin, end, it, i, k;
+    REAL t, d;
+
+    spmd_range(myid, nt, n, &begin, &end);
+
+    for (it = 0; it < nsweeps; ++it) {
+
+#if MULTI_COLOR_ORDER
+        INT c, ic, cb, ce;
+        for (c = 0; c < A->color; ++c) {
+            ic = (order > 0) ? c : A->color - 1 - c;
+            spmd_range(myid, nt, A->IC[ic + 1] - A->IC[ic], &cb, &ce);
+            for (k = A->IC[ic] + cb; k < A->IC[ic] + ce; ++k) {
+                const INT j = A->ICMAP[k];
+                spmd_gs(A, b, x, j, j + 1, 1, NULL, 0);
+            }
+            if (nt > 1) {
+#pragma omp barrier
+            }
+        }
+        continue;
+#endif
+
+        switch (smoother) {
+
+            case SMOOTHER_JACOBI:
+                for (i = begin; i < end; ++i) {
+                    t = b[i];
+                    d = 0.0;
+                    for (k = A->IA[i]; k < A->IA[i + 1]; ++k) {
+                        if (A->JA[k] != i)
+                            t -= A->val[k] * x[A->JA[k]];
+                        else
+                            d = A->val[k];
+                    }
+                    w[i] = ABS(d) > SMALLREAL ? (1 - relax) * x[i] + relax * t / d
+                                              : x[i];
+                }
+                if (nt > 1) {
+#pragma omp barrier
+                }
+                for (i = begin; i < end; ++i) x[i] = w[i];
+                break;
+
+            case SMOOTHER_SGS:
+                spmd_gs(A, b, x, begin, end, 1, NULL, 0);
+                if (nt > 1) {
+#pragma omp barrier
+                }
+                spmd_gs(A, b, x, begin, end, -1, NULL, 0);
+                break;
+
+            default: // SMOOTHER_GS
+                if (mark != NULL) {
+                    // C-points first in pre-smoothing, F-points first in post
+                    spmd_gs(A, b, x, begin, end, 1, mark, order > 0);
+                    if (nt > 1) {
+#pragma omp barrier
+                    }
+                    spmd_gs(A, b, x, begin, end, 1, mark, order < 0);
+                } else if (order > 0) {
+                    spmd_gs(A, b, x, begin, end, 1, NULL, 0);
+                } else {
+                    // backward sweep on the mirrored row ranges
+                    spmd_gs(A, b, x, n - end, n - begin, -1, NULL, 0);
+                }
+        }
+
+        if (nt > 1) {
+#pragma omp barrier
+        }
+    }
+}
+
+/**
+ * \fn static void mgcycle_spmd (AMG_data *mgl, const AMG_param *param,
+ *                               const INT *ncycles)
+ *
+ * \brief Non-recursive multigrid cycle in a single parallel region
+ *
+ * \param mgl      Pointer to AMG data: AMG_data
+ * \param param    Pointer to AMG parameters: AMG_param
+ * \param ncycles  Number of coarse corrections on each level
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Each thread works on the same row ranges as the stand-alone kernels,
+ *       cached per level at the beginning, and follows the same control flow.
+ *       A barrier is only placed where one step reads what other threads have
+ *       written in the step before, and is skipped where both steps run on
+ *       thread 0 only: kernels with no more than OPENMP_HOLDS rows, which the
+ *       stand-alone kernels run serially, and the coarsest level solver.
+ */
+static void mgcycle_spmd(AMG_data* mgl, const AMG_param* param, const INT* ncycles)
+{
+    const SHORT amg_type      = param->AMG_type;
+    const SHORT smoother      = param->smoother;
+    const SHORT coarse_solver = param->coarse_solver;
+    const SHORT prtlvl        = param->print_level;
+    const SHORT nl            = mgl[0].num_levels;
+    const INT   npre          = param->presmooth_iter;
+    const INT   npost         = param->postsmooth_iter;
+    const REAL  relax         = param->relaxation;
+    const REAL  tol           = param->tol * 1e-4;
+    const SHORT cforder       = (param->smooth_order == CF_ORDER);
+
+#pragma omp parallel
+    {
+        const INT myid = omp_get_thread_num(), nthreads = omp_get_num_threads();
+
+        INT  num_lvl[MAX_AMG_LVL] = {0};
+        INT  na[MAX_AMG_LVL], nr[MAX_AMG_LVL]; // threads working on A and R
+        INT  rb[MAX_AMG_LVL], re[MAX_AMG_LVL], cb[MAX_AMG_LVL], ce[MAX_AMG_LVL];
+        INT  i, k, l, nt;
+        REAL t;
+
+        // cache row ranges of this thread on each level
+        for (l = 0; l < nl; ++l) {
+            nt    = mgl[l].threads > 0 ? MIN(mgl[l].threads, nthreads) : nthreads;
+            na[l] = (mgl[l].A.row > OPENMP_HOLDS && l < nl - 1) ? nt : 1;
+            spmd_range(myid, na[l], mgl[l].A.row, &rb[l], &re[l]);
+            if (l == nl - 1) break;
+            nr[l] = (mgl[l].R.row > OPENMP_HOLDS) ? nt : 1;
+            spmd_range(myid, nr[l], mgl[l].R.row, &cb[l], &ce[l]);
+        }
+
+        l = 0;
+
+        for (;;) {
+
+            while (l < nl - 1) {
+
+                const dCSRmat* A = &mgl[l].A;
+                const dCSRmat* R = &mgl[l].R;
+                const REAL*    b = mgl[l].b.val;
+                REAL *         x = mgl[l].x.val, *w = mgl[l].w.val;
+                REAL *         bc = mgl[l + 1].b.val, *xc = mgl[l + 1].x.val;
+
+                num_lvl[l]++;
+
+                // pre-smoothing
+                spmd_smooth(A, b, x, w, cforder ? mgl[l].cfmark.val : NULL, smoother,
+                            npre, relax, 1, myid, na[l]);
+
+                // form residual r = b - A x
+                for (i = rb[l]; i < re[l]; ++i) {
+                    t = 0.0;
+                    for (k = A->IA[i]; k < A->IA[i + 1]; ++k)
+                        t += A->val[k] * x[A->JA[k]];
+                    w[i] = b[i] - t;
+                }
+                if (na[l] > 1 || nr[l] > 1) {
+#pragma omp barrier
+                }
+
+                // restriction r1 = R*r0 and zero initial guess on the next level
+                for (i = cb[l]; i < ce[l]; ++i) {
+                    t = 0.0;
+                    if (amg_type == UA_AMG) {
+                        for (k = R->IA[i]; k < R->IA[i + 1]; ++k) t += w[R->JA[k]];
+                    } else {
+                        for (k = R->IA[i]; k < R->IA[i + 1]; ++k)
+                            t += R->val[k] * w[R->JA[k]];
+                    }
+                    bc[i] = t;
+                    xc[i] = 0.0;
+                }
+                if (nr[l] > 1 || na[l + 1] > 1) {
+#pragma omp barrier
+                }
+
+                ++l;
+            }
+
+            // coarsest level: solved by thread 0, nested regions run serially
+            if (myid == 0) {
+                switch (coarse_solver) {
+#if WITH_PARDISO
+                    case SOLVER_PARDISO:
+                        fasp_pardiso_solve(&mgl[nl - 1].A, &mgl[nl - 1].b,
+                                           &mgl[nl - 1].x, &mgl[nl - 1].pdata, 0);
+                        break;
+#endif
+#if WITH_MUMPS
+                    case SOLVER_MUMPS:
+                        mgl[nl - 1].mumps.job = 2;
+                        fasp_solver_mumps_steps(&mgl[nl - 1].A, &mgl[nl - 1].b,
+                                                &mgl[nl - 1].x, &mgl[nl - 1].mumps);
+                        break;
+#endif
+#if WITH_UMFPACK
+                    case SOLVER_UMFPACK:
+                        fasp_umfpack_solve(&mgl[nl - 1].A, &mgl[nl - 1].b,
+                                           &mgl[nl - 1].x, mgl[nl - 1].Numeric, 0);
+                        break;
+#endif
+#if WITH_SuperLU
+                    case SOLVER_SUPERLU:
+                        fasp_solver_superlu(&mgl[nl - 1].A, &mgl[nl - 1].b,
+                                            &mgl[nl - 1].x, 0);
+                        break;
+#endif
+                    default:
+                        fasp_coarse_solver(&mgl[nl - 1], tol, prtlvl);
+                }
+            }
+
+            while (l > 0) {
+
+                const dCSRmat* A = &mgl[--l].A;
+                const dCSRmat* P = &mgl[l].P;
+                const REAL*    e = mgl[l + 1].x.val;
+                const REAL*    b = mgl[l].b.val;
+                REAL *         x = mgl[l].x.val, *w = mgl[l].w.val;
+
+                if (na[l] > 1 || na[l + 1] > 1) {
+#pragma omp barrier
+                }
+
+                // prolongation u = u + P*e1
+                for (i = rb[l]; i < re[l]; ++i) {
+                    t = 0.0;
+                    if (amg_type == UA_AMG) {
+                        for (k = P->IA[i]; k < P->IA[i + 1]; ++k) t += e[P->JA[k]];
+                    } else {
+                        for (k = P->IA[i]; k < P->IA[i + 1]; ++k)
+                            t += P->val[k] * e[P->JA[k]];
+                    }
+                    x[i] += t;
+                }
+                if (na[l] > 1) {
+#pragma omp barrier
+                }
+
+                // post-smoothing
+                spmd_smooth(A, b, x, w, cforder ? mgl[l].cfmark.val : NULL, smoother,
+                            npost, relax, -1, myid, na[l]);
+
+                // general cycling on each level
+                if (num_lvl[l] < ncycles[l])
+                    break;
+                else
+                    num_lvl[l] = 0;
+            }
+
+            if (l == 0) break;
+        }
+    }
+}
+
+#endif // _OPENMP
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
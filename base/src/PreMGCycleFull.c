@@ -43,6 +43,7 @@
  *
  * Modified by Chensong Zhang on 06/01/2012: fix a bug when there is only one level.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by agent on 10/18/2026: add Chebyshev smoother
  */
 void fasp_solver_fmgcycle (AMG_data   *mgl,
                            AMG_param  *param)
@@ -78,19 +79,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
         printf("FMG_level = %d, ILU_level = %d\n", nl, param->ILU_levels);
 
     // restriction r1 = R*r0
-    switch (amg_type) {
-
-        case UA_AMG:
-            for (l=0;l<nl-1;l++)
-                fasp_blas_dcsr_mxv_agg(&mgl[l].R, mgl[l].b.val, mgl[l+1].b.val);
-            break;
-
-        default:
-            for (l=0;l<nl-1;l++)
-                fasp_blas_dcsr_mxv(&mgl[l].R, mgl[l].b.val, mgl[l+1].b.val);
-            break;
-
-    }
+    for (l=0;l<nl-1;l++)
+        fasp_mg_restrict(&mgl[l], amg_type, mgl[l].b.val, &mgl[l+1].b);
 
     fasp_dvec_set(mgl[l].A.row, &mgl[l].x, 0.0); // initial guess
 
@@ -130,8 +120,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
 #endif
 
             default:
-                /* use iterative solver on the coarest level */
-                fasp_coarse_itsolver(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, tol, prtlvl);
+                /* use built-in dense or iterative solver on the coarest level */
+                fasp_coarse_solver(&mgl[nl-1], tol, prtlvl);
 
         }
 
@@ -175,8 +165,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
 #endif
 
             default:
-                /* use iterative solver on the coarest level */
-                fasp_coarse_itsolver(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, tol, prtlvl);
+                /* use built-in dense or iterative solver on the coarest level */
+                fasp_coarse_solver(&mgl[nl-1], tol, prtlvl);
 
         }
 
@@ -192,12 +182,7 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
             }
 
             // prolongation u = u + alpha*P*e1
-            switch (amg_type) {
-                case UA_AMG:
-                    fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val); break;
-                default:
-                    fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val); break;
-            }
+            fasp_mg_prolong(&mgl[l], amg_type, alpha, mgl[l+1].x.val, mgl[l].x.val);
         }
 
         // initialzie rel error
@@ -231,6 +216,17 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                     }
                 }
 
+                else if (smoother == SMOOTHER_CHEBY) {
+                    fasp_smoother_dcsr_cheby(&mgl[l].x, &mgl[l].A, &mgl[l].b,
+                                             mgl[l].diaginv.val, mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                             param->presmooth_iter);
+                }
+
+                else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+                    fasp_smoother_dcsr_bjilu(&mgl[l].x, &mgl[l].A, &mgl[l].b, &mgl[l].BJILU,
+                                             param->presmooth_iter);
+                }
+
                 else {
                     fasp_dcsr_presmoothing(smoother,&mgl[l].A,&mgl[l].b,&mgl[l].x,param->presmooth_iter,
                                            0,mgl[l].A.row-1,1,relax,ndeg,smooth_order,mgl[l].cfmark.val);
@@ -241,14 +237,7 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                 fasp_blas_dcsr_aAxpy(-1.0,&mgl[l].A, mgl[l].x.val, mgl[l].w.val);
 
                 // restriction r1 = R*r0
-                switch (amg_type) {
-                    case UA_AMG:
-                        fasp_blas_dcsr_mxv_agg(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
-                        break;
-                    default:
-                        fasp_blas_dcsr_mxv(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
-                        break;
-                }
+                fasp_mg_restrict(&mgl[l], amg_type, mgl[l].w.val, &mgl[l+1].b);
 
                 ++l;
 
@@ -291,8 +280,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
 #endif
 
                 default:
-                    /* use iterative solver on the coarest level */
-                    fasp_coarse_itsolver(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, tol, prtlvl);
+                    /* use built-in dense or iterative solver on the coarest level */
+                    fasp_coarse_solver(&mgl[nl-1], tol, prtlvl);
 
             }
 
@@ -309,15 +298,7 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                 }
 
                 // prolongation u = u + alpha*P*e1
-                switch (amg_type)
-                {
-                    case UA_AMG:
-                        fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
-                        break;
-                    default:
-                        fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
-                        break;
-                }
+                fasp_mg_prolong(&mgl[l], amg_type, alpha, mgl[l+1].x.val, mgl[l].x.val);
 
                 // post-smoothing
                 if (l<param->ILU_levels) {
@@ -335,6 +316,17 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                     }
                 }
 
+                else if (smoother == SMOOTHER_CHEBY) {
+                    fasp_smoother_dcsr_cheby(&mgl[l].x, &mgl[l].A, &mgl[l].b,
+                                             mgl[l].diaginv.val, mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                             param->postsmooth_iter);
+                }
+
+                else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+                    fasp_smoother_dcsr_bjilu(&mgl[l].x, &mgl[l].A, &mgl[l].b, &mgl[l].BJILU,
+                                             param->postsmooth_iter);
+                }
+
                 else {
                     fasp_dcsr_postsmoothing(smoother,&mgl[l].A,&mgl[l].b,&mgl[l].x,param->postsmooth_iter,
                                             0,mgl[l].A.row-1,-1,relax,ndeg,smooth_order,mgl[l].cfmark.val);
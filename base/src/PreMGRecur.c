@@ -43,6 +43,7 @@
  * \date   04/06/2010
  *
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
+ * Modified by agent on 10/18/2026: add Chebyshev smoother
  */
 void fasp_solver_mgrecur (AMG_data   *mgl,
                           AMG_param  *param,
@@ -82,6 +83,15 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
         if ( level < mgl[level].ILU_levels ) {
             fasp_smoother_dcsr_ilu(A0, b0, e0, LU_level);
         }
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(e0, A0, b0, mgl[level].diaginv.val,
+                                     mgl[level].cheby_lmin, mgl[level].cheby_lmax, ndeg,
+                                     param->presmooth_iter);
+        }
+        else if (smoother == SMOOTHER_BJILU && mgl[level].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(e0, A0, b0, &mgl[level].BJILU,
+                                     param->presmooth_iter);
+        }
         else {
             fasp_dcsr_presmoothing(smoother,A0,b0,e0,param->presmooth_iter,
                                    0,m0-1,1,relax,ndeg,smooth_order,ordering);
@@ -92,7 +102,7 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
         fasp_blas_dcsr_aAxpy(-1.0,A0,e0->val,r);
         
         // restriction r1 = R*r0
-        fasp_blas_dcsr_mxv(&mgl[level].R, r, b1->val);
+        fasp_mg_restrict(&mgl[level], param->AMG_type, r, b1);
         
         { // call MG recursively: type = 1 for V cycle, type = 2 for W cycle
             SHORT i;
@@ -101,12 +111,21 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
         }
         
         // prolongation e0 = e0 + P*e1
-        fasp_blas_dcsr_aAxpy(1.0, &mgl[level].P, e1->val, e0->val);
+        fasp_mg_prolong(&mgl[level], param->AMG_type, 1.0, e1->val, e0->val);
         
         // post smoothing
         if ( level < mgl[level].ILU_levels ) {
             fasp_smoother_dcsr_ilu(A0, b0, e0, LU_level);
         }
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(e0, A0, b0, mgl[level].diaginv.val,
+                                     mgl[level].cheby_lmin, mgl[level].cheby_lmax, ndeg,
+                                     param->postsmooth_iter);
+        }
+        else if (smoother == SMOOTHER_BJILU && mgl[level].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(e0, A0, b0, &mgl[level].BJILU,
+                                     param->postsmooth_iter);
+        }
         else {
             fasp_dcsr_postsmoothing(smoother,A0,b0,e0,param->postsmooth_iter,
                                     0,m0-1,-1,relax,ndeg,smooth_order,ordering);
@@ -148,9 +167,9 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
                 break;
 #endif
 
-            /* use iterative solver on the coarsest level */
+            /* use built-in dense or iterative solver on the coarsest level */
             default:
-                fasp_coarse_itsolver(A0, b0, e0, tol, prtlvl);
+                fasp_coarse_solver(&mgl[level], tol, prtlvl);
                 
         }
         
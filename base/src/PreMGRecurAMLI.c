@@ -26,6 +26,18 @@
 /*--  Declare Private Functions  --*/
 /*---------------------------------*/
 
+/**
+ * \struct amli_level_data
+ * \brief  AMLI cycle started from a given level, used as a preconditioner
+ */
+typedef struct {
+    AMG_data*  mgl;   /**< AMG hierarchy */
+    AMG_param* param; /**< AMG parameters */
+    INT        level; /**< level where the cycle starts */
+} amli_level_data;
+
+static void amli_level_precond(REAL*, REAL*, void*);
+
 #include "PreMGRecurAMLI.inl"
 #include "PreMGSmoother.inl"
 #include "PreMGUtil.inl"
@@ -54,6 +66,8 @@
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Zheng Li on 11/10/2014: update direct solvers.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by agent on 10/18/2026: Chebyshev smoother and AMLI coefficients of
+ *                                  each level
  */
 void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
 {
@@ -69,7 +83,7 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
 
     // local variables
     REAL  alpha = 1.0;
-    REAL* coef  = param->amli_coef;
+    REAL* coef  = mgl[l].amli_coef != NULL ? mgl[l].amli_coef : param->amli_coef;
 
     dvector *b0 = &mgl[l].b, *e0 = &mgl[l].x;         // fine level b and x
     dvector *b1 = &mgl[l + 1].b, *e1 = &mgl[l + 1].x; // coarse level b and x
@@ -122,12 +136,33 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
             }
         }
 
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(e0, A0, b0, mgl[l].diaginv.val,
+                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                     param->presmooth_iter);
+        }
+
+        // or pre-smoothing with block-Jacobi ILU smoother
+        else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(e0, A0, b0, &mgl[l].BJILU,
+                                     param->presmooth_iter);
+        }
+
+        // or pre-smoothing with hybrid l1-GS smoothers
+        else if (smoother == SMOOTHER_L1GS || smoother == SMOOTHER_L1SGS) {
+            fasp_dcsr_presmoothing(smoother, A0, b0, e0, param->presmooth_iter, 0,
+                                   m0 - 1, 1, relax, ndeg, smooth_order, ordering);
+        }
+
         else {
 #if MULTI_COLOR_ORDER
             // printf("fasp_smoother_dcsr_gs_multicolor, %s, %d\n",  __FUNCTION__,
             // __LINE__);
-            fasp_smoother_dcsr_gs_multicolor(&mgl[l].x, &mgl[l].A, &mgl[l].b,
-                                             param->presmooth_iter, 1);
+            fasp_amg_multicolor_setup(&mgl[l]);
+            fasp_smoother_dcsr_gs_multicolor_perm(&mgl[l].x, &mgl[l].Amc,
+                                                  mgl[l].mc_dinv.val, &mgl[l].b,
+                                                  param->presmooth_iter, 1,
+                                                  mgl[l].mc_work.val);
 #else
             fasp_dcsr_presmoothing(smoother, A0, b0, e0, param->presmooth_iter, 0,
                                    m0 - 1, 1, relax, ndeg, smooth_order, ordering);
@@ -139,14 +174,7 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
         fasp_blas_dcsr_aAxpy(-1.0, A0, e0->val, r);
 
         // restriction r1 = R*r0
-        switch (amg_type) {
-            case UA_AMG:
-                fasp_blas_dcsr_mxv_agg(&mgl[l].R, r, b1->val);
-                break;
-            default:
-                fasp_blas_dcsr_mxv(&mgl[l].R, r, b1->val);
-                break;
-        }
+        fasp_mg_restrict(&mgl[l], amg_type, r, b1);
 
         // coarse grid correction
         {
@@ -178,14 +206,7 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
         }
 
         // prolongation e0 = e0 + alpha * P * e1
-        switch (amg_type) {
-            case UA_AMG:
-                fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, e1->val, e0->val);
-                break;
-            default:
-                fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, e1->val, e0->val);
-                break;
-        }
+        fasp_mg_prolong(&mgl[l], amg_type, alpha, e1->val, e0->val);
 
         // post smoothing
         if (l < mgl[l].ILU_levels) {
@@ -210,10 +231,31 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
             }
         }
 
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(e0, A0, b0, mgl[l].diaginv.val,
+                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                     param->postsmooth_iter);
+        }
+
+        // or post-smoothing with block-Jacobi ILU smoother
+        else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(e0, A0, b0, &mgl[l].BJILU,
+                                     param->postsmooth_iter);
+        }
+
+        // or post-smoothing with hybrid l1-GS smoothers
+        else if (smoother == SMOOTHER_L1GS || smoother == SMOOTHER_L1SGS) {
+            fasp_dcsr_postsmoothing(smoother, A0, b0, e0, param->postsmooth_iter, 0,
+                                    m0 - 1, -1, relax, ndeg, smooth_order, ordering);
+        }
+
         else {
 #if MULTI_COLOR_ORDER
-            fasp_smoother_dcsr_gs_multicolor(&mgl[l].x, &mgl[l].A, &mgl[l].b,
-                                             param->postsmooth_iter, -1);
+            fasp_amg_multicolor_setup(&mgl[l]);
+            fasp_smoother_dcsr_gs_multicolor_perm(&mgl[l].x, &mgl[l].Amc,
+                                                  mgl[l].mc_dinv.val, &mgl[l].b,
+                                                  param->postsmooth_iter, -1,
+                                                  mgl[l].mc_work.val);
 #else
             fasp_dcsr_postsmoothing(smoother, A0, b0, e0, param->postsmooth_iter, 0,
                                     m0 - 1, -1, relax, ndeg, smooth_order, ordering);
@@ -258,8 +300,8 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
 #endif
 
             default:
-                /* use iterative solver on the coarsest level */
-                fasp_coarse_itsolver(A0, b0, e0, tol, prtlvl);
+                /* use built-in dense or iterative solver on the coarsest level */
+                fasp_coarse_solver(&mgl[l], tol, prtlvl);
         }
     }
 
@@ -287,6 +329,7 @@ void fasp_solver_amli(AMG_data* mgl, AMG_param* param, INT l)
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Zheng Li on 11/10/2014: update direct solvers.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by agent on 10/18/2026: add Chebyshev smoother
  */
 void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
 {
@@ -352,12 +395,33 @@ void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
             }
         }
 
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(e0, A0, b0, mgl[l].diaginv.val,
+                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                     param->presmooth_iter);
+        }
+
+        // or pre-smoothing with block-Jacobi ILU smoother
+        else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(e0, A0, b0, &mgl[l].BJILU,
+                                     param->presmooth_iter);
+        }
+
+        // or pre-smoothing with hybrid l1-GS smoothers
+        else if (smoother == SMOOTHER_L1GS || smoother == SMOOTHER_L1SGS) {
+            fasp_dcsr_presmoothing(smoother, A0, b0, e0, param->presmooth_iter, 0,
+                                   m0 - 1, 1, relax, ndeg, smooth_order, ordering);
+        }
+
         else {
 #if MULTI_COLOR_ORDER
             // printf("fasp_smoother_dcsr_gs_multicolor, %s, %d\n",  __FUNCTION__,
             // __LINE__);
-            fasp_smoother_dcsr_gs_multicolor(&mgl[l].x, &mgl[l].A, &mgl[l].b,
-                                             param->presmooth_iter, 1);
+            fasp_amg_multicolor_setup(&mgl[l]);
+            fasp_smoother_dcsr_gs_multicolor_perm(&mgl[l].x, &mgl[l].Amc,
+                                                  mgl[l].mc_dinv.val, &mgl[l].b,
+                                                  param->presmooth_iter, 1,
+                                                  mgl[l].mc_work.val);
 #else
             fasp_dcsr_presmoothing(smoother, A0, b0, e0, param->presmooth_iter, 0,
                                    m0 - 1, 1, relax, ndeg, smooth_order, ordering);
@@ -369,13 +433,7 @@ void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
         fasp_blas_dcsr_aAxpy(-1.0, A0, e0->val, r);
 
         // restriction r1 = R*r0
-        switch (amg_type) {
-            case UA_AMG:
-                fasp_blas_dcsr_mxv_agg(&mgl[l].R, r, b1->val);
-                break;
-            default:
-                fasp_blas_dcsr_mxv(&mgl[l].R, r, b1->val);
-        }
+        fasp_mg_restrict(&mgl[l], amg_type, r, b1);
 
         // call nonlinear AMLI-cycle recursively
         {
@@ -416,13 +474,7 @@ void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
         }
 
         // prolongation e0 = e0 + P*e1
-        switch (amg_type) {
-            case UA_AMG:
-                fasp_blas_dcsr_aAxpy_agg(1.0, &mgl[l].P, e1->val, e0->val);
-                break;
-            default:
-                fasp_blas_dcsr_aAxpy(1.0, &mgl[l].P, e1->val, e0->val);
-        }
+        fasp_mg_prolong(&mgl[l], amg_type, 1.0, e1->val, e0->val);
 
         // post smoothing
         if (l < mgl[l].ILU_levels) {
@@ -445,10 +497,31 @@ void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
 
         }
 
+        else if (smoother == SMOOTHER_CHEBY) {
+            fasp_smoother_dcsr_cheby(e0, A0, b0, mgl[l].diaginv.val,
+                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax, ndeg,
+                                     param->postsmooth_iter);
+        }
+
+        // or post-smoothing with block-Jacobi ILU smoother
+        else if (smoother == SMOOTHER_BJILU && mgl[l].BJILU.nblk > 0) {
+            fasp_smoother_dcsr_bjilu(e0, A0, b0, &mgl[l].BJILU,
+                                     param->postsmooth_iter);
+        }
+
+        // or post-smoothing with hybrid l1-GS smoothers
+        else if (smoother == SMOOTHER_L1GS || smoother == SMOOTHER_L1SGS) {
+            fasp_dcsr_postsmoothing(smoother, A0, b0, e0, param->postsmooth_iter, 0,
+                                    m0 - 1, -1, relax, ndeg, smooth_order, ordering);
+        }
+
         else {
 #if MULTI_COLOR_ORDER
-            fasp_smoother_dcsr_gs_multicolor(&mgl[l].x, &mgl[l].A, &mgl[l].b,
-                                             param->postsmooth_iter, -1);
+            fasp_amg_multicolor_setup(&mgl[l]);
+            fasp_smoother_dcsr_gs_multicolor_perm(&mgl[l].x, &mgl[l].Amc,
+                                                  mgl[l].mc_dinv.val, &mgl[l].b,
+                                                  param->postsmooth_iter, -1,
+                                                  mgl[l].mc_work.val);
 #else
             fasp_dcsr_postsmoothing(smoother, A0, b0, e0, param->postsmooth_iter, 0,
                                     m0 - 1, -1, relax, ndeg, smooth_order, ordering);
@@ -493,8 +566,8 @@ void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
 #endif
 
             default:
-                /* use iterative solver on the coarsest level */
-                fasp_coarse_itsolver(A0, b0, e0, tol, prtlvl);
+                /* use built-in dense or iterative solver on the coarsest level */
+                fasp_coarse_solver(&mgl[l], tol, prtlvl);
         }
     }
 
@@ -524,6 +597,7 @@ void fasp_solver_namli(AMG_data* mgl, AMG_param* param, INT l, INT num_levels)
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
  * Modified by Li Zhao on 05/01/2023: update direct solvers and smoothers.
+ * Modified by agent on 10/18/2026: add Chebyshev smoother
  */
 void fasp_solver_namli_bsr(AMG_data_bsr* mgl, AMG_param* param, INT l, INT num_levels)
 {
@@ -604,6 +678,25 @@ void fasp_solver_namli_bsr(AMG_data_bsr* mgl, AMG_param* param, INT l, INT num_l
                             fasp_smoother_dbsr_sor1(A0, b0, e0, ASCEND, NULL,
                                                     mgl[l].diaginv.val, relax);
                         break;
+                    case SMOOTHER_L1GS:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_l1gs(A0, b0, e0,
+                                                    mgl[l].diaginv.val, ASCEND);
+                        break;
+                    case SMOOTHER_L1SGS:
+                        for (i = 0; i < steps; i++) {
+                            fasp_smoother_dbsr_l1gs(A0, b0, e0,
+                                                    mgl[l].diaginv.val, ASCEND);
+                            fasp_smoother_dbsr_l1gs(A0, b0, e0,
+                                                    mgl[l].diaginv.val, DESCEND);
+                        }
+                        break;
+                    case SMOOTHER_CHEBY:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_cheby(A0, b0, e0, mgl[l].diaginv.val,
+                                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax,
+                                                     param->polynomial_degree);
+                        break;
                     default:
                         printf("### ERROR: Unknown smoother type %d!\n", smoother);
                         fasp_chkerr(ERROR_SOLVER_TYPE, __FUNCTION__);
@@ -712,6 +805,25 @@ void fasp_solver_namli_bsr(AMG_data_bsr* mgl, AMG_param* param, INT l, INT num_l
                             fasp_smoother_dbsr_sor1(A0, b0, e0, DESCEND, NULL,
                                                     mgl[l].diaginv.val, relax);
                         break;
+                    case SMOOTHER_L1GS:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_l1gs(A0, b0, e0,
+                                                    mgl[l].diaginv.val, DESCEND);
+                        break;
+                    case SMOOTHER_L1SGS:
+                        for (i = 0; i < steps; i++) {
+                            fasp_smoother_dbsr_l1gs(A0, b0, e0,
+                                                    mgl[l].diaginv.val, ASCEND);
+                            fasp_smoother_dbsr_l1gs(A0, b0, e0,
+                                                    mgl[l].diaginv.val, DESCEND);
+                        }
+                        break;
+                    case SMOOTHER_CHEBY:
+                        for (i = 0; i < steps; i++)
+                            fasp_smoother_dbsr_cheby(A0, b0, e0, mgl[l].diaginv.val,
+                                                     mgl[l].cheby_lmin, mgl[l].cheby_lmax,
+                                                     param->polynomial_degree);
+                        break;
                     default:
                         printf("### ERROR: Unknown smoother type %d!\n", smoother);
                         fasp_chkerr(ERROR_SOLVER_TYPE, __FUNCTION__);
@@ -848,6 +960,112 @@ void fasp_amg_amli_coef(const REAL lambda_max,
     return;
 }
 
+/**
+ * \fn void fasp_amg_amli_coef_setup (AMG_data *mgl, AMG_param *param)
+ *
+ * \brief Compute the AMLI polynomial of each level from spectral estimates
+ *
+ * \param mgl    Pointer to AMG data after the setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note Does nothing unless param->cycle_type is AMLI_CYCLE. The polynomial used
+ *       on level l approximates 1/x on the spectrum of B_{l+1}A_{l+1}, where
+ *       B_{l+1} is the AMLI cycle starting on level l+1. Going from the coarsest
+ *       level up, the bounds of B_{l+1}A_{l+1} are estimated by a few PCG steps
+ *       (fasp_solver_dcsr_pcg_eig) with the already finished coarser cycle as
+ *       preconditioner. The coarsest solve is taken as exact. Each level costs
+ *       a few cycles on the level below the finest one at most.
+ */
+void fasp_amg_amli_coef_setup(AMG_data* mgl, AMG_param* param)
+{
+    const SHORT nl     = mgl[0].num_levels;
+    const SHORT degree = param->amli_degree;
+    const SHORT prtlvl = param->print_level;
+    const INT   nsteps = 8; // number of PCG steps for the estimates
+
+    amli_level_data data;
+    precond         pc;
+    dvector         rhs, sol;
+    REAL            lmin, lmax;
+    INT             i, l, m;
+
+    if (param->cycle_type != AMLI_CYCLE) return;
+
+    data.mgl   = mgl;
+    data.param = param;
+    pc.data    = &data;
+    pc.fct     = amli_level_precond;
+
+    for (l = nl - 2; l >= 0; --l) {
+
+        if (l == nl - 2) { // exact solve on the coarsest level
+            lmin = lmax = 1.0;
+        } else {
+            m          = mgl[l + 1].A.row;
+            data.level = l + 1;
+            rhs        = fasp_dvec_create(m);
+            sol        = fasp_dvec_create(m);
+            for (i = 0; i < m; ++i) rhs.val[i] = (REAL)((i * 7919 + 17) % 1009) / 1009.0 - 0.5;
+
+            fasp_solver_dcsr_pcg_eig(&mgl[l + 1].A, &rhs, &sol, &pc, 1e-12, 0.0, nsteps,
+                                     STOP_REL_RES, PRINT_NONE, &lmin, &lmax);
+
+            fasp_dvec_free(&rhs);
+            fasp_dvec_free(&sol);
+
+            // Ritz values lie inside the spectrum: widen the interval a bit
+            if (lmax <= 0.0 || lmin <= 0.0) {
+                lmax = 2.0;
+                lmin = lmax / 4; // fall back to the default bounds
+            } else {
+                lmax = 1.1 * lmax;
+                lmin = MIN(0.9 * lmin, lmax);
+            }
+        }
+
+        fasp_mem_free(mgl[l].amli_coef);
+        mgl[l].amli_coef = (REAL*)fasp_mem_calloc(degree + 1, sizeof(REAL));
+        fasp_amg_amli_coef(lmax, lmin, degree, mgl[l].amli_coef);
+
+        if (prtlvl > PRINT_SOME)
+            printf("AMLI level %2d: lambda in [%.4e, %.4e]\n", l, lmin, lmax);
+    }
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void amli_level_precond (REAL *r, REAL *z, void *data)
+ *
+ * \brief One AMLI cycle started from a given level as a preconditioner
+ *
+ * \param r     Pointer to the vector needs preconditioning
+ * \param z     Pointer to preconditioned vector
+ * \param data  Pointer to amli_level_data
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static void amli_level_precond(REAL* r, REAL* z, void* data)
+{
+    amli_level_data* ald = (amli_level_data*)data;
+    AMG_data*        mgl = ald->mgl;
+    const INT        l   = ald->level;
+    const INT        m   = mgl[l].A.row;
+
+    fasp_darray_cp(m, r, mgl[l].b.val);
+    fasp_dvec_set(m, &mgl[l].x, 0.0);
+
+    fasp_solver_amli(mgl, ald->param, l);
+
+    fasp_darray_cp(m, mgl[l].x.val, z);
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
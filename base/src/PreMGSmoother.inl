@@ -45,6 +45,7 @@
  *
  * Modified by Xiaozhe on 06/04/2012: add ndeg as input
  * Modified by Chensong on 02/16/2013: GS -> SMOOTHER_GS, etc
+ * Modified by agent on 10/18/2026: add hybrid l1-GS smoothers
  */
 static void fasp_dcsr_presmoothing(const SHORT smoother,
                                    dCSRmat*    A,
@@ -65,6 +66,7 @@ static void fasp_dcsr_presmoothing(const SHORT smoother,
             fasp_smoother_dcsr_jacobi_ff(x, A, b, nsweeps, ordering, relax);
             break;
 
+        case SMOOTHER_BJILU: // fallback if block-Jacobi ILU setup failed
         case SMOOTHER_GS:
             if (order == NO_ORDER || ordering == NULL)
                 fasp_smoother_dcsr_gs(x, istart, iend, istep, A, b, nsweeps);
@@ -88,6 +90,14 @@ static void fasp_dcsr_presmoothing(const SHORT smoother,
             fasp_smoother_dcsr_L1diag(x, istart, iend, istep, A, b, nsweeps);
             break;
 
+        case SMOOTHER_L1GS:
+            fasp_smoother_dcsr_l1gs(x, A, b, ASCEND, nsweeps);
+            break;
+
+        case SMOOTHER_L1SGS:
+            fasp_smoother_dcsr_l1sgs(x, A, b, nsweeps);
+            break;
+
         case SMOOTHER_POLY:
             fasp_smoother_dcsr_poly(A, b, x, iend + 1, ndeg, nsweeps);
             break;
@@ -151,6 +161,7 @@ static void fasp_dcsr_presmoothing(const SHORT smoother,
  *
  * Modified by Xiaozhe Hu on 06/04/2012: add ndeg as input
  * Modified by Chensong on 02/16/2013: GS -> SMOOTHER_GS, etc
+ * Modified by agent on 10/18/2026: add hybrid l1-GS smoothers
  */
 static void fasp_dcsr_postsmoothing(const SHORT smoother,
                                     dCSRmat*    A,
@@ -171,6 +182,7 @@ static void fasp_dcsr_postsmoothing(const SHORT smoother,
             fasp_smoother_dcsr_jacobi_ff(x, A, b, nsweeps, ordering, relax);
             break;
             
+        case SMOOTHER_BJILU: // fallback if block-Jacobi ILU setup failed
         case SMOOTHER_GS:
             if (order == NO_ORDER || ordering == NULL) {
                 fasp_smoother_dcsr_gs(x, iend, istart, istep, A, b, nsweeps);
@@ -194,6 +206,14 @@ static void fasp_dcsr_postsmoothing(const SHORT smoother,
             fasp_smoother_dcsr_L1diag(x, iend, istart, istep, A, b, nsweeps);
             break;
 
+        case SMOOTHER_L1GS:
+            fasp_smoother_dcsr_l1gs(x, A, b, DESCEND, nsweeps);
+            break;
+
+        case SMOOTHER_L1SGS:
+            fasp_smoother_dcsr_l1sgs(x, A, b, nsweeps);
+            break;
+
         case SMOOTHER_POLY:
             fasp_smoother_dcsr_poly(A, b, x, iend + 1, ndeg, nsweeps);
             break;
@@ -1,6 +1,6 @@
 /*! \file  PreMGUtil.inl
  *
- *  \brief Routines for multigrid coarsest level solver
+ *  \brief Routines for multigrid coarsest level solver and grid transfer
  *
  *  \note  This file contains Level-4 (Pre) functions, which are used in:
  *         PreBSR.c, PreCSR.c, PreMGCycle.c, PreMGCycleFull.c, PreMGRecur.c,
@@ -57,6 +57,104 @@ static inline void fasp_coarse_itsolver (const dCSRmat  *A,
     }
 }
 
+/**
+ * \fn static inline void fasp_coarse_solver (AMG_data *mgc, const REAL ctol,
+ *                                            const SHORT PrtLvl)
+ *
+ * \brief Default solver on the coarset level of multigrid methods
+ *
+ * \param  mgc       pointer to the AMG_data of the coarsest level
+ * \param  ctol      tolerance for the coarsest level
+ * \param  PrtLvl    level of output
+ *
+ * \note Use the dense LU factors from the setup phase if they are available;
+ *       otherwise, solve the coarsest level problem iteratively.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void fasp_coarse_solver (AMG_data    *mgc,
+                                       const REAL   ctol,
+                                       const SHORT  PrtLvl)
+{
+    if ( mgc->dense_LU != NULL ) {
+        fasp_smat_lu_solve_blk(mgc->dense_LU, mgc->dense_piv, mgc->b.val,
+                               mgc->x.val, mgc->A.row);
+    }
+    else {
+        fasp_coarse_itsolver(&mgc->A, &mgc->b, &mgc->x, ctol, PrtLvl);
+    }
+}
+
+/**
+ * \fn static inline void fasp_mg_restrict (const AMG_data *mgl, const SHORT amg_type,
+ *                                          const REAL *r, dvector *b)
+ *
+ * \brief Restriction of the residual to the next coarser level: b = R*r
+ *
+ * \param  mgl       pointer to the AMG_data of the current (fine) level
+ * \param  amg_type  type of AMG method
+ * \param  r         residual on the current level
+ * \param  b         right-hand side on the next coarser level
+ *
+ * \note If R has not been formed in the setup phase, R = P' is applied on the fly
+ *       with its pattern Rmap; for UA AMG, Rmap lists the nodes of each aggregate.
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void fasp_mg_restrict (const AMG_data  *mgl,
+                                     const SHORT      amg_type,
+                                     const REAL      *r,
+                                     dvector         *b)
+{
+    if ( mgl->aggmap.val != NULL ) {
+        fasp_blas_aggmap_mxtv(&mgl->Rmap, r, b->val);
+    }
+    else if ( mgl->R.IA == NULL ) {
+        fasp_blas_dcsr_mxtv(&mgl->P, (mgl->Rmap.IA == NULL) ? NULL : &mgl->Rmap, r,
+                            b->val);
+    }
+    else if ( amg_type == UA_AMG ) {
+        fasp_blas_dcsr_mxv_agg(&mgl->R, r, b->val);
+    }
+    else {
+        fasp_blas_dcsr_mxv(&mgl->R, r, b->val);
+    }
+}
+
+/**
+ * \fn static inline void fasp_mg_prolong (const AMG_data *mgl, const SHORT amg_type,
+ *                                         const REAL alpha, const REAL *e, REAL *x)
+ *
+ * \brief Prolongation of the coarse level correction: x = x + alpha*P*e
+ *
+ * \param  mgl       pointer to the AMG_data of the current (fine) level
+ * \param  amg_type  type of AMG method
+ * \param  alpha     scaling factor of the coarse level correction
+ * \param  e         correction on the next coarser level
+ * \param  x         solution on the current level
+ *
+ * \author agent
+ * \date   10/18/2026
+ */
+static inline void fasp_mg_prolong (const AMG_data  *mgl,
+                                    const SHORT      amg_type,
+                                    const REAL       alpha,
+                                    const REAL      *e,
+                                    REAL            *x)
+{
+    if ( mgl->aggmap.val != NULL ) {
+        fasp_blas_aggmap_aAxpy(alpha, &mgl->aggmap, e, x);
+    }
+    else if ( amg_type == UA_AMG ) {
+        fasp_blas_dcsr_aAxpy_agg(alpha, &mgl->P, e, x);
+    }
+    else {
+        fasp_blas_dcsr_aAxpy(alpha, &mgl->P, e, x);
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
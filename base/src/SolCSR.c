@@ -643,6 +643,71 @@ FINISHED:
     return status;
 }
 
+/**
+ * \fn INT fasp_solver_dcsr_krylov_bjilu (dCSRmat *A, dvector *b, dvector *x,
+ *                                        ITS_param *itparam, ILU_param *iluparam)
+ *
+ * \brief Solve Ax=b by block-Jacobi ILU preconditioned Krylov methods
+ *
+ * \param A         Pointer to the coeff matrix in dCSRmat format
+ * \param b         Pointer to the right hand side in dvector format
+ * \param x         Pointer to the approx solution in dvector format
+ * \param itparam   Pointer to parameters for iterative solvers
+ * \param iluparam  Pointer to parameters for ILU
+ *
+ * \return          Iteration number if converges; ERROR otherwise.
+ *
+ * \author agent
+ * \date   10/18/2026
+ *
+ * \note One diagonal block per OpenMP thread; each block is factorized and solved
+ *       independently, so both setup and preconditioning run in parallel.
+ */
+INT fasp_solver_dcsr_krylov_bjilu(dCSRmat* A, dvector* b, dvector* x,
+                                  ITS_param* itparam, ILU_param* iluparam)
+{
+    const SHORT prtlvl = itparam->print_level;
+
+    /* Local Variables */
+    INT  status = FASP_SUCCESS;
+    REAL solve_start, solve_end, solve_time;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: matrix size: %d %d %d\n", A->row, A->col, A->nnz);
+    printf("### DEBUG: rhs/sol size: %d %d\n", b->row, x->row);
+#endif
+
+    fasp_gettime(&solve_start);
+
+    // ILU setup for diagonal blocks, one block per thread
+    BJILU_data BJLU;
+    if ((status = fasp_ilu_dcsr_setup_bj(A, &BJLU, iluparam, 0)) < 0) goto FINISHED;
+
+    // set preconditioner
+    precond pc;
+    pc.data = &BJLU;
+    pc.fct  = fasp_precond_bjilu;
+
+    // call iterative solver
+    status = fasp_solver_dcsr_itsolver(A, b, x, &pc, itparam);
+
+    if (prtlvl >= PRINT_MIN) {
+        fasp_gettime(&solve_end);
+        solve_time = solve_end - solve_start;
+        fasp_cputime("BJILU_Krylov method totally", solve_time);
+    }
+
+FINISHED:
+    fasp_bjilu_data_free(&BJLU);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    return status;
+}
+
 /**
  * \fn INT fasp_solver_dcsr_krylov_ilu_M (dCSRmat *A, dvector *b, dvector *x,
  *                                        ITS_param *itparam, ILU_param *iluparam,
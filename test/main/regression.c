@@ -35,6 +35,98 @@ static void check_solu(dvector *x, dvector *sol, double tol)
     }   
 }
 
+/**
+ * \fn static void check_nnz(INT nnz, INT nnz_ref)
+ *
+ * \brief This function checks whether two sparse factors have the same size.
+ */
+static void check_nnz(INT nnz, INT nnz_ref)
+{
+    ntest++;
+    
+    if ( nnz == nnz_ref ) {
+        printf("Number of nonzeros %d equal to reference.............. [PASS]\n", nnz);
+    }
+    else {
+        nfail++;
+        printf("### WARNING: Number of nonzeros %d NOT equal to %d.... [ATTENTION!!!]\n",
+               nnz, nnz_ref);
+    }
+}
+
+/**
+ * \fn static void check_iter(INT iter, INT iter_ref)
+ *
+ * \brief This function checks whether a solver converged in iter_ref iterations.
+ */
+static void check_iter(INT iter, INT iter_ref)
+{
+    ntest++;
+    
+    if ( iter >= 0 && iter <= iter_ref ) {
+        printf("Number of iterations %d within expected bound........ [PASS]\n", iter);
+    }
+    else {
+        nfail++;
+        printf("### WARNING: Number of iterations %d BIGGER than %d.... [ATTENTION!!!]\n",
+               iter, iter_ref);
+    }
+}
+
+/**
+ * \fn static void check_mis2(dCSRmat *A, INT *state)
+ *
+ * \brief This function checks whether the nodes with state 1 form a distance-2
+ *        maximal independent set of the graph of A.
+ */
+static void check_mis2(dCSRmat *A, INT *state)
+{
+    const INT n = A->row;
+    INT       i, j, k, jj, kk, num_bad = 0;
+    INT      *near = (INT *)fasp_mem_calloc(n, sizeof(INT));
+    
+    ntest++;
+    
+    // near[k] counts the roots within distance two of k, itself included
+    for ( i = 0; i < n; ++i ) {
+        if ( state[i] != 1 ) continue;
+        near[i]++;
+        for ( j = A->IA[i]; j < A->IA[i+1]; ++j ) {
+            k = A->JA[j];
+            if ( k != i && near[k] >= 0 ) near[k] = -(near[k] + 1);
+            for ( jj = A->IA[k]; jj < A->IA[k+1]; ++jj ) {
+                kk = A->JA[jj];
+                if ( kk != i && near[kk] >= 0 ) near[kk] = -(near[kk] + 1);
+            }
+        }
+        // visited nodes were flipped to avoid counting them twice
+        for ( j = A->IA[i]; j < A->IA[i+1]; ++j ) {
+            k = A->JA[j];
+            if ( near[k] < 0 ) near[k] = -near[k];
+            for ( jj = A->IA[k]; jj < A->IA[k+1]; ++jj ) {
+                kk = A->JA[jj];
+                if ( near[kk] < 0 ) near[kk] = -near[kk];
+            }
+        }
+    }
+    
+    // independent: no root near another root; maximal: every node near a root
+    for ( i = 0; i < n; ++i ) {
+        if ( (state[i] == 1 && near[i] != 1) || near[i] == 0 ) num_bad++;
+    }
+    
+    fasp_mem_free(near); near = NULL;
+    
+    if ( num_bad == 0 ) {
+        printf("Distance-2 maximal independent set is valid........... [PASS]\n");
+    }
+    else {
+        nfail++;
+        printf("### WARNING: Distance-2 MIS fails at %d nodes......... [ATTENTION!!!]\n",
+               num_bad);
+    }
+}
+
 /**
  * \fn int main (int argc, const char * argv[])
  * 
@@ -48,6 +140,7 @@ static void check_solu(dvector *x, dvector *sol, double tol)
  * Modified by Chensong Zhang on 03/20/2012
  * Modified by Chunsheng Feng on 03/04/2016
  * Modified by Chensong Zhang on 01/22/2017
+ * Modified by agent on 10/18/2026: check iteration counts of new options
  */
 int main (int argc, const char * argv[]) 
 {
@@ -61,6 +154,7 @@ int main (int argc, const char * argv[])
     dCSRmat    A;            // coefficient matrix
     dvector    b, x, sol;    // rhs, numerical sol, exact sol
     INT        indp;         // index for test problems
+    INT        iter;         // number of iterations
     int        status = FASP_SUCCESS;
     time_t     lt = time(NULL);
     
@@ -338,6 +432,87 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* SA AMG V-cycle with MIS2 aggregation as a solver */
+            const INT iter_ref[3] = {1, 33, 27};
+            printf("------------------------------------------------------------------\n");
+            printf("SA AMG V-cycle with MIS2 aggregation as iterative solver ...\n");
+            
+            INT *state = (INT *)fasp_mem_calloc(A.row, sizeof(INT));
+            fasp_sparse_mis2(&A, 1, state);
+            check_mis2(&A, state);
+            fasp_mem_free(state); state = NULL;
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit            = 500;
+            amgparam.tol              = 1e-10;
+            amgparam.strong_coupled   = 0.15; // cannot be too big
+            amgparam.AMG_type         = SA_AMG;
+            amgparam.aggregation_type = MIS2;
+            amgparam.smoother         = SMOOTHER_GS;
+            amgparam.print_level      = print_level;
+            iter = fasp_solver_amg(&A, &b, &x, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycle with dense LU on the coarsest level as a solver */
+            const INT iter_ref[3] = {1, 14, 16};
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG V-cycle with dense coarsest LU as iterative solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit         = 20;
+            amgparam.tol           = 1e-10;
+            amgparam.coarse_solver = SOLVER_DEFAULT; // built-in dense LU
+            amgparam.coarse_dof    = 500;
+            amgparam.print_level   = print_level;
+            iter = fasp_solver_amg(&A, &b, &x, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycle with Chebyshev smoother as a solver */
+            const INT iter_ref[3] = {1, 20, 64};
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG V-cycle with CHEBY smoother as iterative solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit         = 100;
+            amgparam.tol           = 1e-10;
+            amgparam.smoother      = SMOOTHER_CHEBY;
+            amgparam.print_level   = print_level;
+            iter = fasp_solver_amg(&A, &b, &x, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycle with l1-GS smoother as a solver */
+            const INT iter_ref[3] = {1, 16, 16};
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG V-cycle with L1GS smoother as iterative solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit         = 100;
+            amgparam.tol           = 1e-10;
+            amgparam.smoother      = SMOOTHER_L1GS;
+            amgparam.print_level   = print_level;
+            iter = fasp_solver_amg(&A, &b, &x, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* CG */
             printf("------------------------------------------------------------------\n");
@@ -795,6 +970,64 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using AMG with sparsified coarse matrices as preconditioner for CG */
+            const INT iter_ref[3] = {1, 8, 8};
+            printf("------------------------------------------------------------------\n");
+            printf("AMG (sparsified coarse matrices) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            itparam.maxit           = 500;
+            itparam.tol             = 1e-10;
+            itparam.print_level     = print_level;
+            amgparam.sparsify_tol   = 0.01;
+            amgparam.sparsify_level = 1;
+            iter = fasp_solver_dcsr_krylov_amg(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using complexity-budgeted AMG as preconditioner for CG */
+            const INT iter_ref[3] = {1, 8, 8};
+            printf("------------------------------------------------------------------\n");
+            printf("AMG (operator complexity budget) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            itparam.maxit                    = 500;
+            itparam.tol                      = 1e-10;
+            itparam.print_level              = print_level;
+            amgparam.max_operator_complexity = 1.5;
+            iter = fasp_solver_dcsr_krylov_amg(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using AMG with threads by level size as preconditioner for CG */
+            const INT iter_ref[3] = {1, 9, 8};
+            printf("------------------------------------------------------------------\n");
+            printf("AMG (threads by level size) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            itparam.maxit          = 500;
+            itparam.tol            = 1e-10;
+            itparam.print_level    = print_level;
+            amgparam.thread_policy = THREAD_SIZE;
+            iter = fasp_solver_dcsr_krylov_amg(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* Using ILUk as preconditioner for CG */
             ILU_param      iluparam;
@@ -812,6 +1045,29 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
 
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using ILUk with split factors as preconditioner for CG */
+            ILU_param      iluparam;
+            INT            iter_msr;
+            printf("------------------------------------------------------------------\n");
+            printf("ILUk (split factors) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_ilu_init(&iluparam);
+            itparam.maxit         = 500;
+            itparam.tol           = 1e-8;
+            itparam.print_level   = print_level;
+            iter_msr = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itparam, &iluparam);
+            
+            fasp_dvec_set(b.row, &x, 0.0); // same solves on the split copy
+            iluparam.ILU_split = 1;
+            iter = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itparam, &iluparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_msr);
+        }
+
         if ( indp==1 || indp==2 || indp==3 ) {
             /* Using ILUt as preconditioner for CG */
             ILU_param      iluparam;
@@ -848,6 +1104,142 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
 
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using ILUk with Jacobi triangular solves as preconditioner for CG */
+            ILU_param      iluparam;
+            const INT iter_ref[3] = {13, 56, 28};
+            printf("------------------------------------------------------------------\n");
+            printf("ILUk (Jacobi triangular solves) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_ilu_init(&iluparam);
+            iluparam.ILU_jacobi_sweeps = 3;
+            itparam.maxit              = 500;
+            itparam.tol                = 1e-10;
+            itparam.print_level        = print_level;
+            iter = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itparam, &iluparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using fixed-point ILUk as preconditioner for CG */
+            ILU_param      iluparam;
+            const INT iter_ref[3] = {23, 79, 136};
+            printf("------------------------------------------------------------------\n");
+            printf("Fixed-point ILUk preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_ilu_init(&iluparam);
+            iluparam.ILU_fp_sweeps = 3;
+            itparam.maxit          = 500;
+            itparam.tol            = 1e-12; // factors are approximate: NOS7 needs this
+            itparam.print_level    = print_level;
+            iter = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itparam, &iluparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using block-Jacobi ILUk with two blocks as preconditioner for CG */
+            // blocks are contiguous row ranges: the P1 FE rows of problem 2 are
+            // not numbered locally, so the blocks drop many couplings of A
+            ILU_param      iluparam;
+            BJILU_data     bjdata;
+            precond        pc;
+            const INT iter_ref[3] = {16, 190, 32};
+            printf("------------------------------------------------------------------\n");
+            printf("Block-Jacobi ILUk preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_ilu_init(&iluparam);
+            itparam.maxit       = 500;
+            itparam.tol         = 1e-10;
+            itparam.print_level = print_level;
+            fasp_ilu_dcsr_setup_bj(&A, &bjdata, &iluparam, 2);
+            pc.data = &bjdata;
+            pc.fct  = fasp_precond_bjilu;
+            iter = fasp_solver_dcsr_itsolver(&A, &b, &x, &pc, &itparam);
+            fasp_bjilu_data_free(&bjdata);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using ILUk after RCM reordering as preconditioner for CG */
+            ILU_param      iluparam;
+            const INT iter_ref[3] = {8, 35, 18};
+            printf("------------------------------------------------------------------\n");
+            printf("ILUk (RCM ordering) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_ilu_init(&iluparam);
+            iluparam.ILU_reorder = ILU_ORDER_RCM;
+            itparam.maxit        = 500;
+            itparam.tol          = 1e-10;
+            itparam.print_level  = print_level;
+            iter = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itparam, &iluparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using ILUk after nested dissection as preconditioner for CG */
+            ILU_param      iluparam;
+            const INT iter_ref[3] = {10, 52, 20};
+            printf("------------------------------------------------------------------\n");
+            printf("ILUk (ND ordering) preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            fasp_param_ilu_init(&iluparam);
+            iluparam.ILU_reorder = ILU_ORDER_ND;
+            itparam.maxit        = 500;
+            itparam.tol          = 1e-10;
+            itparam.print_level  = print_level;
+            iter = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itparam, &iluparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_iter(iter, iter_ref[indp-1]);
+        }
+        
+        if ( indp==2 ) {
+            /* Fixed-point ILUk factors against ILUk: A has stored zeros */
+            ILU_param      iluparam;
+            ILU_data       ilu_ref, ilu_fp;
+            dvector        z_ref, z_fp;
+            printf("------------------------------------------------------------------\n");
+            printf("Fixed-point ILUk factors compared with ILUk ...\n");
+            
+            fasp_param_ilu_init(&iluparam);
+            iluparam.print_level   = print_level;
+            fasp_ilu_dcsr_setup(&A, &ilu_ref, &iluparam);
+            iluparam.ILU_fp_sweeps = 50; // enough sweeps to reach the ILUk factors
+            fasp_ilu_dcsr_setup(&A, &ilu_fp, &iluparam);
+            
+            check_nnz(ilu_fp.nzlu, ilu_ref.nzlu);
+            
+            z_ref = fasp_dvec_create(b.row);
+            z_fp  = fasp_dvec_create(b.row);
+            fasp_precond_ilu(b.val, z_ref.val, &ilu_ref);
+            fasp_precond_ilu(b.val, z_fp.val, &ilu_fp);
+            
+            check_solu(&z_fp, &z_ref, 1e-10);
+            
+            fasp_ilu_data_free(&ilu_ref);
+            fasp_ilu_data_free(&ilu_fp);
+            fasp_dvec_free(&z_ref);
+            fasp_dvec_free(&z_fp);
+        }
+
         /* clean up memory */
         fasp_dcsr_free(&A);
         fasp_dvec_free(&b);
@@ -348,6 +348,12 @@ int main(int argc, const char* argv[])
             status = fasp_solver_dcsr_krylov_ilu(&A, &b, &x, &itspar, &ilupar);
         }
 
+        // Using block-Jacobi ILU as preconditioner for Krylov iterative methods
+        else if (precond_type == PREC_BJILU) {
+            if (print_level > PRINT_NONE) fasp_param_ilu_print(&ilupar);
+            status = fasp_solver_dcsr_krylov_bjilu(&A, &b, &x, &itspar, &ilupar);
+        }
+
         // Using Schwarz as preconditioner for Krylov iterative methods
         else if (precond_type == PREC_SCHWARZ) {
             if (print_level > PRINT_NONE) fasp_param_swz_print(&swzpar);